@@ -0,0 +1,4 @@
+
+#define CRASH_HANDLER CrashHandler::DEFAULT
+/* #undef SET_PTRACER */
+/* #undef ELM_STAT */
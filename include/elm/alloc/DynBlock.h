@@ -7,14 +7,17 @@
 #ifndef ELM_BLOCK_DYNBLOCK_H
 #define ELM_BLOCK_DYNBLOCK_H
 
+#include <stdlib.h>
+
 namespace elm { namespace block {
 
 // DynBlock class
 class DynBlock {
 public:
+	static const int max_step = 64 << 20;
 	inline DynBlock(int capacity = 256, int increment = 64)
-		: _size(0), cap(capacity), inc(increment), buf(new char[capacity]) { }
-	inline ~DynBlock(void) { if(buf) delete [] buf; }
+		: _size(0), cap(capacity), inc(increment), buf(static_cast<char *>(::malloc(capacity))) { }
+	inline ~DynBlock(void) { ::free(buf); }
 	void put(const char *block, int size);
 	void get(char *block, int size, int pos);
 	char *alloc(int size);
@@ -22,14 +25,15 @@ public:
 	inline int capacity(void) const { return cap; }
 	inline int increment(void) const { return inc; }
 	inline void setSize(int new_size) { _size = new_size; }
-	inline void reset(void) { _size = 0; if(!buf) buf = new char[cap]; }
+	inline void reset(void) { _size = 0; if(!buf) buf = static_cast<char *>(::malloc(cap)); }
+	inline void reserve(int n) { if(n > cap) resize(n); }
 	inline const char *base(void) const { return buf; }
-	inline char *detach(void)
-		{ char *result = buf; buf = 0; return result; }
+	char *detach(void);
 private:
 	int _size, cap, inc;
 	char *buf;
 	void grow(int min);
+	void resize(int new_cap);
 };
 
 } } // elm::block
@@ -22,7 +22,7 @@
 #define ELM_ALLOC_GROUPEDGC_H_
 
 #include <elm/util/BitVector.h>
-#include <elm/stree/Tree.h>
+#include <elm/alloc/PageMap.h>
 #include <elm/data/List.h>
 #include <elm/data/BiDiList.h>
 #include <elm/alloc/DefaultAllocator.h>
@@ -70,8 +70,7 @@ private:
 	inhstruct::DLList temps;
 	bool needGC; // delayed GC feature
 
-	typedef stree::Tree<void *, chunk_t *> tree_t;
-	tree_t *st; // use to store the tree of the chunks vs the range of the memory addresses
+	PageMap pages; // map of the memory addresses to the chunks
 
 	static inline t::size round(t::size size) { return (size + sizeof(block_t) - 1) & ~(sizeof(block_t) - 1); }
 
@@ -0,0 +1,73 @@
+/*
+ *	PageMap class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_ALLOC_PAGEMAP_H_
+#define ELM_ALLOC_PAGEMAP_H_
+
+#include <elm/types.h>
+
+namespace elm {
+
+class PageMap {
+public:
+	PageMap(t::size page_size);
+	~PageMap(void);
+	void add(void *base, t::size size, void *data);
+	void remove(void *base, t::size size);
+	void clear(void);
+	inline int pageShift(void) const { return _shift; }
+
+	inline void *get(const void *p) const {
+		t::intptr a = t::intptr(p);
+		const entry_t *e = lookup(a >> _shift);
+		if(e == nullptr)
+			return nullptr;
+		return a < e->split ? e->lo : e->hi;
+	}
+
+private:
+	typedef struct entry_t {
+		t::intptr split;
+		void *lo, *hi;
+	} entry_t;
+
+	entry_t& fetch(t::intptr k);
+	inline entry_t *lookup(t::intptr k) const {
+		if(_root == nullptr || (k >> _kbits) != 0)
+			return nullptr;
+		entry_t **m = _root[k >> (_mbits + _lbits)];
+		if(m == nullptr)
+			return nullptr;
+		entry_t *l = m[(k >> _lbits) & ((1 << _mbits) - 1)];
+		if(l == nullptr)
+			return nullptr;
+		return l + (k & ((1 << _lbits) - 1));
+	}
+
+	PageMap(const PageMap&);
+	PageMap& operator=(const PageMap&);
+
+	int _shift, _kbits, _rbits, _mbits, _lbits;
+	entry_t ***_root;
+};
+
+}	// elm
+
+#endif /* ELM_ALLOC_PAGEMAP_H_ */
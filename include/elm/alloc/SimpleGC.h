@@ -22,7 +22,7 @@
 #define ELM_ALLOC_SIMPLEGC_H_
 
 #include <elm/util/BitVector.h>
-#include <elm/stree/Tree.h>
+#include <elm/alloc/PageMap.h>
 #include <elm/data/List.h>
 #include <elm/data/BiDiList.h>
 #include <elm/alloc/DefaultAllocator.h>
@@ -91,8 +91,7 @@ private:
 	block_t *free_list;
 	inhstruct::DLList temps;
 
-	typedef stree::Tree<void *, chunk_t *> tree_t;
-	tree_t *st;
+	PageMap pages;
 
 	static inline t::size round(t::size size) { return (size + sizeof(block_t) - 1) & ~(sizeof(block_t) - 1); }
 };
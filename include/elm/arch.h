@@ -23,6 +23,7 @@
 #define ELM_ARCH_H
 
 #define ELM_LITTLE_ENDIAN
+/* #undef ELM_NO_STRING_ATOMIC */
 
 namespace elm { namespace t {
 
@@ -24,6 +24,8 @@
 
 #include <new>
 #include <string.h>
+#include <type_traits>
+#include <utility>
 #include <elm/meta.h>
 #include <elm/type_info.h>
 #include <elm/util/misc.h>
@@ -32,19 +34,29 @@ namespace elm {
 
 namespace array {
 
+// relocation traits
+template <class T> struct is_trivial
+	{ enum { _ = type_info<T>::is_trivial || std::is_trivial<T>::value }; };
+template <class T> struct is_relocatable
+	{ enum { _ = type_info<T>::is_relocatable || is_trivial<T>::_ }; };
+
 // fast copies
 template <class T> class fast {
 public:
 	static inline void copy(T *target, const T *source, int size)
-		{ ::memcpy(target, source, size * sizeof(T)); }
+		{ if(size) ::memcpy(target, source, size * sizeof(T)); }
 	static inline void move(T *target, const T *source, int size)
-		{ ::memmove(target, source, size * sizeof(T)); }
+		{ if(size) ::memmove(target, source, size * sizeof(T)); }
+	static inline void relocate(T *target, T *source, int size)
+		{ if(size) ::memmove(target, source, size * sizeof(T)); }
+	static inline void transfer(T *target, T *source, int size)
+		{ if(size) ::memcpy(static_cast<void *>(target), static_cast<const void *>(source), size * sizeof(T)); }
 	static inline void clear(T *target, int size)
 		{ ::memset(target, 0, size * sizeof(T)); }
 	static inline bool equals(const T* t1, const T* t2, int size)
 		{ return ::memcmp(t1, t2, size) == 0; }
-	static inline void construct(T *t, int size) { }
-	static inline void destruct(T *t, int size) { }
+	static inline void construct(T *, int) { }
+	static inline void destruct(T *, int) { }
 };
 
 // slow copies (cause of constructor, destructor, etc)
@@ -56,6 +68,14 @@ public:
 		{ for(int i = size - 1; i >= 0; i--) target[i] = source[i]; }
 	static inline void move(T *target, const T *source, int size)
 		{ if(target < source) copy(target, source, size); else copy_back(target, source, size); }
+	static inline void relocate(T *target, T *source, int size) {
+		if(target < source)
+			for(int i = 0; i < size; i++) target[i] = std::move(source[i]);
+		else
+			for(int i = size - 1; i >= 0; i--) target[i] = std::move(source[i]);
+	}
+	static inline void transfer(T *target, T *source, int size)
+		{ for(int i = 0; i < size; i++) { ::new((void *)(target + i)) T(std::move(source[i])); source[i].~T(); } }
 	static inline void clear(T *target, int size)
 		{ for(int i = 0; i < size; i++) target[i] = T(); }
 	static inline bool equals(const T* t1, const T* t2, int size)
@@ -68,11 +88,15 @@ public:
 
 // copy definitions
 template <class T> inline void copy(T *target, const T *source, int size)
-	{ _if<type_info<T>::is_deep, slow<T>, fast<T> >::copy(target, source, size); }
+	{ _if<type_info<T>::is_deep && !is_trivial<T>::_, slow<T>, fast<T> >::copy(target, source, size); }
 template <class T> inline void copy_back(T *target, const T *source, int size)
 	{ for(int i = size - 1; i >= 0; i--) target[i] = source[i]; }
 template <class T> inline void move(T *target, const T *source, int size)
-	{ _if<type_info<T>::is_deep, slow<T>, fast<T> >::move(target, source, size); }
+	{ _if<type_info<T>::is_deep && !is_trivial<T>::_, slow<T>, fast<T> >::move(target, source, size); }
+template <class T> inline void relocate(T *target, T *source, int size)
+	{ _if<type_info<T>::is_deep && !is_trivial<T>::_, slow<T>, fast<T> >::relocate(target, source, size); }
+template <class T> inline void transfer(T *target, T *source, int size)
+	{ _if<is_relocatable<T>::_, fast<T>, slow<T> >::transfer(target, source, size); }
 template <class T> inline void set(T *target, int size, const T& v)
 	{ for(int i = 0; i < size; i++) target[i] = v; }
 template <class T> inline void clear(T *target, int size)
@@ -80,9 +104,9 @@ template <class T> inline void clear(T *target, int size)
 template <class T> inline bool equals(const T* t1, const T* t2, int size)
 	{ return _if<type_info<T>::is_virtual, slow<T>, fast<T> >::equals(t1, t2, size); }
 template <class T> inline void construct(T *t, int size)
-	{ _if<type_info<T>::is_virtual, slow<T>, fast<T> >::construct(t, size); }
+	{ _if<type_info<T>::is_virtual && !is_trivial<T>::_, slow<T>, fast<T> >::construct(t, size); }
 template <class T> inline void destruct(T *t, int size)
-	{ _if<type_info<T>::is_virtual, slow<T>, fast<T> >::destruct(t, size); }
+	{ _if<type_info<T>::is_virtual && !is_trivial<T>::_, slow<T>, fast<T> >::destruct(t, size); }
 inline void copy(cstring *d, cstring *a, int s)
 	{ copy(reinterpret_cast<char *>(d), reinterpret_cast<char *>(a), sizeof(cstring) * s); }
 inline void move(cstring *d, cstring *a, int s)
@@ -41,7 +41,7 @@ public:
 	inline int count(void) const { return _cnt; }
 
 protected:
-	static const int MAX_HEIGHT = 32;
+	static const int MAX_HEIGHT = 48;
 	typedef signed char balance_t;
 	typedef enum {
 		LEFT = -1,
@@ -0,0 +1,567 @@
+/*
+ *	BTree class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_DATA_BTREE_H_
+#define ELM_DATA_BTREE_H_
+
+#include "custom.h"
+#include "Vector.h"
+#include <elm/adapter.h>
+#include <elm/array.h>
+#include <elm/assert.h>
+#include <elm/compare.h>
+#include <elm/PreIterator.h>
+
+namespace elm {
+
+template <class T, class K = IdAdapter<T>, class C = Comparator<typename K::key_t>, class A = DefaultAlloc>
+class BTree: public C, public A {
+public:
+	typedef T t;
+	typedef typename K::key_t key_t;
+	typedef BTree<T, K, C, A> self_t;
+
+	static const int NODE_SIZE = 256;
+	static const int MAX_HEIGHT = 32;
+	static const int LEAF_CAP =
+		(NODE_SIZE - 2 * sizeof(void *) - sizeof(int)) / sizeof(T) < 4 ? 4
+		: (NODE_SIZE - 2 * sizeof(void *) - sizeof(int)) / sizeof(T);
+	static const int INNER_CAP =
+		(NODE_SIZE - sizeof(void *) - sizeof(int)) / (sizeof(key_t) + sizeof(void *)) < 4 ? 4
+		: (NODE_SIZE - sizeof(void *) - sizeof(int)) / (sizeof(key_t) + sizeof(void *));
+	static const int LEAF_MIN = LEAF_CAP / 2;
+	static const int INNER_MIN = INNER_CAP / 2;
+
+private:
+
+	class Leaf {
+	public:
+		inline Leaf(void): cnt(0), prev(nullptr), next(nullptr) { }
+		int cnt;
+		Leaf *prev, *next;
+		T items[LEAF_CAP];
+	};
+
+	class Inner {
+	public:
+		inline Inner(void): cnt(0) { }
+		int cnt;
+		key_t keys[INNER_CAP];
+		void *child[INNER_CAP + 1];
+	};
+
+	class Path {
+	public:
+		inline Path(void): h(0) { }
+		inline void push(Inner *n, int i) { node[h] = n; idx[h] = i; h++; }
+		Inner *node[MAX_HEIGHT];
+		int idx[MAX_HEIGHT];
+		int h;
+	};
+
+public:
+
+	inline BTree(void): _root(nullptr), _first(nullptr), _last(nullptr), _height(0), _cnt(0) { }
+	inline BTree(const self_t& t): _root(nullptr), _first(nullptr), _last(nullptr), _height(0), _cnt(0)
+		{ copy(t); }
+	inline ~BTree(void) { clear(); }
+	inline const C& comparator() const { return *this; }
+	inline C& comparator() { return *this; }
+	inline const A& allocator() const { return *this; }
+	inline A& allocator() { return *this; }
+	inline int height(void) const { return _root ? _height + 1 : 0; }
+
+	// Collection concept
+	inline int count(void) const { return _cnt; }
+	inline bool isEmpty(void) const { return _cnt == 0; }
+	inline operator bool(void) const { return !isEmpty(); }
+
+	class Iter: public PreIterator<Iter, const T&> {
+		friend class BTree;
+	public:
+		inline Iter(void): l(nullptr), i(0) { }
+		inline Iter(const self_t& t): l(t._first), i(0) { }
+		inline bool ended(void) const { return l == nullptr; }
+		inline void next(void) { i++; if(i >= l->cnt) { l = l->next; i = 0; } }
+		inline const T& item(void) const { return l->items[i]; }
+		inline bool equals(const Iter& it) const { return l == it.l && i == it.i; }
+	protected:
+		inline T& data(void) const { return l->items[i]; }
+	private:
+		inline Iter(Leaf *leaf, int idx): l(leaf), i(idx)
+			{ if(l && i >= l->cnt) { l = l->next; i = 0; } }
+		Leaf *l;
+		int i;
+	};
+	inline Iter begin(void) const { return Iter(*this); }
+	inline Iter end(void) const { return Iter(); }
+
+	// look-up
+	inline const T *get(const key_t& key) const { return lookup(key); }
+	inline T *get(const key_t& key) { return lookup(key); }
+	inline bool hasKey(const key_t& key) const { return lookup(key) != nullptr; }
+	inline bool contains(const key_t& key) const { return lookup(key) != nullptr; }
+	template <class CC> inline bool containsAll(const CC& c) const
+		{ for(const auto& x: c) if(!contains(x)) return false; return true; }
+
+	bool equals(const self_t& t) const {
+		Iter ai(*this), bi(t);
+		for(; ai() && bi(); ai++, bi++)
+			if(compare(K::key(*ai), K::key(*bi)) != 0)
+				return false;
+		return !ai && !bi;
+	}
+	inline bool operator==(const self_t& t) const { return equals(t); }
+	inline bool operator!=(const self_t& t) const { return !equals(t); }
+
+	Iter lowerBound(const key_t& key) const {
+		if(!_root)
+			return Iter();
+		Leaf *l = findLeaf(key);
+		return Iter(l, lowerIndex(l, key));
+	}
+
+	Iter upperBound(const key_t& key) const {
+		if(!_root)
+			return Iter();
+		Leaf *l = findLeaf(key);
+		return Iter(l, upperIndex(l, key));
+	}
+
+	// modification
+	inline void add(const T& item) { bool added; insert(item, added); }
+	inline void set(const T& item) { bool added; T *p = insert(item, added); if(!added) *p = item; }
+	inline T *fetch(const T& item) { bool added; return insert(item, added); }
+	template <class CC> inline void addAll(const CC& c)
+		{ for(const auto& x: c) add(x); }
+	inline void remove(const T& x) { removeByKey(K::key(x)); }
+	template <class CC> inline void removeAll(const CC& c)
+		{ for(const auto& x: c) remove(x); }
+	inline void remove(const Iter& iter) { remove(iter.item()); }
+	inline self_t& operator+=(const T& x) { add(x); return *this; }
+	inline self_t& operator-=(const T& x) { remove(x); return *this; }
+
+	bool removeByKey(const key_t& key) {
+		if(!_root)
+			return false;
+		Path p;
+		Leaf *l = descend(key, p);
+		int i = lowerIndex(l, key);
+		if(i >= l->cnt || compare(K::key(l->items[i]), key) != 0)
+			return false;
+		array::relocate(l->items + i, l->items + i + 1, l->cnt - i - 1);
+		l->cnt--;
+		l->items[l->cnt] = T();
+		_cnt--;
+		if(p.h == 0) {
+			if(l->cnt == 0) {
+				deleteLeaf(l);
+				_root = nullptr;
+				_first = _last = nullptr;
+			}
+		}
+		else if(l->cnt < LEAF_MIN)
+			fixLeaf(l, p);
+		return true;
+	}
+
+	void clear(void) {
+		if(_root)
+			release(_root, _height);
+		_root = nullptr;
+		_first = _last = nullptr;
+		_height = 0;
+		_cnt = 0;
+	}
+
+	void copy(const self_t& t) {
+		if(&t == this)
+			return;
+		load(t);
+	}
+	inline self_t& operator=(const self_t& t) { copy(t); return *this; }
+
+	template <class CC> void load(const CC& c) {
+		clear();
+		int n = c.count();
+		if(n == 0)
+			return;
+
+		// build the leaves
+		int lc = (n + LEAF_CAP - 1) / LEAF_CAP, j = 0, m = n / lc + (n % lc > 0 ? 1 : 0);
+		Vector<void *> level(lc);
+		Vector<key_t> mins(lc);
+		Leaf *l = nullptr;
+		for(const auto& x: c) {
+			if(l == nullptr || l->cnt == m) {
+				Leaf *nl = newLeaf();
+				if(l == nullptr)
+					_first = nl;
+				else {
+					l->next = nl;
+					nl->prev = l;
+				}
+				l = nl;
+				level.add(l);
+				mins.add(K::key(x));
+				j++;
+				m = n / lc + (j <= n % lc ? 1 : 0);
+			}
+			else
+				ASSERTP(compare(K::key(l->items[l->cnt - 1]), K::key(x)) < 0, "BTree::load(): input not sorted");
+			l->items[l->cnt++] = x;
+		}
+		_last = l;
+		_cnt = n;
+
+		// build the inner levels
+		_height = 0;
+		while(level.count() > 1) {
+			int cnt = level.count(), g = (cnt + INNER_CAP) / (INNER_CAP + 1), k = 0;
+			Vector<void *> up(g);
+			Vector<key_t> upm(g);
+			for(int i = 0; i < g; i++) {
+				int s = cnt / g + (i < cnt % g ? 1 : 0);
+				Inner *in = newInner();
+				for(int q = 0; q < s; q++) {
+					in->child[q] = level[k + q];
+					if(q > 0)
+						in->keys[q - 1] = mins[k + q];
+				}
+				in->cnt = s - 1;
+				up.add(in);
+				upm.add(mins[k]);
+				k += s;
+			}
+			level = std::move(up);
+			mins = std::move(upm);
+			_height++;
+		}
+		_root = level[0];
+	}
+
+protected:
+
+	inline int compare(const key_t& k1, const key_t& k2) const { return C::doCompare(k1, k2); }
+
+	T *insert(const T& item, bool& added) {
+		const key_t& key = K::key(item);
+		added = false;
+
+		// empty tree
+		if(!_root) {
+			Leaf *l = newLeaf();
+			_root = _first = _last = l;
+			_height = 0;
+		}
+
+		// look for the leaf
+		Path p;
+		Leaf *l = descend(key, p);
+		int i = lowerIndex(l, key);
+		if(i < l->cnt && compare(K::key(l->items[i]), key) == 0)
+			return l->items + i;
+		added = true;
+		_cnt++;
+
+		// simple insertion
+		if(l->cnt < LEAF_CAP)
+			return insertAt(l, i, item);
+
+		// split the leaf
+		Leaf *r = newLeaf();
+		int h = (LEAF_CAP + 1) / 2;
+		array::relocate(r->items, l->items + h, LEAF_CAP - h);
+		r->cnt = LEAF_CAP - h;
+		l->cnt = h;
+		r->next = l->next;
+		r->prev = l;
+		if(l->next)
+			l->next->prev = r;
+		else
+			_last = r;
+		l->next = r;
+		T *res = i <= h ? insertAt(l, i, item) : insertAt(r, i - h, item);
+		propagate(p, K::key(r->items[0]), r);
+		return res;
+	}
+
+private:
+
+	inline Leaf *newLeaf(void) { return new(A::allocate(sizeof(Leaf))) Leaf(); }
+	inline void deleteLeaf(Leaf *l) { l->~Leaf(); A::free(l); }
+	inline Inner *newInner(void) { return new(A::allocate(sizeof(Inner))) Inner(); }
+	inline void deleteInner(Inner *n) { n->~Inner(); A::free(n); }
+
+	void release(void *n, int h) {
+		if(h == 0)
+			deleteLeaf(static_cast<Leaf *>(n));
+		else {
+			Inner *in = static_cast<Inner *>(n);
+			for(int i = 0; i <= in->cnt; i++)
+				release(in->child[i], h - 1);
+			deleteInner(in);
+		}
+	}
+
+	// binary search down to a small window scanned linearly (cheaper on wide nodes)
+	template <class P> static inline int search(int lo, int hi, P before) {
+		while(hi - lo > 16) {
+			int m = (lo + hi) >> 1;
+			if(before(m))
+				lo = m + 1;
+			else
+				hi = m;
+		}
+		while(lo < hi && before(lo))
+			lo++;
+		return lo;
+	}
+
+	inline int lowerIndex(const Leaf *l, const key_t& key) const
+		{ return search(0, l->cnt, [&](int i) { return compare(K::key(l->items[i]), key) < 0; }); }
+	inline int upperIndex(const Leaf *l, const key_t& key) const
+		{ return search(0, l->cnt, [&](int i) { return compare(key, K::key(l->items[i])) >= 0; }); }
+	inline int childIndex(const Inner *n, const key_t& key) const
+		{ return search(0, n->cnt, [&](int i) { return compare(key, n->keys[i]) >= 0; }); }
+
+	Leaf *findLeaf(const key_t& key) const {
+		void *n = _root;
+		for(int h = _height; h > 0; h--) {
+			Inner *in = static_cast<Inner *>(n);
+			n = in->child[childIndex(in, key)];
+		}
+		return static_cast<Leaf *>(n);
+	}
+
+	Leaf *descend(const key_t& key, Path& p) const {
+		void *n = _root;
+		for(int h = _height; h > 0; h--) {
+			Inner *in = static_cast<Inner *>(n);
+			int i = childIndex(in, key);
+			p.push(in, i);
+			n = in->child[i];
+		}
+		return static_cast<Leaf *>(n);
+	}
+
+	T *lookup(const key_t& key) const {
+		if(!_root)
+			return nullptr;
+		Leaf *l = findLeaf(key);
+		int i = lowerIndex(l, key);
+		if(i < l->cnt && compare(K::key(l->items[i]), key) == 0)
+			return l->items + i;
+		else
+			return nullptr;
+	}
+
+	T *insertAt(Leaf *l, int i, const T& item) {
+		array::relocate(l->items + i + 1, l->items + i, l->cnt - i);
+		l->items[i] = item;
+		l->cnt++;
+		return l->items + i;
+	}
+
+	void propagate(Path& p, key_t key, void *right) {
+		while(p.h > 0) {
+			p.h--;
+			Inner *n = p.node[p.h];
+			int i = p.idx[p.h];
+
+			// enough room
+			if(n->cnt < INNER_CAP) {
+				array::relocate(n->keys + i + 1, n->keys + i, n->cnt - i);
+				array::relocate(n->child + i + 2, n->child + i + 1, n->cnt - i);
+				n->keys[i] = key;
+				n->child[i + 1] = right;
+				n->cnt++;
+				return;
+			}
+
+			// split the node: build the full sequence, then distribute it
+			key_t tk[INNER_CAP + 1];
+			void *tc[INNER_CAP + 2];
+			array::relocate(tk, n->keys, i);
+			tk[i] = key;
+			array::relocate(tk + i + 1, n->keys + i, INNER_CAP - i);
+			array::copy(tc, n->child, i + 1);
+			tc[i + 1] = right;
+			array::copy(tc + i + 2, n->child + i + 1, INNER_CAP - i);
+			int mid = (INNER_CAP + 1) / 2;
+			Inner *r = newInner();
+			array::relocate(n->keys, tk, mid);
+			array::copy(n->child, tc, mid + 1);
+			n->cnt = mid;
+			array::relocate(r->keys, tk + mid + 1, INNER_CAP - mid);
+			array::copy(r->child, tc + mid + 1, INNER_CAP - mid + 1);
+			r->cnt = INNER_CAP - mid;
+			key = tk[mid];
+			right = r;
+		}
+
+		// new root
+		Inner *root = newInner();
+		root->cnt = 1;
+		root->keys[0] = key;
+		root->child[0] = _root;
+		root->child[1] = right;
+		_root = root;
+		_height++;
+	}
+
+	void unlink(Leaf *l) {
+		if(l->prev)
+			l->prev->next = l->next;
+		else
+			_first = l->next;
+		if(l->next)
+			l->next->prev = l->prev;
+		else
+			_last = l->prev;
+	}
+
+	void removeChild(Inner *n, int i) {
+		array::relocate(n->keys + i - 1, n->keys + i, n->cnt - i);
+		array::relocate(n->child + i, n->child + i + 1, n->cnt - i);
+		n->cnt--;
+	}
+
+	void fixLeaf(Leaf *l, Path& p) {
+		Inner *n = p.node[p.h - 1];
+		int i = p.idx[p.h - 1];
+
+		// borrow from left sibling
+		if(i > 0 && static_cast<Leaf *>(n->child[i - 1])->cnt > LEAF_MIN) {
+			Leaf *s = static_cast<Leaf *>(n->child[i - 1]);
+			array::relocate(l->items + 1, l->items, l->cnt);
+			l->items[0] = std::move(s->items[s->cnt - 1]);
+			s->cnt--;
+			l->cnt++;
+			n->keys[i - 1] = K::key(l->items[0]);
+			return;
+		}
+
+		// borrow from right sibling
+		if(i < n->cnt && static_cast<Leaf *>(n->child[i + 1])->cnt > LEAF_MIN) {
+			Leaf *s = static_cast<Leaf *>(n->child[i + 1]);
+			l->items[l->cnt++] = std::move(s->items[0]);
+			array::relocate(s->items, s->items + 1, s->cnt - 1);
+			s->cnt--;
+			n->keys[i] = K::key(s->items[0]);
+			return;
+		}
+
+		// merge with a sibling
+		if(i > 0) {
+			Leaf *s = static_cast<Leaf *>(n->child[i - 1]);
+			array::relocate(s->items + s->cnt, l->items, l->cnt);
+			s->cnt += l->cnt;
+			unlink(l);
+			deleteLeaf(l);
+			removeChild(n, i);
+		}
+		else {
+			Leaf *s = static_cast<Leaf *>(n->child[i + 1]);
+			array::relocate(l->items + l->cnt, s->items, s->cnt);
+			l->cnt += s->cnt;
+			unlink(s);
+			deleteLeaf(s);
+			removeChild(n, i + 1);
+		}
+		p.h--;
+		fixInner(n, p);
+	}
+
+	void fixInner(Inner *n, Path& p) {
+		while(true) {
+
+			// root case
+			if(p.h == 0) {
+				if(n->cnt == 0) {
+					_root = n->child[0];
+					_height--;
+					deleteInner(n);
+				}
+				return;
+			}
+			if(n->cnt >= INNER_MIN)
+				return;
+			Inner *q = p.node[p.h - 1];
+			int i = p.idx[p.h - 1];
+
+			// borrow from left sibling
+			if(i > 0 && static_cast<Inner *>(q->child[i - 1])->cnt > INNER_MIN) {
+				Inner *s = static_cast<Inner *>(q->child[i - 1]);
+				array::relocate(n->keys + 1, n->keys, n->cnt);
+				array::relocate(n->child + 1, n->child, n->cnt + 1);
+				n->keys[0] = q->keys[i - 1];
+				n->child[0] = s->child[s->cnt];
+				q->keys[i - 1] = s->keys[s->cnt - 1];
+				s->cnt--;
+				n->cnt++;
+				return;
+			}
+
+			// borrow from right sibling
+			if(i < q->cnt && static_cast<Inner *>(q->child[i + 1])->cnt > INNER_MIN) {
+				Inner *s = static_cast<Inner *>(q->child[i + 1]);
+				n->keys[n->cnt] = q->keys[i];
+				n->child[n->cnt + 1] = s->child[0];
+				n->cnt++;
+				q->keys[i] = s->keys[0];
+				array::relocate(s->keys, s->keys + 1, s->cnt - 1);
+				array::relocate(s->child, s->child + 1, s->cnt);
+				s->cnt--;
+				return;
+			}
+
+			// merge with a sibling
+			if(i > 0) {
+				Inner *s = static_cast<Inner *>(q->child[i - 1]);
+				merge(s, q->keys[i - 1], n);
+				removeChild(q, i);
+			}
+			else {
+				Inner *s = static_cast<Inner *>(q->child[i + 1]);
+				merge(n, q->keys[i], s);
+				removeChild(q, i + 1);
+			}
+			p.h--;
+			n = q;
+		}
+	}
+
+	void merge(Inner *l, const key_t& key, Inner *r) {
+		l->keys[l->cnt] = key;
+		array::relocate(l->keys + l->cnt + 1, r->keys, r->cnt);
+		array::copy(l->child + l->cnt + 1, r->child, r->cnt + 1);
+		l->cnt += r->cnt + 1;
+		deleteInner(r);
+	}
+
+	void *_root;
+	Leaf *_first, *_last;
+	int _height, _cnt;
+};
+
+}	// elm
+
+#endif /* ELM_DATA_BTREE_H_ */
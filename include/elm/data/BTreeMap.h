@@ -0,0 +1,138 @@
+/*
+ *	BTreeMap class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_DATA_BTREEMAP_H_
+#define ELM_DATA_BTREEMAP_H_
+
+#include "BTree.h"
+#include <elm/delegate.h>
+#include <elm/util/Option.h>
+#include <elm/data/util.h>
+
+namespace elm {
+
+template <class K, class T, class C = Comparator<K>, class E = Equiv<T>, class A = DefaultAlloc >
+class BTreeMap: public E {
+	typedef Pair<typename ti<K>::embed_t, typename ti<T>::embed_t> pair_t;
+	typedef BTree<pair_t, PairAdapter<K, T>, C, A > tree_t;
+
+public:
+	typedef BTreeMap<K, T, C, E, A> self_t;
+
+	inline const C& comparator() const { return tree.comparator(); }
+	inline C& comparator() { return tree.comparator(); }
+	inline const A& allocator() const { return tree.allocator(); }
+	inline A& allocator() { return tree.allocator(); }
+	inline const E& equivalence() const { return *this; }
+	inline E& equivalence() { return *this; }
+
+	// Collection concept
+	inline int count(void) const { return tree.count(); }
+	inline bool contains(const T& x) const
+		{ for(const auto& y: *this) if(E::isEqual(x, y)) return true; return false; }
+	template <class CC> bool containsAll(const CC& c) const
+		{ for(const auto& x: c) if(!contains(x)) return false; return true; }
+	inline bool isEmpty(void) const { return tree.isEmpty(); }
+	inline operator bool() const { return !isEmpty(); }
+
+	class Iter: public PreIterator<Iter, T> {
+		friend class BTreeMap;
+	public:
+		inline Iter() { }
+		inline Iter(const self_t& t): i(t.tree) { }
+		inline bool ended() const { return i.ended(); }
+		inline const T& item() const { return i.item().snd; }
+		inline const K& key() const { return i.item().fst; }
+		inline void next() { i.next(); }
+		inline bool equals(const Iter& ii) const { return i.equals(ii.i); }
+	private:
+		inline Iter(const typename tree_t::Iter& ii): i(ii) { }
+		typename tree_t::Iter i;
+	};
+	inline Iter begin() const { return Iter(*this); }
+	inline Iter end() const { return Iter(); }
+
+	bool equals(const self_t& map) const {
+		typename tree_t::Iter i(tree), j(map.tree);
+		for(; i() && j(); i++, j++)
+			if(tree.comparator().doCompare((*i).fst, (*j).fst) != 0 || !E::isEqual((*i).snd, (*j).snd))
+				return false;
+		return !i && !j;
+	}
+	inline bool operator==(const self_t& map) const { return equals(map); }
+	inline bool operator!=(const self_t& map) const { return !equals(map); }
+
+	// Map concept
+	inline Option<T> get(const K& key) const
+		{ const pair_t *p = tree.get(key); if(!p) return none; else return some(p->snd); }
+	inline const T& get(const K& key, const T& def) const
+		{ const pair_t *p = tree.get(key); if(!p) return def; else return p->snd; }
+	inline bool hasKey(const K& key) const
+		{ return tree.hasKey(key); }
+	inline const T& operator[](const K& k) const
+		{ const pair_t *r = tree.get(k); if(r == nullptr) throw KeyException(); return r->snd; }
+
+	class KeyIter: public PreIterator<KeyIter, K> {
+		friend class BTreeMap;
+	public:
+		inline KeyIter() { }
+		inline KeyIter(const self_t& map): it(map.tree) { }
+		inline bool ended(void) const { return it.ended(); }
+		inline void next(void) { it.next(); }
+		inline const K& item(void) const { return it.item().fst; }
+		inline bool equals(const KeyIter& i) const { return it.equals(i.it); }
+	private:
+		inline KeyIter(const typename tree_t::Iter& i): it(i) { }
+		typename tree_t::Iter it;
+	};
+	inline Iterable<KeyIter> keys() const { return subiter(KeyIter(*this), KeyIter()); }
+
+	class PairIter: public tree_t::Iter {
+	public:
+		inline PairIter() { }
+		inline PairIter(const self_t& map): tree_t::Iter(map.tree) { }
+		inline PairIter(const typename tree_t::Iter& i): tree_t::Iter(i) { }
+	};
+	inline Iterable<PairIter> pairs() const { return subiter(PairIter(*this), PairIter()); }
+
+	// ordered access
+	inline Iter lowerBound(const K& key) const { return Iter(tree.lowerBound(key)); }
+	inline Iter upperBound(const K& key) const { return Iter(tree.upperBound(key)); }
+	inline Iterable<PairIter> range(const K& lo, const K& hi) const
+		{ PairIter b(tree.lowerBound(lo)); return subiter(b, tree.comparator().doCompare(hi, lo) < 0 ? b : PairIter(tree.lowerBound(hi))); }
+
+	// MutableMap concept
+	inline void put(const K &key, const T &value) { tree.set(pair_t(key, value)); }
+	inline void remove(const K &key) { tree.removeByKey(key); }
+	inline void remove(const Iter &i) { tree.removeByKey(i.key()); }
+
+	///
+	inline void clear(void) { tree.clear(); }
+	inline void copy(const self_t& map) { tree.copy(map.tree); }
+	inline self_t& operator=(const self_t& map) { copy(map); return *this; }
+	template <class CC> inline void load(const CC& pairs) { tree.load(pairs); }
+
+private:
+	tree_t tree;
+};
+
+}	// elm
+
+#endif /* ELM_DATA_BTREEMAP_H_ */
@@ -0,0 +1,82 @@
+/*
+ *	BTreeSet class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_DATA_BTREESET_H_
+#define ELM_DATA_BTREESET_H_
+
+#include "BTree.h"
+#include <elm/data/util.h>
+
+namespace elm {
+
+template <class T, class C = Comparator<T>, class A = DefaultAlloc >
+class BTreeSet: public BTree<T, IdAdapter<T>, C, A> {
+public:
+	typedef T t;
+	typedef BTreeSet<T, C, A> self_t;
+	typedef BTree<T, IdAdapter<T>, C, A> base_t;
+	typedef typename base_t::Iter Iter;
+
+	// MutableCollection concept
+	inline self_t& operator+=(const T& x) { insert(x); return *this; }
+	inline self_t& operator-=(const T& x) { base_t::remove(x); return *this; }
+	inline self_t& operator=(const self_t& s) { base_t::copy(s); return *this; }
+
+	// Set concept
+	inline void insert(const T& x) { base_t::add(x); }
+
+	bool subsetOf(const self_t& s) const {
+		auto i = base_t::begin(); auto j = s.begin();
+		while(i() && j()) {
+			int c = C::doCompare(*i, *j);
+			if(c == 0) i++;
+			else if(c < 0) return false;
+			j++;
+		}
+		return !i();
+	}
+
+	inline void join(const self_t& s) { for(const auto& x: s) base_t::add(x); }
+	inline void diff(const self_t& s) { for(const auto& x: s) base_t::remove(x); }
+	void meet(const self_t& s) {
+		Vector<T> is;
+		for(const auto& x: *this) if(s.contains(x)) is.add(x);
+		base_t::load(is);
+	}
+	inline self_t& operator+=(const self_t& s) { join(s); return *this; }
+	inline self_t& operator|=(const self_t& s) { join(s); return *this; }
+	inline self_t& operator-=(const self_t& s) { diff(s); return *this; }
+	inline self_t& operator&=(const self_t& s) { meet(s); return *this; }
+	inline self_t& operator*=(const self_t& s) { meet(s); return *this; }
+
+	inline self_t operator+(const self_t& s) const { self_t r(*this); r.join(s); return r; }
+	inline self_t operator|(const self_t& s) const { self_t r(*this); r.join(s); return r; }
+	inline self_t operator-(const self_t& s) const { self_t r(*this); r.diff(s); return r; }
+	inline self_t operator*(const self_t& s) const { self_t r(*this); r.meet(s); return r; }
+	inline self_t operator&(const self_t& s) const { self_t r(*this); r.meet(s); return r; }
+
+	// ordered access
+	inline Iterable<Iter> range(const T& lo, const T& hi) const
+		{ Iter b = base_t::lowerBound(lo); return subiter(b, C::doCompare(hi, lo) < 0 ? b : base_t::lowerBound(hi)); }
+};
+
+}	// elm
+
+#endif /* ELM_DATA_BTREESET_H_ */
@@ -0,0 +1,137 @@
+/*
+ *	ConcurrentHashMap class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_DATA_CONCURRENTHASHMAP_H_
+#define ELM_DATA_CONCURRENTHASHMAP_H_
+
+#include "HashMap.h"
+#include <elm/sys/Thread.h>
+
+namespace elm {
+
+template <class K, class T, class H = HashKey<K>, class A = DefaultAlloc, class E = Equiv<T> >
+class ConcurrentHashMap: public H {
+	typedef HashMap<K, T, H, A, E> map_t;
+
+	class Shard {
+	public:
+		inline Shard(void): mutex(sys::Mutex::make()), map(1) { }
+		inline ~Shard(void) { delete mutex; }
+		sys::Mutex *mutex;
+		map_t map;
+	};
+
+public:
+	typedef K key_t;
+	typedef T val_t;
+	typedef ConcurrentHashMap<K, T, H, A, E> self_t;
+	static const int DEFAULT_SHARDS = 64;
+
+	ConcurrentHashMap(int shards = DEFAULT_SHARDS, int capacity = 0): _cnt(1) {
+		while(_cnt < shards)
+			_cnt <<= 1;
+		_shards = new Shard[_cnt];
+		if(capacity > 0)
+			for(int i = 0; i < _cnt; i++)
+				_shards[i].map.reserve(capacity / _cnt + 1);
+	}
+	~ConcurrentHashMap(void) { delete [] _shards; }
+	inline int shardCount(void) const { return _cnt; }
+	inline const H& hash() const { return *this; }
+	inline H& hash() { return *this; }
+
+	// Map concept (values are returned by copy)
+	inline Option<T> get(const K& k) const
+		{ Shard& s = shard(k); sys::MutexGuard g(s.mutex); return s.map.get(k); }
+	inline T get(const K& k, const T& def) const
+		{ Shard& s = shard(k); sys::MutexGuard g(s.mutex); return s.map.get(k, def); }
+	inline bool hasKey(const K& k) const
+		{ Shard& s = shard(k); sys::MutexGuard g(s.mutex); return s.map.hasKey(k); }
+
+	// Collection concept (not atomic over the whole map)
+	int count(void) const
+		{ int c = 0; for(int i = 0; i < _cnt; i++) { sys::MutexGuard g(_shards[i].mutex); c += _shards[i].map.count(); } return c; }
+	bool isEmpty(void) const
+		{ for(int i = 0; i < _cnt; i++) { sys::MutexGuard g(_shards[i].mutex); if(!_shards[i].map.isEmpty()) return false; } return true; }
+	inline operator bool(void) const { return !isEmpty(); }
+	template <class F> void forEach(F f) const
+		{ for(int i = 0; i < _cnt; i++) { sys::MutexGuard g(_shards[i].mutex); for(auto p: _shards[i].map.pairs()) f(p.fst, p.snd); } }
+
+	// MutableMap concept
+	inline void put(const K& k, const T& v)
+		{ Shard& s = shard(k); sys::MutexGuard g(s.mutex); s.map.put(k, v); }
+	inline void remove(const K& k)
+		{ Shard& s = shard(k); sys::MutexGuard g(s.mutex); s.map.remove(k); }
+	void clear(void)
+		{ for(int i = 0; i < _cnt; i++) { sys::MutexGuard g(_shards[i].mutex); _shards[i].map.clear(); } }
+
+	// atomic operations
+	bool putIfAbsent(const K& k, const T& v) {
+		Shard& s = shard(k);
+		sys::MutexGuard g(s.mutex);
+		if(s.map.hasKey(k))
+			return false;
+		s.map.add(k, v);
+		return true;
+	}
+
+	template <class F> T computeIfAbsent(const K& k, F f) {
+		Shard& s = shard(k);
+		sys::MutexGuard g(s.mutex);
+		Option<T> r = s.map.get(k);
+		if(r)
+			return *r;
+		T v = f(k);
+		s.map.add(k, v);
+		return v;
+	}
+
+	template <class F> T fetch(const K& k, F f) {
+		Shard& s = shard(k);
+		sys::MutexGuard g(s.mutex);
+		T& v = s.map.fetch(k);
+		f(v);
+		return v;
+	}
+
+	bool removeIf(const K& k, const T& v) {
+		Shard& s = shard(k);
+		sys::MutexGuard g(s.mutex);
+		Option<T> r = s.map.get(k);
+		if(!r || !s.map.equivalence().isEqual(*r, v))
+			return false;
+		s.map.remove(k);
+		return true;
+	}
+
+private:
+	inline Shard& shard(const K& k) const
+		{ return _shards[(hash_mix(H::computeHash(k)) >> 40) & (_cnt - 1)]; }
+
+	ConcurrentHashMap(const self_t&);
+	self_t& operator=(const self_t&);
+
+	int _cnt;
+	Shard *_shards;
+};
+
+}	// elm
+
+#endif /* ELM_DATA_CONCURRENTHASHMAP_H_ */
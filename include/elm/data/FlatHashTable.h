@@ -0,0 +1,277 @@
+/*
+ *	FlatHashTable class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_DATA_FLATHASHTABLE_H_
+#define ELM_DATA_FLATHASHTABLE_H_
+
+#include "custom.h"
+#include <elm/array.h>
+#include <elm/hash.h>
+#include <elm/int.h>
+#include <elm/PreIterator.h>
+#include <utility>
+#ifdef __SSE2__
+#	include <emmintrin.h>
+#endif
+
+namespace elm {
+
+namespace flat {
+
+typedef t::int8 ctrl_t;
+const ctrl_t EMPTY = -128;
+const ctrl_t DELETED = -2;
+const int GROUP = 16;
+
+class Group {
+public:
+#	ifdef __SSE2__
+		inline Group(const ctrl_t *p): g(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))) { }
+		inline t::uint32 match(ctrl_t h) const
+			{ return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h), g)); }
+		inline t::uint32 matchEmpty() const { return match(EMPTY); }
+		inline t::uint32 matchFree() const
+			{ return _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), g)); }
+	private:
+		__m128i g;
+#	else
+		inline Group(const ctrl_t *p): g(p) { }
+		inline t::uint32 match(ctrl_t h) const
+			{ t::uint32 m = 0; for(int i = 0; i < GROUP; i++) if(g[i] == h) m |= 1 << i; return m; }
+		inline t::uint32 matchEmpty() const { return match(EMPTY); }
+		inline t::uint32 matchFree() const
+			{ t::uint32 m = 0; for(int i = 0; i < GROUP; i++) if(g[i] < -1) m |= 1 << i; return m; }
+	private:
+		const ctrl_t *g;
+#	endif
+};
+
+}	// flat
+
+template <class T, class H = HashKey<T>, class A = DefaultAlloc >
+class FlatHashTable: public H, public A {
+public:
+	typedef FlatHashTable<T, H, A> self_t;
+	static const int MIN_SIZE = flat::GROUP;
+
+protected:
+	int find(const T& key) const {
+		t::uint64 h = hash_mix(H::computeHash(key));
+		flat::ctrl_t h2 = flat::ctrl_t(h & 0x7f);
+		int pos = int(h >> 7) & _mask;
+		for(int step = flat::GROUP; ; step += flat::GROUP) {
+			flat::Group g(_ctrl + pos);
+			for(t::uint32 m = g.match(h2); m; m &= m - 1) {
+				int i = (pos + lsb(m)) & _mask;
+				if(H::isEqual(_slots[i], key))
+					return i;
+			}
+			if(g.matchEmpty())
+				return -1;
+			pos = (pos + step) & _mask;
+		}
+	}
+
+private:
+
+	int findFree(t::uint64 h) const {
+		int pos = int(h >> 7) & _mask;
+		for(int step = flat::GROUP; ; step += flat::GROUP) {
+			t::uint32 m = flat::Group(_ctrl + pos).matchFree();
+			if(m)
+				return (pos + lsb(m)) & _mask;
+			pos = (pos + step) & _mask;
+		}
+	}
+
+	inline void setCtrl(int i, flat::ctrl_t c)
+		{ _ctrl[i] = c; if(i < flat::GROUP) _ctrl[_size + i] = c; }
+
+	T *make(const T& data) {
+		if(_cnt + _dels >= _limit)
+			resize(t::int64(_cnt) * 32 <= t::int64(_size) * 25 ? _size : _size << 1);
+		t::uint64 h = hash_mix(H::computeHash(data));
+		int i = findFree(h);
+		if(_ctrl[i] == flat::DELETED)
+			_dels--;
+		setCtrl(i, flat::ctrl_t(h & 0x7f));
+		_cnt++;
+		return new((void *)(_slots + i)) T(data);
+	}
+
+	static int roundSize(int n) {
+		int s = MIN_SIZE;
+		while(s - s / 8 <= n)
+			s <<= 1;
+		return s;
+	}
+
+	void alloc(int size) {
+		_size = size;
+		_mask = size - 1;
+		_limit = size - size / 8;
+		_slots = static_cast<T *>(A::allocate(size * sizeof(T) + size + flat::GROUP));
+		_ctrl = reinterpret_cast<flat::ctrl_t *>(_slots + size);
+		::memset(_ctrl, flat::EMPTY, size + flat::GROUP);
+	}
+
+	void release(void) {
+		for(int i = 0; i < _size; i++)
+			if(_ctrl[i] >= 0)
+				_slots[i].~T();
+		A::free(_slots);
+	}
+
+	void resize(int size) {
+		T *oslots = _slots;
+		flat::ctrl_t *octrl = _ctrl;
+		int osize = _size;
+		alloc(size);
+		for(int i = 0; i < osize; i++)
+			if(octrl[i] >= 0) {
+				t::uint64 h = hash_mix(H::computeHash(oslots[i]));
+				int j = findFree(h);
+				setCtrl(j, flat::ctrl_t(h & 0x7f));
+				new((void *)(_slots + j)) T(std::move(oslots[i]));
+				oslots[i].~T();
+			}
+		_dels = 0;
+		A::free(oslots);
+	}
+
+	void erase(int i) {
+		_slots[i].~T();
+		setCtrl(i, flat::DELETED);
+		_cnt--;
+		_dels++;
+	}
+
+	struct InternIterator {
+		friend class FlatHashTable;
+		inline InternIterator(const self_t& _htab): htab(&_htab), i(0) { step(); }
+		inline InternIterator(const self_t& _htab, bool end): htab(&_htab)
+			{ if(end) i = htab->_size; else { i = 0; step(); } }
+		inline bool ended(void) const { return i >= htab->_size; }
+		inline void next(void) { i++; step(); }
+		inline bool equals(const InternIterator& it) const { return i == it.i && htab == it.htab; }
+	protected:
+		inline T& data(void) const { return htab->_slots[i]; }
+	private:
+		inline void step(void) { while(i < htab->_size && htab->_ctrl[i] < 0) i++; }
+		const self_t *htab;
+		int i;
+	};
+
+public:
+
+	FlatHashTable(int size = 0): _cnt(0), _dels(0)
+		{ alloc(roundSize(size)); }
+	FlatHashTable(const self_t& h): _cnt(0), _dels(0)
+		{ alloc(h._size); putAll(h); }
+	~FlatHashTable(void)
+		{ release(); }
+	inline const H& hash() const { return *this; }
+	inline H& hash() { return *this; }
+	inline const A& allocator() const { return *this; }
+	inline A& allocator() { return *this; }
+
+	inline const T *get(const T& key) const
+		{ int i = find(key); return i >= 0 ? _slots + i : nullptr; }
+	inline T *get(const T& key)
+		{ int i = find(key); return i >= 0 ? _slots + i : nullptr; }
+	inline bool hasKey(const T& key) const { return find(key) >= 0; }
+	inline bool exists(const T& key) const { return hasKey(key); }
+
+	void put(const T& data)
+		{ int i = find(data); if(i >= 0) _slots[i] = data; else add(data); }
+	template <class CC> void putAll(const CC& c)
+		{ for(const auto& x: c) put(x); }
+	void reserve(int n)
+		{ if(n >= _limit) resize(roundSize(n)); }
+
+	// Collection concept
+	inline bool isEmpty(void) const { return _cnt == 0; }
+	operator bool() const { return !isEmpty(); }
+	inline int count(void) const { return _cnt; }
+	inline bool contains(const T& x) const { return find(x) >= 0; }
+	template <class CC> bool containsAll(const CC& c) const
+		{ for(const auto& x: c) if(!contains(x)) return false; return true; }
+
+	class Iter: public InternIterator, public InplacePreIterator<Iter, T> {
+	public:
+		inline Iter(const self_t& htab): InternIterator(htab) { };
+		inline Iter(const self_t& htab, bool end): InternIterator(htab, end) { };
+		inline const T& item(void) const { return this->data(); }
+	};
+	inline Iter begin() const { return Iter(*this); }
+	inline Iter end() const { return Iter(*this, true); }
+
+	inline bool equals(const self_t& h) const
+		{ return _cnt == h._cnt && containsAll(h); }
+	inline bool operator==(const self_t& t) const { return equals(t); }
+	inline bool operator!=(const self_t& t) const { return !equals(t); }
+
+	// MutableCollection concept
+	void clear(void) {
+		for(int i = 0; i < _size; i++)
+			if(_ctrl[i] >= 0)
+				_slots[i].~T();
+		::memset(_ctrl, flat::EMPTY, _size + flat::GROUP);
+		_cnt = 0;
+		_dels = 0;
+	}
+
+	T *add(const T& data) { return make(data); }
+	inline self_t& operator+=(const T& x) { add(x); return *this; }
+	template <class C> void addAll(const C& c)
+		{ for(const auto& x: c) add(x); }
+
+	void remove(const T& key)
+		{ int i = find(key); if(i >= 0) erase(i); }
+	template <class C> void removeAll(const C& c)
+		{ for(const auto& x: c) remove(x); }
+	inline self_t& operator-=(const T& x) { remove(x); return *this; }
+	void remove(const Iter& i) { erase(i.i); }
+
+	void copy(const self_t& t) {
+		if(&t == this)
+			return;
+		release();
+		alloc(t._size);
+		::memcpy(_ctrl, t._ctrl, _size + flat::GROUP);
+		for(int i = 0; i < _size; i++)
+			if(_ctrl[i] >= 0)
+				new((void *)(_slots + i)) T(t._slots[i]);
+		_cnt = t._cnt;
+		_dels = t._dels;
+	}
+	inline self_t& operator=(const self_t& c) { copy(c); return *this; }
+
+	inline int size(void) const { return _size; }
+
+private:
+	T *_slots;
+	flat::ctrl_t *_ctrl;
+	int _size, _mask, _cnt, _dels, _limit;
+};
+
+}	// elm
+
+#endif /* ELM_DATA_FLATHASHTABLE_H_ */
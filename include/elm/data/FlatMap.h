@@ -0,0 +1,144 @@
+/*
+ *	FlatMap class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_DATA_FLATMAP_H_
+#define ELM_DATA_FLATMAP_H_
+
+#include "FlatTable.h"
+#include <elm/delegate.h>
+#include <elm/util/Option.h>
+#include <elm/data/util.h>
+
+namespace elm {
+
+template <class K, class T, class C = Comparator<K>, class E = Equiv<T>, class A = DefaultAlloc >
+class FlatMap: public E {
+	typedef Pair<typename ti<K>::embed_t, typename ti<T>::embed_t> pair_t;
+	typedef FlatTable<pair_t, PairAdapter<K, T>, C, A > table_t;
+
+public:
+	typedef FlatMap<K, T, C, E, A> self_t;
+
+	inline FlatMap(const C& c = C()): tab(c) { }
+	inline const C& comparator() const { return tab.comparator(); }
+	inline C& comparator() { return tab.comparator(); }
+	inline const A& allocator() const { return tab.allocator(); }
+	inline A& allocator() { return tab.allocator(); }
+	inline const E& equivalence() const { return *this; }
+	inline E& equivalence() { return *this; }
+
+	// Collection concept
+	inline int count(void) const { return tab.count(); }
+	inline bool contains(const T& x) const
+		{ for(const auto& y: *this) if(E::isEqual(x, y)) return true; return false; }
+	template <class CC> bool containsAll(const CC& c) const
+		{ for(const auto& x: c) if(!contains(x)) return false; return true; }
+	inline bool isEmpty(void) const { return tab.isEmpty(); }
+	inline operator bool() const { return !isEmpty(); }
+
+	class Iter: public PreIterator<Iter, T> {
+		friend class FlatMap;
+	public:
+		inline Iter() { }
+		inline Iter(const self_t& m): i(m.tab) { }
+		inline bool ended() const { return i.ended(); }
+		inline const T& item() const { return i.item().snd; }
+		inline const K& key() const { return i.item().fst; }
+		inline void next() { i.next(); }
+		inline bool equals(const Iter& ii) const { return i.equals(ii.i); }
+	private:
+		inline Iter(const typename table_t::Iter& ii): i(ii) { }
+		typename table_t::Iter i;
+	};
+	inline Iter begin() const { return Iter(*this); }
+	inline Iter end() const { return Iter(); }
+
+	bool equals(const self_t& map) const {
+		if(count() != map.count())
+			return false;
+		for(int i = 0; i < count(); i++)
+			if(tab.comparator().doCompare(tab.at(i).fst, map.tab.at(i).fst) != 0
+			|| !E::isEqual(tab.at(i).snd, map.tab.at(i).snd))
+				return false;
+		return true;
+	}
+	inline bool operator==(const self_t& map) const { return equals(map); }
+	inline bool operator!=(const self_t& map) const { return !equals(map); }
+
+	// Map concept
+	inline Option<T> get(const K& key) const
+		{ const pair_t *p = tab.get(key); if(!p) return none; else return some(p->snd); }
+	inline const T& get(const K& key, const T& def) const
+		{ const pair_t *p = tab.get(key); if(!p) return def; else return p->snd; }
+	inline bool hasKey(const K& key) const
+		{ return tab.hasKey(key); }
+	inline const T& operator[](const K& k) const
+		{ const pair_t *r = tab.get(k); if(r == nullptr) throw KeyException(); return r->snd; }
+
+	class KeyIter: public PreIterator<KeyIter, K> {
+		friend class FlatMap;
+	public:
+		inline KeyIter() { }
+		inline KeyIter(const self_t& map): it(map.tab) { }
+		inline bool ended(void) const { return it.ended(); }
+		inline void next(void) { it.next(); }
+		inline const K& item(void) const { return it.item().fst; }
+		inline bool equals(const KeyIter& i) const { return it.equals(i.it); }
+	private:
+		typename table_t::Iter it;
+	};
+	inline Iterable<KeyIter> keys() const { return subiter(KeyIter(*this), KeyIter()); }
+
+	class PairIter: public table_t::Iter {
+	public:
+		inline PairIter() { }
+		inline PairIter(const self_t& map): table_t::Iter(map.tab) { }
+		inline PairIter(const typename table_t::Iter& i): table_t::Iter(i) { }
+	};
+	inline Iterable<PairIter> pairs() const { return subiter(PairIter(*this), PairIter()); }
+
+	// ordered access
+	inline Iter lowerBound(const K& key) const { return Iter(tab.lowerBound(key)); }
+	inline Iter upperBound(const K& key) const { return Iter(tab.upperBound(key)); }
+	inline Iterable<PairIter> range(const K& lo, const K& hi) const {
+		PairIter b(tab.lowerBound(lo));
+		return subiter(b, tab.comparator().doCompare(hi, lo) < 0 ? b : PairIter(tab.lowerBound(hi)));
+	}
+
+	// MutableMap concept
+	inline void put(const K &key, const T &value) { tab.set(pair_t(key, value)); }
+	inline void remove(const K &key) { tab.removeByKey(key); }
+	inline void remove(const Iter &i) { tab.remove(i.i); }
+	inline T& fetch(const K& key) { return tab.fetch(pair_t(key, T()))->snd; }
+
+	///
+	inline void clear(void) { tab.clear(); }
+	inline void copy(const self_t& map) { tab.copy(map.tab); }
+	inline self_t& operator=(const self_t& map) { copy(map); return *this; }
+	inline void reserve(int n) { tab.reserve(n); }
+	template <class CC> inline void load(const CC& pairs) { tab.load(pairs); }
+
+private:
+	table_t tab;
+};
+
+}	// elm
+
+#endif /* ELM_DATA_FLATMAP_H_ */
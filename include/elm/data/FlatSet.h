@@ -0,0 +1,113 @@
+/*
+ *	FlatSet class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_DATA_FLATSET_H_
+#define ELM_DATA_FLATSET_H_
+
+#include "FlatTable.h"
+#include <elm/data/util.h>
+
+namespace elm {
+
+template <class T, class C = Comparator<T>, class A = DefaultAlloc >
+class FlatSet: public FlatTable<T, IdAdapter<T>, C, A> {
+public:
+	typedef FlatTable<T, IdAdapter<T>, C, A> base_t;
+	typedef FlatSet<T, C, A> self_t;
+	typedef typename base_t::Iter Iter;
+
+	inline FlatSet(const C& c = C()): base_t(c) { }
+
+	// Collection concept
+	inline bool contains(const T& x) const { return base_t::hasKey(x); }
+	template <class CC> inline bool containsAll(const CC& c) const
+		{ for(const auto& x: c) if(!contains(x)) return false; return true; }
+	inline bool operator==(const self_t& s) const { return base_t::equals(s); }
+	inline bool operator!=(const self_t& s) const { return !base_t::equals(s); }
+
+	// MutableCollection concept
+	template <class CC> inline void removeAll(const CC& c) { for(const auto& x: c) base_t::remove(x); }
+	inline self_t& operator+=(const T& x) { insert(x); return *this; }
+	inline self_t& operator-=(const T& x) { base_t::remove(x); return *this; }
+	inline self_t& operator=(const self_t& s) { base_t::copy(s); return *this; }
+
+	// Set concept
+	inline void insert(const T& x) { base_t::add(x); }
+
+	bool subsetOf(const self_t& s) const {
+		int i = 0, j = 0;
+		while(i < base_t::count() && j < s.count()) {
+			int c = C::doCompare(base_t::at(i), s.at(j));
+			if(c < 0) return false;
+			if(c == 0) i++;
+			j++;
+		}
+		return i == base_t::count();
+	}
+	inline bool operator<=(const self_t& s) const { return subsetOf(s); }
+	inline bool operator<(const self_t& s) const { return subsetOf(s) && base_t::count() != s.count(); }
+	inline bool operator>=(const self_t& s) const { return s.subsetOf(*this); }
+	inline bool operator>(const self_t& s) const { return s.subsetOf(*this) && base_t::count() != s.count(); }
+
+	inline void join(const self_t& s) { merge(s, true, true, true); }
+	inline void diff(const self_t& s) { merge(s, true, false, false); }
+	inline void meet(const self_t& s) { merge(s, false, true, false); }
+	inline self_t& operator+=(const self_t& s) { join(s); return *this; }
+	inline self_t& operator|=(const self_t& s) { join(s); return *this; }
+	inline self_t& operator-=(const self_t& s) { diff(s); return *this; }
+	inline self_t& operator&=(const self_t& s) { meet(s); return *this; }
+	inline self_t& operator*=(const self_t& s) { meet(s); return *this; }
+
+	inline self_t operator+(const self_t& s) const { self_t r(*this); r.join(s); return r; }
+	inline self_t operator|(const self_t& s) const { self_t r(*this); r.join(s); return r; }
+	inline self_t operator-(const self_t& s) const { self_t r(*this); r.diff(s); return r; }
+	inline self_t operator*(const self_t& s) const { self_t r(*this); r.meet(s); return r; }
+	inline self_t operator&(const self_t& s) const { self_t r(*this); r.meet(s); return r; }
+
+	// ordered access
+	inline Iterable<Iter> range(const T& lo, const T& hi) const {
+		Iter b = base_t::lowerBound(lo);
+		return subiter(b, C::doCompare(hi, lo) < 0 ? b : base_t::lowerBound(hi));
+	}
+
+private:
+
+	// linear merge of sorted arrays: keep items only in this (left), in both (both) or only in s (right)
+	void merge(const self_t& s, bool left, bool both, bool right) {
+		typename base_t::vector_t v;
+		v.grow(base_t::count() + s.count());
+		int i = 0, j = 0;
+		while(i < base_t::count() && j < s.count()) {
+			int c = C::doCompare(base_t::at(i), s.at(j));
+			if(c < 0) { if(left) v.add(base_t::at(i)); i++; }
+			else if(c > 0) { if(right) v.add(s.at(j)); j++; }
+			else { if(both) v.add(base_t::at(i)); i++; j++; }
+		}
+		for(; left && i < base_t::count(); i++)
+			v.add(base_t::at(i));
+		for(; right && j < s.count(); j++)
+			v.add(s.at(j));
+		base_t::items() = std::move(v);
+	}
+};
+
+}	// elm
+
+#endif /* ELM_DATA_FLATSET_H_ */
@@ -0,0 +1,188 @@
+/*
+ *	FlatTable class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_DATA_FLATTABLE_H_
+#define ELM_DATA_FLATTABLE_H_
+
+#include "Adapter.h"
+#include "custom.h"
+#include "quicksort.h"
+#include "Vector.h"
+#include <elm/compare.h>
+#include <utility>
+
+namespace elm {
+
+template <class T, class K = IdAdapter<T>, class C = Comparator<typename K::key_t>, class A = DefaultAlloc>
+class FlatTable: public C {
+public:
+	typedef T t;
+	typedef typename K::key_t key_t;
+	typedef FlatTable<T, K, C, A> self_t;
+	static const int MERGE_THRESHOLD = 16;
+
+	inline FlatTable(const C& c = C()): C(c) { }
+	inline FlatTable(const self_t& t): C(t), _items(t._items) { }
+	inline const C& comparator() const { return *this; }
+	inline C& comparator() { return *this; }
+	inline const A& allocator() const { return _items.allocator(); }
+	inline A& allocator() { return _items.allocator(); }
+
+	// Collection concept
+	inline int count(void) const { return _items.count(); }
+	inline bool isEmpty(void) const { return _items.isEmpty(); }
+	inline operator bool(void) const { return !isEmpty(); }
+
+	class Iter: public ConstPreIter<Iter, T>, public elm::PreIter<Iter, T> {
+		friend class FlatTable;
+	public:
+		inline Iter(void): _t(nullptr), i(0) { }
+		inline Iter(const self_t& t, int idx = 0): _t(&t), i(idx) { }
+		inline bool ended(void) const { return _t == nullptr || i >= _t->count(); }
+		inline void next(void) { i++; }
+		inline int index(void) const { return i; }
+		inline const T& item(void) const { return _t->_items[i]; }
+		inline bool equals(const Iter& it) const { return ended() ? it.ended() : _t == it._t && i == it.i; }
+	private:
+		const self_t *_t;
+		int i;
+	};
+	inline Iter begin(void) const { return Iter(*this); }
+	inline Iter end(void) const { return Iter(*this, count()); }
+
+	bool equals(const self_t& t) const {
+		if(count() != t.count())
+			return false;
+		for(int i = 0; i < count(); i++)
+			if(compare(K::key(_items[i]), K::key(t._items[i])) != 0)
+				return false;
+		return true;
+	}
+
+	// lookup
+	inline const T *get(const key_t& key) const { int i = find(key); return i < 0 ? nullptr : &_items[i]; }
+	inline T *get(const key_t& key) { int i = find(key); return i < 0 ? nullptr : &_items[i]; }
+	inline bool hasKey(const key_t& key) const { return find(key) >= 0; }
+	inline Iter lowerBound(const key_t& key) const { return Iter(*this, lowerIndex(key)); }
+	inline Iter upperBound(const key_t& key) const { return Iter(*this, upperIndex(key)); }
+	inline const T& at(int i) const { return _items[i]; }
+	inline T& at(int i) { return _items[i]; }
+
+	// modification
+	inline void clear(void) { _items.clear(); }
+	inline void copy(const self_t& t) { C::operator=(t); _items.copy(t._items); }
+	inline void reserve(int n) { if(n > _items.capacity()) _items.grow(n); }
+
+	T *insert(const T& item, bool& added) {
+		int i = lowerIndex(K::key(item));
+		added = i >= count() || compare(K::key(_items[i]), K::key(item)) != 0;
+		if(added)
+			_items.insert(i, item);
+		return &_items[i];
+	}
+	inline void add(const T& item) { bool added; insert(item, added); }
+	inline void set(const T& item) { bool added; T *p = insert(item, added); if(!added) *p = item; }
+	inline T *fetch(const T& item) { bool added; return insert(item, added); }
+	template <class CC> void addAll(const CC& c) {
+		if(c.count() <= MERGE_THRESHOLD)
+			for(const auto& x: c)
+				add(x);
+		else {
+			for(const auto& x: c)
+				_items.add(x);
+			build(false);
+		}
+	}
+	bool removeByKey(const key_t& key)
+		{ int i = find(key); if(i < 0) return false; _items.removeAt(i); return true; }
+	inline void remove(const T& item) { removeByKey(K::key(item)); }
+	inline void remove(const Iter& i) { _items.removeAt(i.i); }
+	template <class CC> void load(const CC& c) {
+		_items.clear();
+		for(const auto& x: c)
+			_items.add(x);
+		build(true);
+	}
+
+protected:
+	typedef Vector<T, Equiv<T>, A> vector_t;
+	inline vector_t& items(void) { return _items; }
+
+private:
+	class ItemComparator {
+	public:
+		inline ItemComparator(const C& c): _c(c) { }
+		inline int doCompare(const T& x, const T& y) const { return _c.doCompare(K::key(x), K::key(y)); }
+	private:
+		const C& _c;
+	};
+
+	inline int compare(const key_t& k1, const key_t& k2) const { return C::doCompare(k1, k2); }
+
+	// sort the items and remove duplicates keeping the first (or the last) one
+	void build(bool last) {
+		mergesort(_items, ItemComparator(*this));
+		int n = count(), j = 0;
+		for(int i = 0; i < n; i++) {
+			if(j > 0 && compare(K::key(_items[j - 1]), K::key(_items[i])) == 0) {
+				if(last)
+					_items[j - 1] = std::move(_items[i]);
+			}
+			else {
+				if(i != j)
+					_items[j] = std::move(_items[i]);
+				j++;
+			}
+		}
+		_items.shrink(j);
+	}
+
+	// branchless binary search (the loop length only depends on count())
+	template <class P> inline int search(P before) const {
+		int n = count();
+		if(n == 0)
+			return 0;
+		int b = 0;
+		while(n > 1) {
+			int h = n >> 1;
+			b += before(b + h) ? h : 0;
+			n -= h;
+		}
+		return b + before(b);
+	}
+	inline int lowerIndex(const key_t& key) const {
+		const T *a = _items.asArray().buffer();
+		return search([&](int i) { return compare(K::key(a[i]), key) < 0; });
+	}
+	inline int upperIndex(const key_t& key) const {
+		const T *a = _items.asArray().buffer();
+		return search([&](int i) { return compare(key, K::key(a[i])) >= 0; });
+	}
+	inline int find(const key_t& key) const {
+		int i = lowerIndex(key);
+		return i < count() && compare(K::key(_items[i]), key) == 0 ? i : -1;
+	}
+
+	vector_t _items;
+};
+
+}	// elm
+
+#endif /* ELM_DATA_FLATTABLE_H_ */
@@ -29,6 +29,10 @@ namespace elm {
 // FragTable class
 template <class T, class E = Equiv<T>, class A = DefaultAlloc>
 class FragTable: public E, public A {
+	inline T *newPage(void)
+		{ T *p = static_cast<T *>(A::allocate(size * sizeof(T))); array::construct(p, size); return p; }
+	inline void deletePage(T *p) { array::destruct(p, size); A::free(p); }
+
 public:
 	typedef T t;
 	typedef FragTable<T, E, A> self_t;
@@ -94,10 +98,16 @@ public:
  	inline MutIter end() { return MutIter(*this, count()); }
 
  	inline void clear(void)
-		{ for(int i = 0; i < tab.count(); i++) delete [] tab[i]; tab.clear(); used = size; }
+		{ for(int i = 0; i < tab.count(); i++) deletePage(tab[i]); tab.clear(); used = size; }
 	inline void add(const T &value)
-		{	if(used >= size) { tab.add(new T[size]); used = 0; }
+		{	if(used >= size) { tab.add(newPage()); used = 0; }
 			tab[tab.length() - 1][used++] = value; }
+	inline void add(T&& value)
+		{	if(used >= size) { tab.add(newPage()); used = 0; }
+			tab[tab.length() - 1][used++] = std::move(value); }
+	template <class... Args> inline T& emplace(Args&&... args)
+		{	if(used >= size) { tab.add(newPage()); used = 0; }
+			T *p = tab[tab.length() - 1] + used++; p->~T(); return *new((void *)p) T(std::forward<Args>(args)...); }
 	template <template <class _> class C >
 	void addAll(const C<T> &items)
 		{ for(typename C<T>::Iterator i(items); i; i++) add(i); }
@@ -125,7 +135,7 @@ public:
 	// MutableArray concept
 	void shrink(int length)
 		{	ASSERTP(length < this->length(), "length too big"); int nl = (length + msk) >> shf;
-			for(int i = nl; i < tab.count(); i++) delete [] tab[i];
+			for(int i = nl; i < tab.count(); i++) deletePage(tab[i]);
 			tab.setLength(nl); used = length & msk; if(!used) used = size;  }
 	inline void set(int index, const T &value)
 		{ ASSERTP(index >= 0 && index < length(), "index out of bounds"); tab[index >> shf][index & msk] = value; }
@@ -133,20 +143,38 @@ public:
 	inline T &get(int index)
 		{ ASSERTP(index >= 0 && index < length(), "index out of bounds"); return tab[index >> shf][index & msk]; }
 	inline T &operator[](int index) { return get(index); }
-	void insert(int index, const T &item)
-		{ 	ASSERTP(index >= 0 && index <= length(), "index out of bounds");
-			int len = length(); alloc(1); for(int i = len - 1; i >= index; i--) set(i + 1, get(i)); set(index, item); }
+	void insert(int index, const T &item) {
+		ASSERTP(index >= 0 && index <= length(), "index out of bounds");
+		int len = length(); alloc(1);
+		for(int i = len; i > index;) {
+			int s = i & ~msk;
+			if(s == i) { get(i) = std::move(get(i - 1)); i--; continue; }
+			int a = s > index ? s + 1 : index + 1;
+			T *p = tab[i >> shf];
+			array::relocate(p + (a & msk), p + ((a - 1) & msk), i - a + 1);
+			i = a - 1;
+		}
+		set(index, item);
+	}
 	inline void insert(const Iter &iter, const T &item)
 		{ insert(iter.i, item); }
 	void removeAt(int index)  {
-		int len = length(); for(int i = index + 1; i < len; i++) set(i - 1, get(i));
-		used--; if(!used) { delete [] tab[tab.count() - 1]; tab.setLength(tab.count() - 1); used = size; }
+		int len = length();
+		for(int i = index; i < len - 1;) {
+			int e = i | msk;
+			if(e == i) { get(i) = std::move(get(i + 1)); i++; continue; }
+			int b = e - 1 < len - 2 ? e - 1 : len - 2;
+			T *p = tab[i >> shf];
+			array::relocate(p + (i & msk), p + ((i + 1) & msk), b - i + 1);
+			i = b + 1;
+		}
+		used--; if(!used) { deletePage(tab[tab.count() - 1]); tab.setLength(tab.count() - 1); used = size; }
 	}
 	inline void removeAt(const Iter &iter) { removeAt(iter.i); }
 
 	// other methods
 	int alloc(int count)
-		{	int res = length(); while(count >= size - used) { count -= size - used; tab.add(new T[size]); used = 0; }
+		{	int res = length(); while(count >= size - used) { count -= size - used; tab.add(newPage()); used = 0; }
 			used += count; return res; }
 
 private:
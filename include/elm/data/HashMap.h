@@ -28,15 +28,15 @@
 
 namespace elm {
 
-template <class K, class T, class H = HashKey<K>, class A = DefaultAlloc, class E = Equiv<T> >
+template <class K, class T, class H = HashKey<K>, class A = DefaultAlloc, class E = Equiv<T>, class P = ReadOnlyLookup>
 class HashMap: public E {
-	typedef HashTable<Pair<K, T>, AssocHashKey<K, T, H>, A> tab_t;
+	typedef HashTable<Pair<K, T>, AssocHashKey<K, T, H>, A, P> tab_t;
 public:
 	typedef K key_t;
 	typedef T val_t;
-	typedef HashMap<K, T, H, A, E> self_t;
+	typedef HashMap<K, T, H, A, E, P> self_t;
 
-	inline HashMap(int _size = 211): _tab(_size) { }
+	inline HashMap(int _size = 211, float load = 1.f): _tab(_size, load) { }
 	inline HashMap(const self_t& h): _tab(h._tab) { }
 	inline const H& hash() const { return _tab.hash().keyHash(); }
 	inline H& hash() { return _tab.hash().keyHash(); }
@@ -46,10 +46,14 @@ public:
 	inline E& equivalence() { return *this; }
 
 	inline void clear(void) { _tab.clear(); }
+	inline void reserve(int n) { _tab.reserve(n); }
+	inline float maxLoad(void) const { return _tab.maxLoad(); }
+	inline void setMaxLoad(float load) { _tab.setMaxLoad(load); }
 	inline void add(const K& key, const T& val) { _tab.add(pair(key, val)); }
+	inline void add(const K& key, T&& val) { _tab.emplace(key, std::move(val)); }
 
 	inline T& fetch(const K& k)
-		{ auto *n = _tab.get(key(k)); if(n != nullptr) return n->snd; return _tab.add(pair(k, T()))->snd; }
+		{ auto *n = _tab.get(key(k)); if(n != nullptr) return n->snd; return _tab.emplace(k, T())->snd; }
 
 	// Map concept
 	inline Option<T> get(const K& k) const
@@ -131,6 +135,7 @@ public:
 
 	// MutableMap concept
 	inline void put(const K& key, const T& val) { _tab.put(pair(key, val)); }
+	inline void put(const K& key, T&& val) { _tab.put(Pair<K, T>(key, std::move(val))); }
 	inline void remove(const K& k) { _tab.remove(key(k)); }
 	inline void remove(const Iter& i) { _tab.remove(i.i); }
 
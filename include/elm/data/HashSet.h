@@ -27,13 +27,13 @@
 
 namespace elm {
 
-template <class T, class H = HashKey<T>, class A = DefaultAlloc>
+template <class T, class H = HashKey<T>, class A = DefaultAlloc, class P = ReadOnlyLookup>
 class HashSet {
-	typedef HashTable<T, H, A> tab_t;
+	typedef HashTable<T, H, A, P> tab_t;
 public:
-	typedef HashSet<T, H, A> self_t;
+	typedef HashSet<T, H, A, P> self_t;
 
-	inline HashSet(int size = 211): _tab(size) { }
+	inline HashSet(int size = 211, float load = 1.f): _tab(size, load) { }
 	inline HashSet(const HashSet<T>& s): _tab(s._tab) { }
 	inline const H& hash() const { return _tab.hash(); }
 	inline H& hash() { return _tab.hash(); }
@@ -70,7 +70,11 @@ public:
 
 	// MutableCollection concept
 	inline void clear(void) { _tab.clear(); }
+	inline void reserve(int n) { _tab.reserve(n); }
+	inline float maxLoad(void) const { return _tab.maxLoad(); }
+	inline void setMaxLoad(float load) { _tab.setMaxLoad(load); }
 	inline void add(const T& val) { insert(val); }
+	inline void add(T&& val) { insert(std::move(val)); }
 	template <class C> void addAll(const C& coll)
 		{ for(typename C::Iter i(coll); i(); i++) add(*i); }
 	inline void remove(const T& val) { _tab.remove(val); }
@@ -84,6 +88,7 @@ public:
 
 	// Set concept
 	inline void insert(const T& val) { _tab.put(val); }
+	inline void insert(T&& val) { _tab.put(std::move(val)); }
 	inline bool subsetOf(const HashSet<T>& s) const
 		{ for(const auto x: *this) if(!s.contains(x)) return false; return true; }
 	inline bool operator<=(const HashSet<T>& s) const { return subsetOf(s); }
@@ -135,8 +140,8 @@ private:
 	tab_t _tab;
 };
 
-template <class T, class H, class A>
-const HashSet<T, H, A> HashSet<T, H, A>::null(1);
+template <class T, class H, class A, class P>
+const HashSet<T, H, A, P> HashSet<T, H, A, P>::null(1);
 
 }	// elm
 
@@ -24,36 +24,50 @@
 #include "custom.h"
 #include <elm/adapter.h>
 #include <elm/array.h>
+#include <elm/assert.h>
+#include <elm/compare.h>
 #include <elm/hash.h>
+#include <utility>
 
 namespace elm {
 
-template <class T, class H = HashKey<T>, class A = DefaultAlloc >
+// look-up policies
+class ReadOnlyLookup {
+public:
+	static const bool move_to_front = false;
+};
+
+class MoveToFrontLookup {
+public:
+	static const bool move_to_front = true;
+};
+
+template <class T, class H = HashKey<T>, class A = DefaultAlloc, class P = ReadOnlyLookup>
 class HashTable: public H, public A {
 public:
-	typedef HashTable<T, H, A> self_t;
+	typedef HashTable<T, H, A, P> self_t;
 
 private:
 	class node_t {
 	public:
-		inline node_t(const T& d): next(0), data(d)  { }
+		template <class... Args> inline node_t(Args&&... args): next(0), data(std::forward<Args>(args)...)  { }
 		node_t *next;
 		T data;
 	};
 
 protected:
 	node_t *find(const T& key) const {
-		int i = H::computeHash(key) % _size;
+		int i = index(H::computeHash(key));
 		for(node_t *node = _tab[i], *prev = 0; node; prev = node, node = node->next)
 			if(H::isEqual(node->data, key)) {
-				if(prev) { prev->next = node->next; node->next = _tab[i]; _tab[i] = node; }
+				if(P::move_to_front && prev) { prev->next = node->next; node->next = _tab[i]; _tab[i] = node; }
 				return node;
 			}
 		return 0;
 	}
 
 	node_t *find_const(const T& key) const {
-		int i = H::computeHash(key) % _size;
+		int i = index(H::computeHash(key));
 		for(node_t *node = _tab[i], *prev = 0; node; prev = node, node = node->next)
 			if(H::isEqual(node->data, key)) {
 				return node;
@@ -63,14 +77,51 @@ protected:
 
 private:
 
-	node_t *make(const T& data) {
-		int i = H::computeHash(data) % _size;
-		node_t *node = new(A::allocate(sizeof(node_t))) node_t(data);
+	template <class... Args> node_t *make(Args&&... args) {
+		if(_cnt >= _limit)
+			resize(_size << 1);
+		node_t *node = new(A::allocate(sizeof(node_t))) node_t(std::forward<Args>(args)...);
+		int i = index(H::computeHash(node->data));
 		node->next = _tab[i];
 		_tab[i] = node;
+		_cnt++;
 		return node;
 	}
 
+	inline void release(node_t *node) { node->~node_t(); A::free(node); }
+
+	inline int index(t::hash h) const { return int(hash_mix(h) & (_size - 1)); }
+
+	static int roundSize(int size) {
+		int s = MIN_SIZE;
+		while(s < size && s < MAX_SIZE)
+			s <<= 1;
+		return s;
+	}
+
+	inline void setLimit(void) { _limit = int(_size * _load); if(_limit < 1) _limit = 1; }
+
+	void alloc(int size) {
+		_size = size;
+		_tab = new(A::allocate(_size * sizeof(node_t *))) node_t *[_size];
+		array::fast<node_t*>::clear(_tab, _size);
+		setLimit();
+	}
+
+	void resize(int size) {
+		node_t **otab = _tab;
+		int osize = _size;
+		alloc(size);
+		for(int i = 0; i < osize; i++)
+			for(node_t *node = otab[i], *next; node; node = next) {
+				next = node->next;
+				int j = index(H::computeHash(node->data));
+				node->next = _tab[j];
+				_tab[j] = node;
+			}
+		A::free(otab);
+	}
+
 	struct InternIterator {
 		friend class HashTable;
 		inline InternIterator(const self_t& _htab): node(nullptr), htab(&_htab) { i = 0; step(); }
@@ -89,12 +140,15 @@ private:
 
 public:
 
-	HashTable(int _size = 211): _size(_size), _tab(new(A::allocate(_size * sizeof(node_t *))) node_t *[_size])
-		{ array::fast<node_t*>::clear(_tab, _size); }
-	HashTable(const self_t& h): _size(h._size), _tab(new(A::allocate(_size * sizeof(node_t *))) node_t *[h._size])
-		{ array::fast<node_t*>::clear(_tab, _size); putAll(h); }
+	static const int MIN_SIZE = 8;
+	static const int MAX_SIZE = 1 << 30;
+
+	HashTable(int size = 211, float load = 1.f): _cnt(0), _load(load)
+		{ alloc(roundSize(size)); }
+	HashTable(const self_t& h): _cnt(0), _load(h._load)
+		{ alloc(h._size); putAll(h); }
 	~HashTable(void)
-		{ clear(); delete [] _tab; }
+		{ clear(); A::free(_tab); }
 	inline const H& hash() const { return *this; }
 	inline H& hash() { return *this; }
 	inline const A& allocator() const { return *this; }
@@ -113,16 +167,22 @@ public:
 
 	void put(const T& data)
 		{ node_t *node = find(data); if(node) node->data = data; else add(data); }
+	void put(T&& data)
+		{ node_t *node = find(data); if(node) node->data = std::move(data); else add(std::move(data)); }
 	template <class CC> void putAll(const CC& c)
 		{ for(const auto& x: c) put(x); }
 
+	inline float maxLoad(void) const { return _load; }
+	void setMaxLoad(float load)
+		{ ASSERTP(load > 0, "load factor must be positive"); _load = load; setLimit(); if(_cnt >= _limit) reserve(_cnt); }
+	void reserve(int n)
+		{ t::int64 s = _size; while(s < MAX_SIZE && t::int64(s * _load) < n) s <<= 1; if(s != _size) resize(int(s)); }
+
 
 	// Collection concept
-	bool isEmpty(void) const
-		{ for(int i = 0; i < _size; i++) if(_tab[i]) return false; return true; }
+	inline bool isEmpty(void) const { return _cnt == 0; }
 	operator bool() const { return !isEmpty(); }
-	int count(void) const
-	 	{ int cnt = 0; for(int i = 0; i < _size; i++) for(node_t *cur = _tab[i]; cur; cur = cur->next) cnt++; return cnt; }
+	inline int count(void) const { return _cnt; }
 	inline bool contains(const T& x) const
 		{ return find(x) != nullptr; }
 	inline bool contains_const(const T& x) const
@@ -141,22 +201,25 @@ public:
 	inline Iter begin() const { return Iter(*this); }
 	inline Iter end() const { return Iter(*this, true); }
 
-	inline bool equals(const HashTable<T>& h) const
+	inline bool equals(const self_t& h) const
 		{ return containsAll(h) && h.containsAll(*this); }
-	inline bool equals_const(const HashTable<T>& h) const
+	inline bool equals_const(const self_t& h) const
 		{ return containsAll_const(h) && h.containsAll_const(*this); }
-	inline bool operator==(const HashTable<T>& t) const { return equals(t); }
-	inline bool operator!=(const HashTable<T>& t) const { return !equals(t); }
+	inline bool operator==(const self_t& t) const { return equals(t); }
+	inline bool operator!=(const self_t& t) const { return !equals(t); }
 
 	// MutableCollection concept
 	void clear(void) {
 		for(int i = 0; i < _size; i++) {
-			for(node_t *cur = _tab[i], *next; cur; cur = next) { next = cur->next; A::free(cur); }
+			for(node_t *cur = _tab[i], *next; cur; cur = next) { next = cur->next; release(cur); }
 			_tab[i] = 0;
 		}
+		_cnt = 0;
 	}
 
 	T *add(const T& data) { return &make(data)->data; }
+	T *add(T&& data) { return &make(std::move(data))->data; }
+	template <class... Args> T *emplace(Args&&... args) { return &make(std::forward<Args>(args)...)->data; }
 
 	inline self_t& operator+=(const T& x) { add(x); return *this; }
 
@@ -164,14 +227,15 @@ public:
 		{ for(const auto x: c) add(x); }
 
 	void remove(const T& key) {
-		int i = H::computeHash(key) % _size;
+		int i = index(H::computeHash(key));
 		for(node_t *node = _tab[i], *prev = 0; node; prev = node, node = node->next)
 			if(H::isEqual(node->data, key)) {
 				if(prev)
 					prev->next = node->next;
 				else
 					_tab[i] = node->next;
-				A::free(node);
+				release(node);
+				_cnt--;
 				break;
 			}
 	}
@@ -188,29 +252,31 @@ public:
 			_tab[i.i] = i.node->next;
 		else
 			p->next = i.node->next;
-		A::free(i.node);
+		release(i.node);
+		_cnt--;
 	}
 
-	void copy(const HashTable<T, H>& t) {
+	void copy(const self_t& t) {
 		clear();
-		if(_size != t._size)
-			putAll(t);
-		else {
-			for(int i = 0; i < _size; i++) {
-				if(t._tab[i] != nullptr) {
-					node_t *q = t._tab[i];
-					node_t *p = new(A::allocate(sizeof(node_t))) node_t(q->data);
-					_tab[i] = p;
-					while(q->next != nullptr) {
-						q = q->next;
-						p->next = new(A::allocate(sizeof(node_t))) node_t(q->data);
-						p = p->next;
-					}
+		if(_size != t._size) {
+			A::free(_tab);
+			alloc(t._size);
+		}
+		_cnt = t._cnt;
+		for(int i = 0; i < _size; i++) {
+			if(t._tab[i] != nullptr) {
+				node_t *q = t._tab[i];
+				node_t *p = new(A::allocate(sizeof(node_t))) node_t(q->data);
+				_tab[i] = p;
+				while(q->next != nullptr) {
+					q = q->next;
+					p->next = new(A::allocate(sizeof(node_t))) node_t(q->data);
+					p = p->next;
 				}
 			}
 		}
 	}
-	inline self_t& operator=(const HashTable<T, H>& c) { copy(c); return *this; }
+	inline self_t& operator=(const self_t& c) { copy(c); return *this; }
 
 	inline T *get(const T& key)
 		{ node_t *node = find(key); return node ? &node->data : 0; }
@@ -229,6 +295,8 @@ private:
 
 	int _size;
 	node_t **_tab;
+	int _cnt, _limit;
+	float _load;
 };
 
 }	// otawa
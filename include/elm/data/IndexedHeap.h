@@ -0,0 +1,169 @@
+/*
+ *	IndexedHeap class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_DATA_INDEXEDHEAP_H_
+#define ELM_DATA_INDEXEDHEAP_H_
+
+#include <elm/assert.h>
+#include <elm/compare.h>
+#include <elm/data/custom.h>
+#include <elm/data/Vector.h>
+#include <utility>
+
+namespace elm {
+
+template <class T, class C = Comparator<T>, int D = 4, class A = DefaultAlloc>
+class IndexedHeap: public C {
+	class Entry {
+	public:
+		inline Entry(void): h(-1) { }
+		inline Entry(const T& value, int handle): x(value), h(handle) { }
+		T x;
+		int h;
+	};
+
+public:
+	typedef T t;
+	typedef int handle_t;
+	typedef IndexedHeap<T, C, D, A> self_t;
+	static const int NO_HANDLE = -1;
+
+	IndexedHeap(const C& c = single<C>()): C(c) { }
+	inline const C& comparator() const { return *this; }
+	inline C& comparator() { return *this; }
+
+	// Queue concept
+	inline bool isEmpty(void) const { return _heap.isEmpty(); }
+	inline int count(void) const { return _heap.count(); }
+	inline const T& head(void) const
+		{ ASSERTP(!isEmpty(), "empty heap"); return _heap[0].x; }
+	inline handle_t headHandle(void) const
+		{ ASSERTP(!isEmpty(), "empty heap"); return _heap[0].h; }
+
+	T get(void) {
+		ASSERTP(!isEmpty(), "empty heap");
+		T x = std::move(_heap[0].x);
+		release(_heap[0].h);
+		Entry e = _heap.pop();
+		if(!_heap.isEmpty())
+			down(0, std::move(e));
+		return x;
+	}
+
+	handle_t put(const T& x) {
+		int h;
+		if(_free.isEmpty()) {
+			h = _pos.count();
+			_pos.add(-1);
+		}
+		else
+			h = _free.pop();
+		_heap.add(Entry());
+		up(_heap.count() - 1, Entry(x, h));
+		return h;
+	}
+
+	void reset(void) { _heap.clear(); _pos.clear(); _free.clear(); }
+	inline void clear(void) { reset(); }
+
+	// handle access
+	inline bool contains(handle_t h) const
+		{ return 0 <= h && h < _pos.count() && _pos[h] >= 0; }
+	inline const T& value(handle_t h) const
+		{ ASSERTP(contains(h), "bad handle"); return _heap[_pos[h]].x; }
+	inline const T& operator[](handle_t h) const { return value(h); }
+
+	void decreaseKey(handle_t h, const T& x) {
+		ASSERTP(contains(h), "bad handle");
+		int i = _pos[h];
+		ASSERTP(C::doCompare(x, _heap[i].x) <= 0, "decreaseKey() with a greater value");
+		up(i, Entry(x, h));
+	}
+
+	void increaseKey(handle_t h, const T& x) {
+		ASSERTP(contains(h), "bad handle");
+		int i = _pos[h];
+		ASSERTP(C::doCompare(_heap[i].x, x) <= 0, "increaseKey() with a smaller value");
+		down(i, Entry(x, h));
+	}
+
+	void update(handle_t h, const T& x) {
+		ASSERTP(contains(h), "bad handle");
+		int i = _pos[h];
+		if(C::doCompare(x, _heap[i].x) < 0)
+			up(i, Entry(x, h));
+		else
+			down(i, Entry(x, h));
+	}
+
+	void remove(handle_t h) {
+		ASSERTP(contains(h), "bad handle");
+		int i = _pos[h];
+		release(h);
+		Entry e = _heap.pop();
+		if(i == _heap.count())
+			return;
+		if(C::doCompare(e.x, _heap[i].x) < 0)
+			up(i, std::move(e));
+		else
+			down(i, std::move(e));
+	}
+
+private:
+
+	inline void place(int i, Entry&& e) { _pos[e.h] = i; _heap[i] = std::move(e); }
+	inline void release(handle_t h) { _pos[h] = -1; _free.push(h); }
+
+	void up(int i, Entry&& e) {
+		while(i > 0) {
+			int p = (i - 1) / D;
+			if(C::doCompare(e.x, _heap[p].x) >= 0)
+				break;
+			place(i, std::move(_heap[p]));
+			i = p;
+		}
+		place(i, std::move(e));
+	}
+
+	void down(int i, Entry&& e) {
+		int n = _heap.count();
+		while(true) {
+			int c = D * i + 1;
+			if(c >= n)
+				break;
+			int b = c, l = c + D < n ? c + D : n;
+			for(int k = c + 1; k < l; k++)
+				if(C::doCompare(_heap[k].x, _heap[b].x) < 0)
+					b = k;
+			if(C::doCompare(_heap[b].x, e.x) >= 0)
+				break;
+			place(i, std::move(_heap[b]));
+			i = b;
+		}
+		place(i, std::move(e));
+	}
+
+	Vector<Entry, Equiv<Entry>, A> _heap;
+	Vector<int, Equiv<int>, A> _pos, _free;
+};
+
+}	// elm
+
+#endif /* ELM_DATA_INDEXEDHEAP_H_ */
@@ -26,6 +26,7 @@
 #include <elm/inhstruct/SLList.h>
 #include "custom.h"
 #include <elm/equiv.h>
+#include <utility>
 
 namespace elm {
 
@@ -36,7 +37,7 @@ class List: public E, public A {
 	// Node class
 	class Node: public inhstruct::SLNode {
 	public:
-		inline Node(const T value): val(value) { }
+		template <class... Args> inline Node(Args&&... args): val(std::forward<Args>(args)...) { }
 		T val;
 		inline Node *next(void) const { return nextNode(); }
 		inline Node *nextNode(void) const { return static_cast<Node *>(SLNode::next()); }
@@ -129,6 +130,7 @@ public:
 	inline void clear(void)
 		{ while(!_list.isEmpty()) { Node *node = firstNode(); _list.removeFirst(); node->free(this); } }
 	inline void add(const T& value) { addFirst(value); }
+	inline void add(T&& value) { addFirst(std::move(value)); }
 	template <class C> inline void addAll(const C& items)
 		{ for(typename C::Iter i(items); i(); i++) add(*i); }
 	template <class C> inline void removeAll(const C& items)
@@ -156,6 +158,12 @@ public:
 	// MutableList concept
 	inline void addFirst(const T& value) { _list.addFirst(new(this) Node(value)); }
 	inline void addLast(const T& value) { _list.addLast(new(this) Node(value)); }
+	inline void addFirst(T&& value) { _list.addFirst(new(this) Node(std::move(value))); }
+	inline void addLast(T&& value) { _list.addLast(new(this) Node(std::move(value))); }
+	template <class... Args> inline T& emplace(Args&&... args)
+		{ Node *n = new(this) Node(std::forward<Args>(args)...); _list.addFirst(n); return n->val; }
+	template <class... Args> inline T& emplaceLast(Args&&... args)
+		{ Node *n = new(this) Node(std::forward<Args>(args)...); _list.addLast(n); return n->val; }
 	inline void addAfter(const Iter& pos, const T& value)
 		{ ASSERT(pos.node); pos.node->insertAfter(new(this) Node(value)); }
 	inline void addBefore(PrecIter& pos, const T& value)
@@ -169,6 +177,7 @@ public:
 	inline const T& top(void) const { return first(); }
 	inline T pop(void) { T r = first(); removeFirst(); return r; }
 	inline void push(const T& i) { addFirst(i); }
+	inline void push(T&& i) { addFirst(std::move(i)); }
 	inline void reset(void) { clear(); }
 
 	// operators
@@ -0,0 +1,133 @@
+/*
+ *	MPMCQueue class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_DATA_MPMCQUEUE_H_
+#define ELM_DATA_MPMCQUEUE_H_
+
+#include <atomic>
+#include <utility>
+#include "custom.h"
+#include "ring.h"
+
+namespace elm {
+
+template <class T, class A = DefaultAlloc>
+class MPMCQueue: public A {
+
+	class Cell {
+	public:
+		std::atomic<t::uint64> seq;
+		alignas(T) char data[sizeof(T)];
+		inline T& item(void) { return *reinterpret_cast<T *>(data); }
+	};
+
+public:
+	typedef MPMCQueue<T, A> self_t;
+
+	MPMCQueue(int capacity = 1024, const A& alloc = A())
+		: A(alloc), _head(0), _tail(0), _cap(ring::roundSize(capacity)), _mask(_cap - 1),
+		  _cells(static_cast<Cell *>(A::allocate(_cap * sizeof(Cell))))
+	{
+		for(int i = 0; i < _cap; i++) {
+			new((void *)(_cells + i)) Cell();
+			_cells[i].seq.store(i, std::memory_order_relaxed);
+		}
+	}
+	~MPMCQueue(void) {
+		for(t::uint64 i = _head.load(std::memory_order_relaxed), e = _tail.load(std::memory_order_relaxed); i != e; i++)
+			_cells[i & _mask].item().~T();
+		for(int i = 0; i < _cap; i++)
+			_cells[i].~Cell();
+		A::free(_cells);
+	}
+	inline const A& allocator() const { return *this; }
+	inline A& allocator() { return *this; }
+
+	inline int capacity(void) const { return _cap; }
+	inline int count(void) const {
+		t::int64 c = t::int64(_tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire));
+		return c < 0 ? 0 : c > _cap ? _cap : int(c);
+	}
+	inline bool isEmpty(void) const { return count() == 0; }
+	inline operator bool(void) const { return !isEmpty(); }
+
+	inline bool tryPut(const T& x) { return tryEmplace(x); }
+	inline bool tryPut(T&& x) { return tryEmplace(std::move(x)); }
+	inline void put(const T& x) { ring::Backoff b; while(!tryEmplace(x)) b.wait(); }
+	inline void put(T&& x) { ring::Backoff b; while(!tryEmplace(std::move(x))) b.wait(); }
+
+	bool tryGet(T& x) {
+		t::uint64 p = _head.load(std::memory_order_relaxed);
+		Cell *c;
+		while(true) {
+			c = _cells + (p & _mask);
+			t::int64 d = t::int64(c->seq.load(std::memory_order_acquire) - (p + 1));
+			if(d == 0) {
+				if(_head.compare_exchange_weak(p, p + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if(d < 0)
+				return false;
+			else
+				p = _head.load(std::memory_order_relaxed);
+		}
+		x = std::move(c->item());
+		c->item().~T();
+		c->seq.store(p + _cap, std::memory_order_release);
+		return true;
+	}
+	inline T get(void) { T x; ring::Backoff b; while(!tryGet(x)) b.wait(); return x; }
+
+private:
+	template <class U> bool tryEmplace(U&& x) {
+		t::uint64 p = _tail.load(std::memory_order_relaxed);
+		Cell *c;
+		while(true) {
+			c = _cells + (p & _mask);
+			t::int64 d = t::int64(c->seq.load(std::memory_order_acquire) - p);
+			if(d == 0) {
+				if(_tail.compare_exchange_weak(p, p + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if(d < 0)
+				return false;
+			else
+				p = _tail.load(std::memory_order_relaxed);
+		}
+		new((void *)c->data) T(std::forward<U>(x));
+		c->seq.store(p + 1, std::memory_order_release);
+		return true;
+	}
+
+	MPMCQueue(const self_t&);
+	self_t& operator=(const self_t&);
+
+	char _pad0[ring::CACHE_LINE];
+	std::atomic<t::uint64> _head;
+	char _pad1[ring::CACHE_LINE];
+	std::atomic<t::uint64> _tail;
+	char _pad2[ring::CACHE_LINE];
+	int _cap, _mask;
+	Cell *_cells;
+};
+
+}	// elm
+
+#endif /* ELM_DATA_MPMCQUEUE_H_ */
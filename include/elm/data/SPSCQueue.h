@@ -0,0 +1,105 @@
+/*
+ *	SPSCQueue class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_DATA_SPSCQUEUE_H_
+#define ELM_DATA_SPSCQUEUE_H_
+
+#include <atomic>
+#include <utility>
+#include "custom.h"
+#include "ring.h"
+
+namespace elm {
+
+template <class T, class A = DefaultAlloc>
+class SPSCQueue: public A {
+public:
+	typedef SPSCQueue<T, A> self_t;
+
+	SPSCQueue(int capacity = 1024, const A& alloc = A())
+		: A(alloc), _head(0), _tcache(0), _tail(0), _hcache(0),
+		  _cap(ring::roundSize(capacity)), _mask(_cap - 1),
+		  _buf(static_cast<T *>(A::allocate(_cap * sizeof(T)))) { }
+	~SPSCQueue(void) {
+		for(t::uint64 i = _head.load(std::memory_order_relaxed), e = _tail.load(std::memory_order_relaxed); i != e; i++)
+			_buf[i & _mask].~T();
+		A::free(_buf);
+	}
+	inline const A& allocator() const { return *this; }
+	inline A& allocator() { return *this; }
+
+	inline int capacity(void) const { return _cap; }
+	inline int count(void) const
+		{ return int(_tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire)); }
+	inline bool isEmpty(void) const { return count() == 0; }
+	inline operator bool(void) const { return !isEmpty(); }
+
+	// producer side
+	inline bool tryPut(const T& x) { return tryEmplace(x); }
+	inline bool tryPut(T&& x) { return tryEmplace(std::move(x)); }
+	inline void put(const T& x) { ring::Backoff b; while(!tryEmplace(x)) b.wait(); }
+	inline void put(T&& x) { ring::Backoff b; while(!tryEmplace(std::move(x))) b.wait(); }
+
+	// consumer side
+	bool tryGet(T& x) {
+		t::uint64 h = _head.load(std::memory_order_relaxed);
+		if(h == _tcache) {
+			_tcache = _tail.load(std::memory_order_acquire);
+			if(h == _tcache)
+				return false;
+		}
+		T& s = _buf[h & _mask];
+		x = std::move(s);
+		s.~T();
+		_head.store(h + 1, std::memory_order_release);
+		return true;
+	}
+	inline T get(void) { T x; ring::Backoff b; while(!tryGet(x)) b.wait(); return x; }
+
+private:
+	template <class U> bool tryEmplace(U&& x) {
+		t::uint64 tl = _tail.load(std::memory_order_relaxed);
+		if(tl - _hcache == t::uint64(_cap)) {
+			_hcache = _head.load(std::memory_order_acquire);
+			if(tl - _hcache == t::uint64(_cap))
+				return false;
+		}
+		new((void *)(_buf + (tl & _mask))) T(std::forward<U>(x));
+		_tail.store(tl + 1, std::memory_order_release);
+		return true;
+	}
+
+	SPSCQueue(const self_t&);
+	self_t& operator=(const self_t&);
+
+	char _pad0[ring::CACHE_LINE];
+	std::atomic<t::uint64> _head;
+	t::uint64 _tcache;
+	char _pad1[ring::CACHE_LINE];
+	std::atomic<t::uint64> _tail;
+	t::uint64 _hcache;
+	char _pad2[ring::CACHE_LINE];
+	int _cap, _mask;
+	T *_buf;
+};
+
+}	// elm
+
+#endif /* ELM_DATA_SPSCQUEUE_H_ */
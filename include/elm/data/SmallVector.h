@@ -0,0 +1,260 @@
+/*
+ *	SmallVector class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_DATA_SMALLVECTOR_H_
+#define ELM_DATA_SMALLVECTOR_H_
+
+#include "custom.h"
+#include "Array.h"
+
+#include <elm/array.h>
+#include <elm/assert.h>
+#include <utility>
+
+namespace elm {
+
+template <class T, int N = 8, class E = Equiv<T>, class A = DefaultAlloc >
+class SmallVector: public E, public A {
+public:
+	typedef T t;
+	typedef SmallVector<T, N, E, A> self_t;
+
+	inline SmallVector(void): tab(local()), cap(N), cnt(0) { }
+	inline SmallVector(const self_t& vec): tab(local()), cap(N), cnt(0) { copy(vec); }
+	inline SmallVector(self_t&& vec): tab(local()), cap(N), cnt(0) { steal(vec); }
+	inline ~SmallVector(void) { release(); }
+	inline const E& equivalence() const { return *this; }
+	inline E& equivalence() { return *this; }
+	inline const A& allocator() const { return *this; }
+	inline A& allocator() { return *this; }
+
+	inline int capacity(void) const { return cap; }
+	inline bool isSmall(void) const { return tab == local(); }
+	inline Array<const T> asArray(void) const { return Array<const T>(count(), tab); }
+	inline Array<T> asArray(void) { return Array<T>(count(), tab); }
+	void grow(int new_cap) {
+		ASSERTP(new_cap >= cap, "new capacity must be bigger than old one");
+		if(new_cap == cap)
+			return;
+		T *new_tab = static_cast<T *>(A::allocate(new_cap * sizeof(T)));
+		array::transfer(new_tab, tab, cnt);
+		if(!isSmall())
+			A::free(tab);
+		tab = new_tab;
+		cap = new_cap;
+	}
+	void setLength(int new_length) {
+		ASSERTP(new_length >= 0, "new length must be >= 0");
+		if(new_length > cap) {
+			int new_cap = cap;
+			while(new_cap < new_length)
+				new_cap *= 2;
+			grow(new_cap);
+		}
+		if(new_length > cnt)
+			array::construct(tab + cnt, new_length - cnt);
+		else
+			array::destruct(tab + new_length, cnt - new_length);
+		cnt = new_length;
+	}
+	inline T& addNew(void) { enlarge(); new((void *)(tab + cnt)) T(); return tab[cnt++]; }
+	template <class... Args> inline T& emplace(Args&&... args)
+		{ enlarge(); new((void *)(tab + cnt)) T(std::forward<Args>(args)...); return tab[cnt++]; }
+
+	class PreIter {
+		friend class SmallVector;
+	public:
+		inline PreIter(const self_t& vec, int idx = 0): _vec(&vec), i(idx) { }
+		inline bool ended(void) const { return i >= _vec->length(); }
+		inline void next(void) { i++; }
+		inline int index(void) const { return i; }
+		inline bool equals(const PreIter& it) const { return _vec == it._vec && i == it.i; }
+	protected:
+		const self_t *_vec;
+		int i;
+	};
+
+	// Collection concept
+	class Iter: public PreIter, public elm::ConstPreIter<Iter, T>, public elm::PreIter<Iter, T> {
+	public:
+		using PreIter::PreIter;
+		inline const T& item() const { return (*PreIter::_vec)[PreIter::i]; }
+	};
+	inline Iter begin() const { return Iter(*this); }
+	inline Iter end() const { return Iter(*this, count()); }
+
+	inline int count(void) const { return cnt; }
+	bool contains(const T& v) const
+		{ for(int i = 0; i < cnt; i++) if(E::isEqual(v, tab[i])) return true; return false; }
+	template <class C> inline bool containsAll(const C& items) const
+		{ for(const auto& x: items) if(!contains(x)) return false; return true; }
+	inline bool isEmpty(void) const { return cnt == 0; }
+	inline operator bool(void) const { return cnt != 0; }
+
+	template <class C> inline bool equals(const C& c) const {
+		int i = 0; for(const auto& x: c)
+			{ if(i >= count() || !E::isEqual(tab[i], x)) return false; i++; } return i == count(); }
+	inline bool operator==(const self_t& v) const { return equals(v); }
+	inline bool operator!=(const self_t& v) const { return !equals(v); }
+
+	// MutableCollection concept
+	class MutIter: public PreIter, public MutPreIter<MutIter, T>, public elm::PreIter<MutIter, T> {
+	public:
+		using PreIter::PreIter;
+		inline T& item() const { return (*const_cast<self_t *>(PreIter::_vec))[PreIter::i]; }
+		inline operator Iter() const { return Iter(*PreIter::_vec, PreIter::i); }
+	};
+	inline MutIter begin() { return MutIter(*this); }
+	inline MutIter end() { return MutIter(*this, count()); }
+
+	inline void clear(void) { array::destruct(tab, cnt); cnt = 0; }
+	void add(const T& v) { enlarge(); new((void *)(tab + cnt)) T(v); cnt++; }
+	void add(T&& v) { enlarge(); new((void *)(tab + cnt)) T(std::move(v)); cnt++; }
+	template <class C> inline void addAll(const C& c)
+		{ for(const auto& x: c) add(x); }
+	inline void remove(const T& value) { int i = indexOf(value); if(i >= 0) removeAt(i); }
+	template <class C> inline void removeAll(const C& c)
+		{ for(const auto& x: c) remove(x); }
+	inline void remove(const Iter& i) { removeAt(i.i); }
+	inline self_t& operator+=(const T& x) { add(x); return *this; }
+	inline self_t& operator-=(const T& x) { remove(x); return *this; }
+	void copy(const self_t& vec) {
+		if(this == &vec)
+			return;
+		clear();
+		if(vec.cnt > cap)
+			grow(vec.cnt);
+		for(int i = 0; i < vec.cnt; i++)
+			new((void *)(tab + i)) T(vec.tab[i]);
+		cnt = vec.cnt;
+	}
+	inline self_t& operator=(const self_t& vec) { copy(vec); return *this; }
+	inline self_t& operator=(self_t&& vec) { if(this != &vec) { release(); steal(vec); } return *this; }
+
+	// Array concept
+	inline int length(void) const { return count(); }
+	inline const T& get(int i) const
+		{ ASSERTP(0 <= i && i < cnt, "index out of bounds"); return tab[i]; }
+	inline int indexOf(const T& v, int p = 0) const
+		{	ASSERTP(0 <= p && p <= cnt, "index out of bounds");
+			for(int i = p; i < cnt; i++) if(E::isEqual(v, tab[i])) return i; return -1; }
+	inline int lastIndexOf(const T& v, int p = -1) const
+		{	ASSERTP(p <= cnt, "index out of bounds");
+			for(int i = (p < 0 ? cnt : p) - 1; i >= 0; i--) if(E::isEqual(v, tab[i])) return i; return -1; }
+	inline const T& operator[](int i) const { return get(i); }
+
+	// MutableArray concept
+	inline void shrink(int l)
+		{ ASSERTP(0 <= l && l <= cnt, "bad shrink value"); array::destruct(tab + l, cnt - l); cnt = l; }
+	inline void set(int i, const T& v)
+		{ ASSERTP(0 <= i && i < cnt, "index out of bounds"); tab[i] = v; }
+	inline void set(const Iter &i, const T &v) { set(i.i, v); }
+	inline T& get(int i)
+		{ ASSERTP(0 <= i && i < cnt, "index out of bounds"); return tab[i]; }
+	inline T& get(const Iter& i) { return get(i.index()); }
+	inline T& operator[](int i) { return get(i); }
+	inline T& operator[](const Iter& i) { return get(i); }
+	void insert(int i, const T& v) { T x(v); insert(i, std::move(x)); }
+	void insert(int i, T&& v) {
+		ASSERTP(0 <= i && i <= cnt, "index out of bounds");
+		if(i == cnt) { add(std::move(v)); return; }
+		enlarge();
+		new((void *)(tab + cnt)) T(std::move(tab[cnt - 1]));
+		array::relocate(tab + i + 1, tab + i, cnt - i - 1);
+		tab[i] = std::move(v);
+		cnt++;
+	}
+	inline void insert(const Iter &i, const T &v) { insert(i.i, v); }
+	void removeAt(int i) {
+		ASSERTP(0 <= i && i < cnt, "index out of bounds");
+		array::relocate(tab + i, tab + i + 1, cnt - i - 1);
+		cnt--;
+		tab[cnt].~T();
+	}
+	inline void removeAt(const Iter& i) { removeAt(i.i); }
+
+	// List concept
+	inline const T& first(void) const { ASSERT(cnt > 0); return tab[0]; }
+	inline const T& last(void) const { ASSERT(cnt > 0); return tab[cnt - 1]; }
+	inline Iter find(const T &v) const
+		{ Iter i(*this); while(i() && !E::isEqual(*i, v)) i++; return i; }
+	inline Iter find(const T &v, const Iter &p) const
+		{ Iter i(p); while(i() && !E::isEqual(*i, v)) i++; return i; }
+	inline const T& nth(int i) const { return get(i); }
+
+	// MutableList concept
+	inline T& first() { ASSERT(cnt > 0); return tab[0]; }
+	inline T& last() { ASSERT(cnt > 0); return tab[cnt - 1]; }
+	inline void addFirst(const T &v) { insert(0, v); }
+	inline void addLast(const T &v) { add(v); }
+	inline void addLast(T&& v) { add(std::move(v)); }
+	inline void removeFirst(void) { removeAt(0); }
+	inline void removeLast(void) { removeAt(cnt - 1); }
+	inline void addAfter(const Iter &i, const T &v) { insert(i.i + 1, v); }
+	inline void addBefore(const Iter &i, const T &v) { insert(i.i, v); }
+	inline void removeBefore(const Iter& i) { removeAt(i.i - 1); }
+	inline void removeAfter(const Iter& i) { removeAt(i.i + 1); }
+
+	// Stack concept
+	inline const T &top(void) const { return last(); }
+	inline T &top(void) { return last(); }
+	inline T pop(void)
+		{ ASSERTP(cnt > 0, "no more data to pop"); T r(std::move(tab[cnt - 1])); removeLast(); return r; }
+	inline void push(const T &v) { add(v); }
+	inline void push(T&& v) { add(std::move(v)); }
+	inline void reset(void) { clear(); }
+
+private:
+	inline T *local(void) { return reinterpret_cast<T *>(buf); }
+	inline const T *local(void) const { return reinterpret_cast<const T *>(buf); }
+	inline void enlarge(void) { if(cnt >= cap) grow(cap * 2); }
+
+	void release(void) {
+		array::destruct(tab, cnt);
+		if(!isSmall())
+			A::free(tab);
+		tab = local();
+		cap = N;
+		cnt = 0;
+	}
+
+	void steal(self_t& vec) {
+		if(vec.isSmall()) {
+			array::transfer(tab, vec.tab, vec.cnt);
+			cnt = vec.cnt;
+		}
+		else {
+			tab = vec.tab;
+			cap = vec.cap;
+			cnt = vec.cnt;
+			vec.tab = vec.local();
+			vec.cap = N;
+		}
+		vec.cnt = 0;
+	}
+
+	T *tab;
+	int cap, cnt;
+	alignas(T) char buf[N * sizeof(T)];
+};
+
+}	// elm
+
+#endif /* ELM_DATA_SMALLVECTOR_H_ */
@@ -23,22 +23,24 @@
 
 #include <elm/utility.h>
 #include <elm/PreIterator.h>
+#include <elm/avl/GenTree.h>
 #include <elm/data/Vector.h>
-#include <elm/data/VectorQueue.h>
-#include <elm/inhstruct/BinTree.h>
 #include <elm/compare.h>
 #include <elm/adapter.h>
+#include <utility>
 
 namespace elm {
 
 template <class T, class C = Comparator<T>, class A = DefaultAlloc >
-class TreeBag: public C, public A {
+class TreeBag: private avl::AbstractTree, public C, public A {
 private:
 
-	class Node: public inhstruct::BinTree::Node {
+	class Node: public avl::AbstractTree::Node {
 	public:
 		inline Node(const T& value): val(value) { }
 		T val;
+		inline Node *left(void) const { return static_cast<Node *>(_left); }
+		inline Node *right(void) const { return static_cast<Node *>(_right); }
 		inline void *operator new(size_t size, TreeBag<T, C, A> *t)
 			{ return t->A::allocate(size); }
 		inline void free(TreeBag<T, C, A> *t)
@@ -56,9 +58,9 @@ public:
 	A& allocator() { return *this; }
 
 	// Collection concept
-	inline int count(void) const { return root.count(); }
+	inline int count(void) const { return _cnt; }
 	inline bool contains(const T& x) const { return find(x) != nullptr; }
-	inline bool isEmpty(void) const { return root.isEmpty(); }
+	inline bool isEmpty(void) const { return _cnt == 0; }
  	inline operator bool(void) const { return !isEmpty(); }
 
  	template <class CC> bool containsAll(const CC& c) const
@@ -66,13 +68,12 @@ public:
 
 	class Iter: public PreIterator<Iter, const T&> {
 		friend class TreeBag;
-		inline Node *_(inhstruct::BinTree::Node *n) { return static_cast<Node *>(n); }
 	public:
 		inline Iter(const TreeBag& tree)
-			{ if(tree.root.root()) downLeft(_(tree.root.root())); }
+			{ if(tree.root()) downLeft(tree.root()); }
 		bool ended(void) const { return !s; }
 		void next(void)
-			{	if(s.top()->right()) downLeft(_(s.top()->right()));
+			{	if(s.top()->right()) downLeft(s.top()->right());
 				else { Node *n = s.pop(); if(s && n == s.top()->right()) upRight(n); } }
 		const T& item(void) const { return s.top()->val; }
 		inline bool equals(const Iter& i) const { return s == i.s; }
@@ -80,7 +81,7 @@ public:
 	private:
 		inline Iter() { }
 		inline void downLeft(Node *n)
-			{ s.push(n); while(s.top()->left()) s.push(_(s.top()->left())); }
+			{ s.push(n); while(s.top()->left()) s.push(s.top()->left()); }
 		inline void upRight(Node *n)
 			{ while(s && s.top()->right() == n) n = s.pop(); }
 		Vector<Node *> s;
@@ -92,7 +93,7 @@ public:
 	inline bool equals(const TreeBag<T, C>& t) const {
 		Iter i(*this), j(t);
 		while(i() && j()) {
-			if(comparator().doComparator(*i, *j) != 0)
+			if(C::doCompare(*i, *j) != 0)
 				return false;
 			i++, j++;
 		}
@@ -105,72 +106,66 @@ public:
 	void clear(void)  {
 		if(isEmpty())
 			return;
-		VectorQueue<Node *> todo;
-		todo.put((Node *)root.root());
+		Vector<Node *> todo;
+		todo.push(root());
 		while(todo) {
-			Node *node = todo.get();
+			Node *node = todo.pop();
 			if(node->left())
-				todo.put((Node *)node->left());
+				todo.push(node->left());
 			if(node->right())
-				todo.put((Node *)node->right());
+				todo.push(node->right());
 			node->free(this);
 		}
+		_root = nullptr;
+		_cnt = 0;
 	}
 
-
 	void add(const T &x) {
-		Node *node = (Node *)root.root();
-		Node *new_node = new(this) Node(x);
-		if(!node)
-			root.setRoot(new_node);
-		else
-			while(node) {
-				int cmp = C::doCompare(x, node->val);
-				if(cmp >= 0) {
-					if(!node->right()) {
-						node->insertRight(new_node);
-						break;
-					}
-					else
-						node = (Node *)node->right();
-				}
-				else {
-					if(!node->left()) {
-						node->insertLeft(new_node);
-						break;
-					}
-					else
-						node = (Node *)node->left();
-				}
+		Stack s;
+		for(Node *node = root(); node;)
+			if(C::doCompare(x, node->val) >= 0) {
+				s.push(node, RIGHT);
+				node = node->right();
+			}
+			else {
+				s.push(node, LEFT);
+				node = node->left();
 			}
+		insert(s, new(this) Node(x));
 	}
 
 	template <class CC> void addAll (const CC &c)
 		{ for(const auto& x: c) add(x); }
+
 	void remove(const T& x) {
-		Node *node = (Node *)root.root(), *parent = 0;
+		Stack s;
+		Node *node = root();
 		while(true) {
 			ASSERT(node);
-			int cmp = C::compare(x, node->val);
+			int cmp = C::doCompare(x, node->val);
 			if(cmp == 0)
 				break;
-			parent = node;
-			if(cmp > 0)
-				node = (Node *)node->right();
-			else
-				node = (Node *)node->left();
+			else if(cmp > 0) {
+				s.push(node, RIGHT);
+				node = node->right();
+			}
+			else {
+				s.push(node, LEFT);
+				node = node->left();
+			}
 		}
-		Node *left = (Node *)node->left(), *right = (Node *)node->right();
-		node->free(this);
-		if(!left)
-			replace(parent, node, right);
-		else if(!right)
-			replace(parent, node, left);
+		if(!node->left())
+			AbstractTree::remove(s, node->right());
+		else if(!node->right())
+			AbstractTree::remove(s, node->left());
 		else {
-			replace(parent, node, left);
-			for(node = left; node->right(); node = (Node *)node->right());
-			node->insertRight(right);
+			s.push(node, RIGHT);
+			Node *next = static_cast<Node *>(leftMost(s, node->right()));
+			std::swap(node->val, next->val);
+			AbstractTree::remove(s, next->right());
+			node = next;
 		}
+		node->free(this);
 	}
 
 	template <class CC> void removeAll(const CC &c)
@@ -178,38 +173,31 @@ public:
 	inline void remove(const Iter &iter) { remove(*iter); }
 
 	void copy(const TreeBag<T, C>& t) {
-		// TODO improve it!
+		if(&t == this)
+			return;
 		clear();
 		addAll(t);
 	}
+	inline TreeBag<T, C, A>& operator=(const TreeBag<T, C, A>& t) { copy(t); return *this; }
 
 	const T *find(const T& x) const {
-		Node *node = (Node *)root.root();
+		Node *node = root();
 		while(node) {
-			int cmp = C::compare(x, node->val);
+			int cmp = C::doCompare(x, node->val);
 			if(cmp == 0)
 				return &node->val;
 			else if(cmp > 0)
-				node = (Node *)node->right();
+				node = node->right();
 			else
-				node = (Node *)node->left();
+				node = node->left();
 		}
 		return nullptr;
 	}
 
 private:
-	inhstruct::BinTree root;
-
-	void replace(Node *parent, Node *old, Node *_new)  {
-		if(!parent)
-			root.setRoot(_new);
-		else if(parent->left() == old)
-			parent->insertLeft(_new);
-		else
-			parent->insertRight(_new);
-	}
+	inline Node *root(void) const { return static_cast<Node *>(_root); }
 };
 
 } // elm
 
-#endif // ELM_GENSTRUCT_SORTEDBINTREE_H
+#endif // ELM_DATA_TREEBAG_H
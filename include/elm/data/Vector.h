@@ -27,6 +27,7 @@
 
 #include <elm/array.h>
 #include <elm/compat.h>
+#include <utility>
 
 namespace elm {
 
@@ -36,13 +37,17 @@ class Vector: public E, public A {
 		{	T *t = static_cast<T *>(A::allocate(size * sizeof(T)));
 			array::construct(t, size); return t; }
 	inline void deleteVec(T *t, int size) { array::destruct(t, size); A::free(t); }
+	inline void enlarge(void) { if(cnt >= cap) grow(cap ? cap * 2 : 8); }
 
 public:
 	typedef T t;
 	typedef Vector<T, E, A> self_t;
 
-	inline Vector(int _cap = 8): tab(newVec(_cap)), cap(_cap), cnt(0) { }
+	inline Vector(void): tab(nullptr), cap(0), cnt(0) { }
+	inline Vector(int _cap): tab(newVec(_cap)), cap(_cap), cnt(0) { }
 	inline Vector(const Vector<T>& vec): tab(0), cap(0), cnt(0) { copy(vec); }
+	inline Vector(self_t&& vec): tab(vec.tab), cap(vec.cap), cnt(vec.cnt)
+		{ vec.tab = nullptr; vec.cap = 0; vec.cnt = 0; }
 	inline ~Vector(void) { if(tab) deleteVec(tab, cap); }
 	inline const E& equivalence() const { return *this; }
 	inline E& equivalence() { return *this; }
@@ -53,15 +58,22 @@ public:
 	inline Array<const T> asArray(void) const { return Array<const T>(count(), tab); }
 	inline Array<T> asArray(void) { return Array<T>(count(), tab); }
 	inline Array<T> detach(void)
-		{ T *rt = tab; int rc = cnt; tab = 0; cnt = 0; return Array<T>(rc, rt); }
-	void grow(int new_cap)
-		{	ASSERTP(new_cap >= cap, "new capacity must be bigger than old one");
-			T *new_tab = newVec(new_cap); array::copy(new_tab, tab, cnt); deleteVec(tab, cap); tab = new_tab; cap = new_cap; }
+		{ T *rt = tab; int rc = cnt; tab = 0; cap = 0; cnt = 0; return Array<T>(rc, rt); }
+	void grow(int new_cap) {
+		ASSERTP(new_cap >= cap, "new capacity must be bigger than old one");
+		T *new_tab = static_cast<T *>(A::allocate(new_cap * sizeof(T)));
+		array::transfer(new_tab, tab, cnt);
+		array::construct(new_tab + cnt, new_cap - cnt);
+		if(tab) { array::destruct(tab + cnt, cap - cnt); A::free(tab); }
+		tab = new_tab; cap = new_cap;
+	}
 	void setLength(int new_length)
 		{	int new_cap; ASSERTP(new_length >= 0, "new length must be >= 0");
 			for(new_cap = 1; new_cap < new_length; new_cap *= 2);
 			if (new_cap > cap) grow(new_cap); cnt = new_length; }
-	inline T& addNew(void) { if(cnt >= cap) grow(cap * 2); return tab[cnt++]; }
+	inline T& addNew(void) { enlarge(); return tab[cnt++]; }
+	template <class... Args> inline T& emplace(Args&&... args)
+		{ enlarge(); T *p = tab + cnt++; p->~T(); return *new((void *)p) T(std::forward<Args>(args)...); }
 
 	class PreIter {
 		friend class Vector;
@@ -112,7 +124,8 @@ public:
 	inline MutIter end() { return MutIter(*this, count()); }
 
 	inline void clear(void) { cnt = 0; }
-	void add(const T& v) { if(cnt >= cap) grow(cap * 2); tab[cnt++] = v; }
+	void add(const T& v) { enlarge(); tab[cnt++] = v; }
+	void add(T&& v) { enlarge(); tab[cnt++] = std::move(v); }
 	template <class C> inline void addAll(const C& c)
 		{ for(typename C::Iter i(c); i(); i++) add(*i); }
 	inline void remove(const T& value) { int i = indexOf(value); if(i >= 0) removeAt(i); }
@@ -125,6 +138,14 @@ public:
 		{	if(!tab || vec.cnt > cap) { if(tab) deleteVec(tab, cap); cap = vec.cap; tab = newVec(vec.cap); }
 			cnt = vec.cnt; array::copy(tab, vec.tab, cnt); }
 	inline Vector<T>& operator=(const Vector& vec) { copy(vec); return *this; };
+	inline self_t& operator=(self_t&& vec) {
+		if(this != &vec) {
+			if(tab) deleteVec(tab, cap);
+			tab = vec.tab; cap = vec.cap; cnt = vec.cnt;
+			vec.tab = nullptr; vec.cap = 0; vec.cnt = 0;
+		}
+		return *this;
+	}
 
 	// Array concept
 	inline int length(void) const { return count(); }
@@ -151,12 +172,16 @@ public:
 	inline T & operator[](const Iter& i) { return get(i); }
 	void insert(int i, const T& v)
 		{	ASSERTP(0 <= i && i <= cnt, "index out of bounds");
-			if(cnt >= cap) grow(cap * 2); array::move(tab + i + 1, tab + i, cnt - i);
+			enlarge(); array::relocate(tab + i + 1, tab + i, cnt - i);
 			tab[i] = v; cnt++; }
+	void insert(int i, T&& v)
+		{	ASSERTP(0 <= i && i <= cnt, "index out of bounds");
+			enlarge(); array::relocate(tab + i + 1, tab + i, cnt - i);
+			tab[i] = std::move(v); cnt++; }
 	inline void insert(const Iter &i, const T &v) { insert(i.i, v); }
 	void removeAt(int i)
 		{ ASSERTP(0 <= i && i <= cnt, "index out of bounds");
-		  array::move(tab + i, tab + i + 1, cnt - i - 1); cnt--; }
+		  array::relocate(tab + i, tab + i + 1, cnt - i - 1); cnt--; }
 	inline void removeAt(const Iter& i) { removeAt(i.i); }
 
 	// List concept
@@ -173,6 +198,7 @@ public:
 	inline T& last() { ASSERT(cnt > 0); return tab[cnt - 1]; }
 	inline void addFirst(const T &v) { insert(0, v); }
 	inline void addLast(const T &v) { add(v); }
+	inline void addLast(T&& v) { add(std::move(v)); }
 	inline void removeFirst(void) { removeAt(0); }
 	inline void removeLast(void) { removeAt(cnt - 1); }
 	inline void addAfter(const Iter &i, const T &v) { insert(i.i + 1, v); }
@@ -183,8 +209,9 @@ public:
 	// Stack concept
 	inline const T &top(void) const { return last(); }
 	inline T &top(void) { return tab[cnt - 1]; }
-	inline T pop(void) { ASSERTP(cnt > 0, "no more data to pop"); cnt--; return tab[cnt]; }
+	inline T pop(void) { ASSERTP(cnt > 0, "no more data to pop"); cnt--; return std::move(tab[cnt]); }
 	inline void push(const T &v) { add(v); }
+	inline void push(T&& v) { add(std::move(v)); }
 	inline void reset(void) { clear(); }
 
 	// deprecated
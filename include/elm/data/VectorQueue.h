@@ -21,6 +21,7 @@
 #ifndef ELM_DATA_VECTORQUEUE_H
 #define ELM_DATA_VECTORQUEUE_H
 
+#include <elm/array.h>
 #include <elm/assert.h>
 #include "../equiv.h"
 
@@ -65,12 +66,10 @@ template <class T, class E> void VectorQueue<T, E>::enlarge(void) {
 	T *new_buffer = new T[new_cap];
 	if( hd > tl) {
 		off = cap - hd;
-		for(int i = 0; i  < off; i++)
-			new_buffer[i] = buffer[hd + i];
+		array::relocate(new_buffer, buffer + hd, off);
 		hd = 0;
 	}
-	for(int i = hd; i < tl; i++)
-		new_buffer[off + i - hd] = buffer[i];
+	array::relocate(new_buffer + off, buffer + hd, tl - hd);
 	delete [] buffer;
 	tl = off + tl - hd;
 	cap = new_cap;
@@ -0,0 +1,248 @@
+/*
+ *	parallel algorithms
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_DATA_PAR_H_
+#define ELM_DATA_PAR_H_
+
+#include <elm/data/FragTable.h>
+#include <elm/data/quicksort.h>
+#include <elm/data/util.h>
+#include <elm/data/Vector.h>
+#include <elm/sys/ThreadPool.h>
+
+namespace elm { namespace par {
+
+const int SORT_THRESHOLD = 1 << 14;
+const int GRAIN = 1 << 12;
+
+namespace impl {
+
+// number of chunks to process n items
+inline int chunks(int n, sys::ThreadPool& pool) {
+	int k = (n + GRAIN - 1) / GRAIN, m = 4 * pool.threadCount();
+	return k < m ? k : m;
+}
+
+// split [0, n[ in k chunks and call f(j, lo, hi) for each chunk j in parallel
+template <class F>
+void split(int n, int k, sys::ThreadPool& pool, F f) {
+	if(k <= 1) {
+		f(0, 0, n);
+		return;
+	}
+	pool.forEach(k, [&](int i) {
+		f(i, int(t::int64(n) * i / k), int(t::int64(n) * (i + 1) / k));
+	});
+}
+
+// add n items at the end of an array
+template <class D>
+inline void extend(D& d, int n) { d.setLength(d.count() + n); }
+template <class T, class E, class A>
+inline void extend(FragTable<T, E, A>& d, int n) { d.alloc(n); }
+
+// number of items taken from [lo, m[ in the k first items of the stable merge of [lo, m[ and [m, hi[
+template <class A, class C>
+int corank(A& a, int lo, int m, int hi, int k, const C& c) {
+	int nl = m - lo, nr = hi - m;
+	int l = k - nr > 0 ? k - nr : 0, h = k < nl ? k : nl;
+	while(l < h) {
+		int i = (l + h) >> 1, j = k - i;
+		if(j > 0 && c.doCompare(a[lo + i], a[m + j - 1]) <= 0)
+			l = i + 1;
+		else
+			h = i;
+	}
+	return l;
+}
+
+// merge part [k1, k2[ of the output of merge of [lo, m[ and [m, hi[ into b + lo
+template <class A, class T, class C>
+void mergePart(A& a, int lo, int m, int hi, int k1, int k2, T *b, const C& c) {
+	int i = lo + corank(a, lo, m, hi, k1, c), ie = lo + corank(a, lo, m, hi, k2, c);
+	int j = m + k1 - (i - lo), je = m + k2 - (ie - lo);
+	T *o = b + lo + k1;
+	while(i < ie && j < je) {
+		if(c.doCompare(a[j], a[i]) < 0)
+			*o++ = std::move(a[j++]);
+		else
+			*o++ = std::move(a[i++]);
+	}
+	while(i < ie)
+		*o++ = std::move(a[i++]);
+	while(j < je)
+		*o++ = std::move(a[j++]);
+}
+
+}	// impl
+
+// forEach operation
+template <class C, class F>
+void forEach(C& c, const F& f, sys::ThreadPool& pool = sys::ThreadPool::shared()) {
+	int n = c.count();
+	impl::split(n, impl::chunks(n, pool), pool, [&](int, int lo, int hi) {
+		for(int i = lo; i < hi; i++)
+			f(c[i]);
+	});
+}
+
+
+// count operation
+template <class C, class P>
+int count(const C& c, const P& p, sys::ThreadPool& pool = sys::ThreadPool::shared()) {
+	int n = c.count(), k = impl::chunks(n, pool);
+	Vector<int> r;
+	r.setLength(k > 1 ? k : 1);
+	impl::split(n, k, pool, [&](int j, int lo, int hi) {
+		int s = 0;
+		for(int i = lo; i < hi; i++)
+			if(p(c[i]))
+				s++;
+		r[j] = s;
+	});
+	int s = 0;
+	for(auto x: r)
+		s += x;
+	return s;
+}
+
+
+// map operation
+template <class C, class F, class D>
+void map(const C& c, const F& f, D& d, sys::ThreadPool& pool = sys::ThreadPool::shared()) {
+	int n = c.count(), b = d.count();
+	impl::extend(d, n);
+	impl::split(n, impl::chunks(n, pool), pool, [&](int, int lo, int hi) {
+		for(int i = lo; i < hi; i++)
+			d[b + i] = f(c[i]);
+	});
+}
+
+
+// fold operation (f must be associative)
+template <class C, class F, class T>
+T fold(const C& c, const F& f, T t, sys::ThreadPool& pool = sys::ThreadPool::shared()) {
+	int n = c.count(), k = impl::chunks(n, pool);
+	if(n == 0)
+		return t;
+	Vector<T> r;
+	r.setLength(k > 1 ? k : 1);
+	impl::split(n, k, pool, [&](int j, int lo, int hi) {
+		T a = c[lo];
+		for(int i = lo + 1; i < hi; i++)
+			a = f(c[i], a);
+		r[j] = a;
+	});
+	for(const auto& x: r)
+		t = f(x, t);
+	return t;
+}
+
+
+// reduce operation (f must be associative)
+template <class C, class F, class T>
+T reduce(const C& c, const F& f, T t, sys::ThreadPool& pool = sys::ThreadPool::shared()) {
+	int n = c.count(), k = impl::chunks(n, pool);
+	if(n == 0)
+		return t;
+	Vector<T> r;
+	r.setLength(k > 1 ? k : 1);
+	impl::split(n, k, pool, [&](int j, int lo, int hi) {
+		T a = c[lo];
+		for(int i = lo + 1; i < hi; i++)
+			a = f(a, c[i]);
+		r[j] = a;
+	});
+	for(const auto& x: r)
+		t = f(t, x);
+	return t;
+}
+
+template <class C, class F>
+inline typename F::y_t reduce(const C& c, const F& f, sys::ThreadPool& pool = sys::ThreadPool::shared())
+	{ return reduce(c, f, F::null, pool); }
+template <class C>
+inline typename C::t sum(const C& c, sys::ThreadPool& pool = sys::ThreadPool::shared())
+	{ return reduce(c, Add<typename C::t>(), pool); }
+template <class C>
+inline typename C::t product(const C& c, sys::ThreadPool& pool = sys::ThreadPool::shared())
+	{ return reduce(c, Mul<typename C::t>(), pool); }
+
+
+// parallel stable merge sort
+template <class A, class C = Comparator<typename A::t> >
+void mergesort(A& array, const C& c = Comparator<typename A::t>(), sys::ThreadPool& pool = sys::ThreadPool::shared()) {
+	typedef typename A::t T;
+	int n = array.count(), p = pool.threadCount();
+	if(p == 1 || n < SORT_THRESHOLD) {
+		elm::mergesort(array, c);
+		return;
+	}
+
+	// sort the chunks
+	int k = 1;
+	while(k < 2 * p)
+		k <<= 1;
+	int w = (n + k - 1) / k;
+	T *b = new T[n];
+	pool.forEach(k, [&](int i) {
+		int lo = i * w, hi = lo + w < n ? lo + w : n;
+		if(lo < hi)
+			sort::mergesort(array, lo, hi, b + lo, c);
+	});
+
+	// merge by rounds
+	for(; w < n; w *= 2) {
+		int m = (n + 2 * w - 1) / (2 * w);
+
+		// enough pairs: one in-place merge per pair
+		if(m >= p)
+			pool.forEach(m, [&](int i) {
+				int lo = i * 2 * w, mid = lo + w, hi = mid + w < n ? mid + w : n;
+				if(mid < hi)
+					sort::merge(array, lo, mid, hi, b + lo, c);
+			});
+
+		// else split each merge in q parts merged in b and copied back
+		else {
+			int q = (2 * p + m - 1) / m;
+			pool.forEach(m * q, [&](int i) {
+				int lo = (i / q) * 2 * w, mid = lo + w, hi = mid + w < n ? mid + w : n;
+				if(mid >= hi)
+					return;
+				t::int64 s = hi - lo, r = i % q;
+				impl::mergePart(array, lo, mid, hi, int(s * r / q), int(s * (r + 1) / q), b, c);
+			});
+			pool.forEach(m * q, [&](int i) {
+				int lo = (i / q) * 2 * w, mid = lo + w, hi = mid + w < n ? mid + w : n;
+				if(mid >= hi)
+					return;
+				t::int64 s = hi - lo, r = i % q;
+				for(int j = lo + int(s * r / q); j < lo + int(s * (r + 1) / q); j++)
+					array[j] = std::move(b[j]);
+			});
+		}
+	}
+	delete [] b;
+}
+
+} }	// elm::par
+
+#endif /* ELM_DATA_PAR_H_ */
@@ -22,34 +22,179 @@
 #define ELM_QUICKSORT_H_
 
 #include <elm/compare.h>
+#include <utility>
 
 namespace elm {
 
-// quick sort
-template <class A, class C = Comparator<typename A::t> >
-void quicksort(A& array, const C& c = Comparator<typename A::t>()) {
-	static const int max = 300;
-	int beg[max], end[max], i = 0, L, R, swap;
-	typename A::t piv;
-
-	beg[0] = 0; end[0] = array.count();
-	while(i >= 0) {
-		L = beg[i]; R = end[i] - 1;
-		if(L < R) {
-			piv = array[L];
-			while(L < R) {
-				while(c.doCompare(array[R], piv) >= 0 && L < R) R--; if(L < R) array[L++] = array[R];
-				while(c.doCompare(array[L], piv) <= 0 && L<R) L++; if (L < R) array[R--] = array[L];
-			}
-			array[L] = piv; beg[i+1] = L+1; end[i+1] = end[i]; end[i++] = L;
-			if(end[i] - beg[i] > end[i-1] - beg[i-1]) {
-				swap = beg[i]; beg[i] = beg[i-1]; beg[i-1] = swap;
-				swap = end[i]; end[i] = end[i-1]; end[i-1] = swap;
-			}
+namespace sort {
+
+const int CUTOFF = 16;
+
+template <class A>
+inline void swap(A& a, int i, int j)
+	{ typename A::t x = std::move(a[i]); a[i] = std::move(a[j]); a[j] = std::move(x); }
+
+// stable insertion sort of [lo, hi[
+template <class A, class C>
+void insertion(A& a, int lo, int hi, const C& c) {
+	for(int i = lo + 1; i < hi; i++)
+		if(c.doCompare(a[i], a[i - 1]) < 0) {
+			typename A::t x = std::move(a[i]);
+			int j = i;
+			do {
+				a[j] = std::move(a[j - 1]);
+				j--;
+			} while(j > lo && c.doCompare(x, a[j - 1]) < 0);
+			a[j] = std::move(x);
+		}
+}
+
+// heap sort of [lo, hi[
+template <class A, class C>
+void sift(A& a, int lo, int i, int n, const C& c) {
+	typename A::t x = std::move(a[lo + i]);
+	while(true) {
+		int ch = 2 * i + 1;
+		if(ch >= n)
+			break;
+		if(ch + 1 < n && c.doCompare(a[lo + ch], a[lo + ch + 1]) < 0)
+			ch++;
+		if(c.doCompare(x, a[lo + ch]) >= 0)
+			break;
+		a[lo + i] = std::move(a[lo + ch]);
+		i = ch;
+	}
+	a[lo + i] = std::move(x);
+}
+
+template <class A, class C>
+void heapsort(A& a, int lo, int hi, const C& c) {
+	int n = hi - lo;
+	for(int i = n / 2 - 1; i >= 0; i--)
+		sift(a, lo, i, n, c);
+	for(int k = n - 1; k > 0; k--) {
+		swap(a, lo, lo + k);
+		sift(a, lo, 0, k, c);
+	}
+}
+
+// order a[i], a[j], a[k] so that a[j] is the median
+template <class A, class C>
+inline void median(A& a, int i, int j, int k, const C& c) {
+	if(c.doCompare(a[j], a[i]) < 0)
+		swap(a, i, j);
+	if(c.doCompare(a[k], a[j]) < 0) {
+		swap(a, j, k);
+		if(c.doCompare(a[j], a[i]) < 0)
+			swap(a, i, j);
+	}
+}
+
+template <class A, class C>
+void introsort(A& a, int lo, int hi, int depth, const C& c) {
+	while(hi - lo > CUTOFF) {
+		if(depth == 0) {
+			heapsort(a, lo, hi, c);
+			return;
+		}
+		depth--;
+
+		// pivot: median of 3 or ninther for big ranges
+		int m = lo + (hi - lo) / 2;
+		if(hi - lo > 128) {
+			int s = (hi - lo) / 8;
+			median(a, lo, lo + s, lo + 2 * s, c);
+			median(a, m - s, m, m + s, c);
+			median(a, hi - 1 - 2 * s, hi - 1 - s, hi - 1, c);
+			median(a, lo + s, m, hi - 1 - s, c);
 		}
 		else
-			i--;
+			median(a, lo, m, hi - 1, c);
+		swap(a, lo, m);
+
+		// Hoare partition (stops on equal items to balance duplicates)
+		int i = lo, j = hi;
+		while(true) {
+			do i++; while(i < hi && c.doCompare(a[i], a[lo]) < 0);
+			do j--; while(c.doCompare(a[lo], a[j]) < 0);
+			if(i >= j)
+				break;
+			swap(a, i, j);
+		}
+		swap(a, lo, j);
+
+		// recurse on the smaller part, loop on the bigger one
+		if(j - lo < hi - j - 1) {
+			introsort(a, lo, j, depth, c);
+			lo = j + 1;
+		}
+		else {
+			introsort(a, j + 1, hi, depth, c);
+			hi = j;
+		}
+	}
+	insertion(a, lo, hi, c);
+}
+
+// merge [lo, m[ and [m, hi[ using buffer b
+template <class A, class T, class C>
+void merge(A& a, int lo, int m, int hi, T *b, const C& c) {
+	if(c.doCompare(a[m - 1], a[m]) <= 0)
+		return;
+	int n = m - lo;
+	for(int i = 0; i < n; i++)
+		b[i] = std::move(a[lo + i]);
+	int i = 0, j = m, k = lo;
+	while(i < n && j < hi) {
+		if(c.doCompare(a[j], b[i]) < 0)
+			a[k++] = std::move(a[j++]);
+		else
+			a[k++] = std::move(b[i++]);
+	}
+	while(i < n)
+		a[k++] = std::move(b[i++]);
+}
+
+// stable sort of [lo, hi[ using buffer b of mergeBuffer(hi - lo) items
+template <class A, class T, class C>
+void mergesort(A& a, int lo, int hi, T *b, const C& c) {
+	for(int l = lo; l < hi; l += CUTOFF)
+		insertion(a, l, l + CUTOFF < hi ? l + CUTOFF : hi, c);
+	for(int w = CUTOFF; w < hi - lo; w *= 2)
+		for(int l = lo; l + w < hi; l += 2 * w)
+			merge(a, l, l + w, l + 2 * w < hi ? l + 2 * w : hi, b, c);
+}
+
+// size of the buffer needed by mergesort() on n items
+inline int mergeBuffer(int n) {
+	int w = CUTOFF;
+	while(w * 2 < n)
+		w *= 2;
+	return w;
+}
+
+}	// sort
+
+// quick sort (introsort)
+template <class A, class C = Comparator<typename A::t> >
+void quicksort(A& array, const C& c = Comparator<typename A::t>()) {
+	int n = array.count(), d = 0;
+	for(int i = n; i > 1; i >>= 1)
+		d += 2;
+	sort::introsort(array, 0, n, d, c);
+}
+
+// stable merge sort
+template <class A, class C = Comparator<typename A::t> >
+void mergesort(A& array, const C& c = Comparator<typename A::t>()) {
+	int n = array.count();
+	if(n <= sort::CUTOFF) {
+		sort::insertion(array, 0, n, c);
+		return;
 	}
+	typename A::t *b = new typename A::t[sort::mergeBuffer(n)];
+	sort::mergesort(array, 0, n, b, c);
+	delete [] b;
 }
 
 } // elm
@@ -0,0 +1,95 @@
+/*
+ * radix sort implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_RADIXSORT_H_
+#define ELM_RADIXSORT_H_
+
+#include <type_traits>
+#include <elm/adapter.h>
+#include <elm/int.h>
+
+namespace elm {
+
+namespace radix {
+
+// conversion of integral and pointer keys to unsigned ordered keys
+template <class T, bool P = std::is_pointer<T>::value>
+struct key {
+	typedef typename std::make_unsigned<T>::type u_t;
+	static inline u_t get(T x)
+		{ return u_t(x) ^ (std::is_signed<T>::value ? u_t(1) << (sizeof(T) * 8 - 1) : u_t(0)); }
+};
+template <class T>
+struct key<T, true> {
+	typedef t::intptr u_t;
+	static inline u_t get(T x) { return t::intptr(x); }
+};
+
+}	// radix
+
+// LSD radix sort
+template <class A, class K = IdAdapter<typename A::t> >
+void radixsort(A& array, const K& adapter = K()) {
+	typedef typename A::t T;
+	typedef radix::key<typename K::key_t> key_t;
+	typedef typename key_t::u_t u_t;
+	const int D = sizeof(u_t);
+	int n = array.count();
+	if(n < 2)
+		return;
+
+	// compute the histograms of all digits in one pass
+	int *h = new int[D * 256]();
+	for(int i = 0; i < n; i++) {
+		u_t k = key_t::get(adapter.key(array[i]));
+		for(int d = 0; d < D; d++)
+			h[d * 256 + ((k >> (d * 8)) & 0xff)]++;
+	}
+
+	// scatter by digit (skipping digits shared by all items)
+	T *src = new T[n], *dst = new T[n];
+	for(int i = 0; i < n; i++)
+		src[i] = std::move(array[i]);
+	for(int d = 0; d < D; d++) {
+		int *hd = h + d * 256;
+		if(hd[(key_t::get(adapter.key(src[0])) >> (d * 8)) & 0xff] == n)
+			continue;
+		for(int i = 0, s = 0; i < 256; i++) {
+			int c = hd[i];
+			hd[i] = s;
+			s += c;
+		}
+		for(int i = 0; i < n; i++)
+			dst[hd[(key_t::get(adapter.key(src[i])) >> (d * 8)) & 0xff]++] = std::move(src[i]);
+		T *t = src;
+		src = dst;
+		dst = t;
+	}
+	for(int i = 0; i < n; i++)
+		array[i] = std::move(src[i]);
+
+	delete [] src;
+	delete [] dst;
+	delete [] h;
+}
+
+}	// elm
+
+#endif /* ELM_RADIXSORT_H_ */
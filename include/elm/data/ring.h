@@ -0,0 +1,58 @@
+/*
+ *	concurrent ring buffer helpers
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_DATA_RING_H_
+#define ELM_DATA_RING_H_
+
+#include <thread>
+#include <elm/types.h>
+
+namespace elm { namespace ring {
+
+const int CACHE_LINE = 64;
+
+inline int roundSize(int n) {
+	int s = 2;
+	while(s < n)
+		s <<= 1;
+	return s;
+}
+
+class Backoff {
+public:
+	static const int SPINS = 64;
+	inline Backoff(void): n(0) { }
+	inline void wait(void) {
+		if(n < SPINS) {
+			n++;
+#			if defined(__x86_64__) || defined(__i386__)
+				__builtin_ia32_pause();
+#			endif
+		}
+		else
+			std::this_thread::yield();
+	}
+private:
+	int n;
+};
+
+} }	// elm::ring
+
+#endif /* ELM_DATA_RING_H_ */
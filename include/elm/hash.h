@@ -45,6 +45,13 @@ inline t::hash hash_ptr(const void *p) {
 #	endif
 }
 bool hash_equals(const void *p1, const void *p2, int size);
+inline t::uint64 hash_mix(t::hash h) {
+	t::uint64 x = t::uint64(h);
+	x ^= x >> 33;
+	x *= 0xff51afd7ed558ccdULL;
+	x ^= x >> 33;
+	return x;
+}
 
 // HashKey class
 template <class T> class HashKey {
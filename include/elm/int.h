@@ -40,8 +40,17 @@ inline int countOnes(t::uint32 i) { return ones(t::uint16(i)) + ones(t::uint16(i
 inline int countOnes(t::uint64 i) { return ones(t::uint32(i)) + ones(t::uint32(i >> 32)); }
 #endif
 
+int countOnes(const t::uint64 *w, int n);
+
 int msb(t::uint32 i);
 inline int msb(t::int32 i) { return msb(t::uint32(i)); }
+#ifdef __GNUC__
+inline int lsb(t::uint32 i) { return i == 0 ? -1 : __builtin_ctz(i); }
+inline int lsb(t::uint64 i) { return i == 0 ? -1 : __builtin_ctzll(i); }
+#else
+int lsb(t::uint32 i);
+inline int lsb(t::uint64 i) { t::uint32 lw = t::uint32(i); return lw ? lsb(lw) : (i ? lsb(t::uint32(i >> 32)) + 32 : -1); }
+#endif
 int msb(t::uint64 i);
 inline int msb(t::int64 i) { return msb(t::uint64(i)); }
 t::uint32 leastUpperPowerOf2(t::uint32 v);
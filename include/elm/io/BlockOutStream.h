@@ -20,6 +20,8 @@ public:
 	inline BlockOutStream(int size = 4096, int inc = 256): _block(size, inc) { }
 	inline const char *block(void) const { return _block.base(); }
 	inline int size(void) const { return _block.size(); }
+	inline int capacity(void) const { return _block.capacity(); }
+	inline void reserve(int size) { _block.reserve(size); }
 	inline char *detach(void) { return _block.detach(); }
 	inline void clear(void) { _block.reset(); }
 	inline void setSize(int size) { _block.setSize(size); }
@@ -23,6 +23,7 @@
 
 #include "common.h"
 #include <elm/io.h>
+#include <elm/string/Symbol.h>
 #include <elm/sys/Path.h>
 
 namespace elm { namespace json {
@@ -40,6 +41,8 @@ public:
 	virtual void onValue(int value);
 	virtual void onValue(double value);
 	virtual void onValue(string value);
+	virtual bool usesSymbols(void) const;
+	virtual void onField(Symbol name);
 };
 
 class Parser {
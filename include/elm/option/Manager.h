@@ -23,7 +23,7 @@
 #define ELM_OPTION_MANAGER_H
 
 #include <elm/ptr.h>
-#include <elm/data/ListMap.h>
+#include <elm/data/FlatMap.h>
 #include <elm/data/Vector.h>
 #include <elm/option/Option.h>
 #include <elm/option/SwitchOption.h>
@@ -104,8 +104,8 @@ private:
 	void addShort(char cmd, Option *option);
 	void addLong(cstring cmd, Option *option);
 	void addCommand(string cmd, Option *option);
-	ListMap<char, Option *> shorts;
-	ListMap<string, Option *> cmds;
+	FlatMap<char, Option *> shorts;
+	FlatMap<string, Option *> cmds;
 	UniquePtr<SwitchOption> _help_opt, _version_opt;
 	Vector<string> _frees;
 };
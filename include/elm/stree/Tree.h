@@ -48,11 +48,32 @@ public:
 		T data;
 	} node_t;
 
-	inline Tree(void): root(-1), nodes(0) { }
-	inline Tree(int _root, node_t *_nodes): root(_root), nodes(_nodes) { }
-	inline void set(int _root, node_t *_nodes) { root = _root; nodes = _nodes; }
+	static const int BATCH = 8;
 
-	~Tree(void) { delete [] nodes; }
+	inline Tree(void): _cnt(0), _depth(0), _lb(), _ub(), _keys(nullptr), _data(nullptr) { }
+	inline Tree(int _root, node_t *_nodes): _cnt(0), _depth(0), _lb(), _ub(), _keys(nullptr), _data(nullptr) { set(_root, _nodes); }
+	~Tree(void) { clear(); }
+
+	void set(int _root, node_t *_nodes) {
+		clear();
+
+		// collect the leaves in key order
+		_cnt = countLeaves(_nodes, _root);
+		int *leaves = new int[_cnt], n = 0;
+		collect(_nodes, _root, leaves, n);
+		_lb = _nodes[_root].lowerBound();
+		_ub = _nodes[_root].upperBound();
+
+		// store them in BFS (Eytzinger) order
+		_keys = new K[_cnt + 1];
+		_data = new T[_cnt + 1];
+		n = 0;
+		fill(_nodes, leaves, 1, n);
+		for(_depth = 0; (1 << _depth) <= _cnt; _depth++);
+
+		delete [] leaves;
+		delete [] _nodes;
+	}
 
 	inline const T& get(const K& key, const T& def) const
 		{ T *val = find(key); if(!val) return def; else return *val; }
@@ -61,42 +82,97 @@ public:
 	inline T& get(const K& key)
 		{ T *val = find(key); ASSERTP(val, "out of tree"); return *val; }
 	inline bool contains(const K& key) const
-		{ return C::compare(key, nodes[root].lowerBound()) >= 0 && C::compare(key, nodes[root].upperBound()) <= 0; }
+		{ return _cnt != 0 && C::compare(key, _lb) >= 0 && C::compare(key, _ub) <= 0; }
+	inline int count(void) const { return _cnt; }
+
+	void find(const K keys[], T *results[], int n) const {
+		ASSERTP(_keys, "uninitialized stree");
+		for(int b = 0; b < n; b += BATCH) {
+			int m = n - b < BATCH ? n - b : BATCH, is[BATCH];
+			const K *ks = keys + b;
+			for(int j = 0; j < m; j++)
+				is[j] = 1;
+			for(int l = 0; l < _depth; l++)
+				for(int j = 0; j < m; j++)
+					if(is[j] <= _cnt)
+						is[j] = step(is[j], ks[j]);
+			for(int j = 0; j < m; j++)
+				results[b + j] = contains(ks[j]) ? _data + leaf(is[j]) : nullptr;
+		}
+	}
 
 #	ifdef ELM_STREE_DEBUG
-		void dump(io::Output& out = cout, int i = -1, int t = 0) {
-			if(i < 0) i = root;
+		void dump(io::Output& out = cout, int i = 1, int t = 0) {
+			if(i > _cnt)
+				return;
+			dump(out, 2 * i, t + 1);
 			for(int j = 0; j < t; j++) out << "| ";
-			out << "|- ";
-			out << nodes[i].lowerBound() << " - " << nodes[i].upperBound();
-			if(nodes[i].isLeaf())
-				out << " -> " << nodes[i].data << io::endl;
-			else {
-				out << io::endl;
-				dump(out, nodes[i].left(), t + 1);
-				dump(out, nodes[i].right(), t + 1);
-			}
+			out << "|- " << _keys[i] << " -> " << _data[i] << io::endl;
+			dump(out, 2 * i + 1, t + 1);
 		}
 #	endif
 
 protected:
 	T *find(const K& key) const {
-		ASSERTP(nodes && root >= 0, "uninitialized stree");
-		int i = root;
+		ASSERTP(_keys, "uninitialized stree");
 		if(!contains(key))
-			return 0;
-		while(!nodes[i].isLeaf()) {
-			if(C::compare(key, nodes[nodes[i].right()].lowerBound()) < 0)
-				i = nodes[i].left();
-			else
-				i = nodes[i].right();
-		}
-		return &nodes[i].data;
+			return nullptr;
+		int i = 1;
+		while(i <= _cnt)
+			i = step(i, key);
+		return _data + leaf(i);
 	}
 
 private:
-	int root;
-	node_t *nodes;
+
+	// go down one level: right if the key is after the node lower bound
+	inline int step(int i, const K& key) const {
+		if(i <= _cnt >> 4)
+			__builtin_prefetch(_keys + 16 * i);
+		return 2 * i + (C::compare(_keys[i], key) <= 0);
+	}
+
+	// the found leaf is the last node where the search went right
+	static inline int leaf(int i) { return i >> (__builtin_ctz(i) + 1); }
+
+	static int countLeaves(node_t *nodes, int i) {
+		if(nodes[i].isLeaf())
+			return 1;
+		else
+			return countLeaves(nodes, nodes[i].left()) + countLeaves(nodes, nodes[i].right());
+	}
+
+	static void collect(node_t *nodes, int i, int *leaves, int& n) {
+		if(nodes[i].isLeaf())
+			leaves[n++] = i;
+		else {
+			collect(nodes, nodes[i].left(), leaves, n);
+			collect(nodes, nodes[i].right(), leaves, n);
+		}
+	}
+
+	void fill(node_t *nodes, int *leaves, int k, int& n) {
+		if(k > _cnt)
+			return;
+		fill(nodes, leaves, 2 * k, n);
+		_keys[k] = nodes[leaves[n]].lowerBound();
+		_data[k] = nodes[leaves[n]].data;
+		n++;
+		fill(nodes, leaves, 2 * k + 1, n);
+	}
+
+	void clear(void) {
+		delete [] _keys;
+		delete [] _data;
+		_keys = nullptr;
+		_data = nullptr;
+		_cnt = 0;
+	}
+
+	int _cnt, _depth;
+	K _lb, _ub;
+	K *_keys;
+	T *_data;
 };
 
 } }	// elm::stree
@@ -21,6 +21,8 @@
 #ifndef ELM_STRING_STRING_H
 #define ELM_STRING_STRING_H
 
+#include <stdlib.h>
+#include <elm/arch.h>
 #include <elm/PreIterator.h>
 #include <elm/string/CString.h>
 
@@ -33,75 +35,98 @@ class String {
 
 	// Data structure
 	typedef struct buffer_t {
-		unsigned short use;
+		t::uint32 use;
 		char buf[1];
 	} buffer_t;
-	static buffer_t empty_buf;
-	static const int zero_off = sizeof(unsigned short);
-	mutable const char *buf;
-	mutable unsigned short off, len;
+	static const int zero_off = sizeof(t::uint32);
+	typedef struct heap_t {
+		const char *buf;
+		int off, len;
+	} heap_t;
+	static const int inline_size = 24;
+	static const int inline_max = inline_size - 1;
+	static const char heap_tag = -1;
+	mutable union {
+		heap_t h;
+		char in[inline_size];
+	} u;
 
 	// Internals
 	void copy(const char *str, int _len);
-	void lock(void) const { ((buffer_t *)buf)->use++; }
+#	ifdef ELM_NO_STRING_ATOMIC
+		static inline void incUse(buffer_t *b) { b->use++; }
+		static inline bool decUse(buffer_t *b) { return --b->use == 0; }
+		static inline t::uint32 getUse(const buffer_t *b) { return b->use; }
+#	else
+		static inline void incUse(buffer_t *b) { __atomic_add_fetch(&b->use, 1, __ATOMIC_RELAXED); }
+		static inline bool decUse(buffer_t *b) { return __atomic_sub_fetch(&b->use, 1, __ATOMIC_ACQ_REL) == 0; }
+		static inline t::uint32 getUse(const buffer_t *b) { return __atomic_load_n(&b->use, __ATOMIC_ACQUIRE); }
+#	endif
+	inline bool isInline(void) const { return u.in[inline_max] != heap_tag; }
+	inline void setInline(const char *str, int _len) const
+		{ memcpy(u.in, str, _len); u.in[_len] = '\0'; u.in[inline_max] = char(inline_max - _len); }
+	inline void setHeap(const char *_buf, int _off, int _len) const
+		{ u.h.buf = _buf; u.h.off = _off; u.h.len = _len; u.in[inline_max] = heap_tag; }
+	void lock(void) const { if(!isInline()) incUse((buffer_t *)u.h.buf); }
 	void toc(void) const;
 	void unlock(void) const {
-		((buffer_t *)buf)->use--;
-		if(!((buffer_t *)buf)->use && buf != (char *)&empty_buf)
-			delete [] buf;
+		if(!isInline() && decUse((buffer_t *)u.h.buf))
+			::free((void *)u.h.buf);
 	}
-	inline String(const char *_buf, int _off, int _len): buf(_buf), off(_off), len(_len) { lock(); };
+	inline String(const char *_buf, int _off, int _len) { setHeap(_buf, _off, _len); lock(); };
 	static String concat(const char *s1, int l1, const char *s2, int l2);
-	inline String(buffer_t *buffer, int offset, int length)
-		: buf((char *)buffer), off(offset), len(length) { lock(); };
+	inline String(buffer_t *buffer, int offset, int length) { setHeap((char *)buffer, offset, length); lock(); };
 
 public:
 	static String make(char chr);
 	static String make(String chr, int n);
 
-	inline String(void): buf((char *)&empty_buf), off(zero_off), len(0) { lock(); };
+	inline String(void) { u.in[0] = '\0'; u.in[inline_max] = inline_max; };
 	inline String(const char *str, int _len) { copy(str, _len); };
 	inline String(const char *str) { if(!str) str = ""; copy(str, strlen(str)); };
 	inline String(cstring str) { copy(str.chars(), str.length()); };
-	inline String(const String& str): buf(str.buf), off(str.off), len(str.len) { lock(); };
+	inline String(const String& str): u(str.u) { lock(); };
 	inline ~String(void) { unlock(); };
 	inline String& operator=(const String& str)
-		{ str.lock(); unlock(); buf = str.buf; off = str.off; len = str.len; return *this; };
+		{ str.lock(); unlock(); u = str.u; return *this; };
 	inline String& operator=(const CString str)
 		{ unlock(); copy(str.chars(), str.length()); return *this; };
 	inline String& operator=(const char *str)
 		{ if(!str) str = ""; unlock(); copy(str, strlen(str)); return *this; };
 
-	inline int length(void) const { return len; };
-	inline const char *chars(void) const { return buf + off; };
+	inline int length(void) const { return isInline() ? inline_max - u.in[inline_max] : u.h.len; };
+	inline const char *chars(void) const { return isInline() ? u.in : u.h.buf + u.h.off; };
 	inline int compare(const String& str) const {
-		int res = memcmp(chars(), str.chars(), len > str.len ? str.len : len);
-		return res ? res : len - str.len;
+		int len = length(), slen = str.length();
+		int res = memcmp(chars(), str.chars(), len > slen ? slen : len);
+		return res ? res : len - slen;
 	};
 	inline int compare(const CString str) const {
-		int slen = str.length();
+		int len = length(), slen = str.length();
 		int res = memcmp(chars(), str.chars(), len > slen ? slen : len);
 		return res ? res : len - slen;
 	};
 
-	inline bool isEmpty(void) const { return !len; };
+	inline bool isEmpty(void) const { return !length(); };
 	inline operator bool(void) const { return !isEmpty(); };
 
-	inline CString toCString(void) const { if(buf[off + len] != '\0') toc(); return chars(); };
+	inline CString toCString(void) const
+		{ if(!isInline() && u.h.buf[u.h.off + u.h.len] != '\0') toc(); return chars(); };
 	inline const char *asNullTerminated() const { return toCString().chars(); };
 	inline const char *asSysString() const { return asNullTerminated(); }
 
-	inline char charAt(int index) const { return buf[index + off]; };
+	inline char charAt(int index) const { return chars()[index]; };
 	inline char operator[](int index) const { return charAt(index); };
-	inline String substring(int _off) const { return String(buf, off + _off, len - _off); };
-	inline String substring(int _off, int _len) const { return String(buf, off + _off, _len); };
+	inline String substring(int _off) const { return substring(_off, length() - _off); };
+	inline String substring(int _off, int _len) const
+		{ return isInline() ? String(u.in + _off, _len) : String(u.h.buf, u.h.off + _off, _len); };
 
-	inline String concat(const CString str) const { return concat(chars(), len, str.chars(), str.length()); };
-	inline String concat(const String& str) const { return concat(chars(), len, str.chars(), str.length()); };
+	inline String concat(const CString str) const { return concat(chars(), length(), str.chars(), str.length()); };
+	inline String concat(const String& str) const { return concat(chars(), length(), str.chars(), str.length()); };
 
 	inline int indexOf(char chr) const { return indexOf(chr, 0); };
 	inline int indexOf(char chr, int pos) const
-		{ for(const char *p = chars() + pos; p < chars() + len; p++) if(*p == chr) return p - chars(); return -1; };
+		{ const char *c = chars(); for(const char *p = c + pos; p < c + length(); p++) if(*p == chr) return p - c; return -1; };
 	int indexOf(const String& str, int pos = 0);
 	inline int lastIndexOf(char chr) const { return lastIndexOf(chr, length()); };
 	inline int lastIndexOf(char chr, int pos) const
@@ -112,15 +137,15 @@ public:
 	inline bool startsWith(const char *str) const
 		{ return startsWith(CString(str)); }
 	inline bool startsWith(const CString str) const
-		{ int l = str.length(); return len >= l && !memcmp(chars(), str.chars(), l); }
+		{ int l = str.length(); return length() >= l && !memcmp(chars(), str.chars(), l); }
 	inline bool startsWith(const String& str) const
-		{ return len >= str.len && !memcmp(chars(), str.chars(), str.length()); }
+		{ return length() >= str.length() && !memcmp(chars(), str.chars(), str.length()); }
 	inline bool endsWith(const char *str) const
 		{ return endsWith(CString(str)); }
 	inline bool endsWith(const CString str) const
-		{ int l = str.length(); return len >= l && !memcmp(chars() + len - l, str.chars(), l); }
+		{ int l = str.length(); return length() >= l && !memcmp(chars() + length() - l, str.chars(), l); }
 	inline bool endsWith(const String& str) const
-		{ return len>= str.len && !memcmp(chars() + len - str.len, str.chars(), str.len); }
+		{ int l = str.length(); return length() >= l && !memcmp(chars() + length() - l, str.chars(), l); }
 
 	String trim(void) const;
 	String ltrim(void) const;
@@ -22,20 +22,25 @@ public:
 		: io::Output(_stream), _stream(capacity, increment)
 		{ init(); }
 
-	inline String toString()
-		{ int len = length(); _stream.write('\0');
-		return String((String::buffer_t *)_stream.detach(), sizeof(short), len); }
+	inline String toString() {
+		int len = length();
+		if(len <= String::inline_max)
+			return String(_stream.block() + String::zero_off, len);
+		_stream.write('\0');
+		return String((String::buffer_t *)_stream.detach(), String::zero_off, len);
+	}
 	inline CString toCString()
-		{ _stream.write('\0'); return _stream.block() + sizeof(short); }
+		{ _stream.write('\0'); return _stream.block() + String::zero_off; }
 		
 	inline String copyString()
-		{ return String( _stream.block() + sizeof(short), _stream.size() - sizeof(short)); }
-	inline int length(void) const { return _stream.size() - sizeof(short); }
+		{ return String( _stream.block() + String::zero_off, _stream.size() - String::zero_off); }
+	inline int length(void) const { return _stream.size() - String::zero_off; }
+	inline void reserve(int n) { _stream.reserve(String::zero_off + n + 1); }
 	inline void reset(void) { _stream.clear(); init(); }
 	inline io::OutStream& stream(void) { return _stream; }
 
 private:
-	inline void init(void) { String::buffer_t str = { 0 }; _stream.write((char *)&str, sizeof(short)); }
+	inline void init(void) { String::buffer_t str = { 0, { 0 } }; _stream.write((char *)&str, String::zero_off); }
 	io::BlockOutStream _stream;
 };
 
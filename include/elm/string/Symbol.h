@@ -0,0 +1,86 @@
+/*
+ *	Symbol class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ * 
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software 
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_STRING_SYMBOL_H_
+#define ELM_STRING_SYMBOL_H_
+
+#include <elm/hash.h>
+#include <elm/io/Output.h>
+
+namespace elm {
+
+// Symbol class
+class Symbol {
+public:
+	class Entry {
+	public:
+		inline Entry(const String& n, t::hash h): name(n), hash(h) { }
+		String name;
+		t::hash hash;
+	};
+
+	static const Symbol null;
+
+	inline Symbol(void): e(nullptr) { }
+	inline explicit Symbol(const char *str) { intern(str); }
+	inline explicit Symbol(cstring str) { intern(str); }
+	inline explicit Symbol(const String& str) { intern(str); }
+	static Symbol find(const String& str);
+	static int count(void);
+
+	inline bool isNull(void) const { return e == nullptr; }
+	inline operator bool(void) const { return e != nullptr; }
+	inline int length(void) const { return e ? e->name.length() : 0; }
+	inline const char *chars(void) const { return e ? e->name.chars() : ""; }
+	inline cstring toCString(void) const { return chars(); }
+	inline String toString(void) const { return e ? e->name : String(); }
+	inline operator String(void) const { return toString(); }
+	inline t::hash hash(void) const { return e ? e->hash : 0; }
+	inline const Entry *entry(void) const { return e; }
+
+	inline bool equals(const Symbol& s) const { return e == s.e; }
+	inline int compare(const Symbol& s) const
+		{ return e == s.e ? 0 : toCString().compare(s.toCString()); }
+	inline bool operator==(const Symbol& s) const { return e == s.e; }
+	inline bool operator!=(const Symbol& s) const { return e != s.e; }
+	inline bool operator<(const Symbol& s) const { return compare(s) < 0; }
+	inline bool operator<=(const Symbol& s) const { return compare(s) <= 0; }
+	inline bool operator>(const Symbol& s) const { return compare(s) > 0; }
+	inline bool operator>=(const Symbol& s) const { return compare(s) >= 0; }
+
+private:
+	inline Symbol(const Entry *entry): e(entry) { }
+	void intern(const String& str);
+	const Entry *e;
+};
+
+template <> class HashKey<Symbol> {
+public:
+	static inline t::hash hash(const Symbol& key) { return key.hash(); }
+	static inline bool equals(const Symbol& key1, const Symbol& key2) { return key1 == key2; }
+	inline t::hash computeHash(const Symbol& key) const { return hash(key); }
+	inline bool isEqual(const Symbol& key1, const Symbol& key2) const { return equals(key1, key2); }
+};
+
+inline io::Output& operator<<(io::Output& out, const Symbol& s) { out << s.toCString(); return out; }
+
+}	// elm
+
+#endif	// ELM_STRING_SYMBOL_H_
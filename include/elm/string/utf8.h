@@ -42,7 +42,7 @@ public:
 		: p(str), q(p + size), c(0) { parse(); }
 	inline Iter(cstring str)
 		: p(str.chars()), q(p + str.length()), c(0) { parse(); }
-	inline Iter(string str)
+	inline Iter(const string& str)
 		: p(str.toCString().chars()), q(p + str.length()), c(0) { parse(); }
 
 	inline bool ended(void) const { return !c; }
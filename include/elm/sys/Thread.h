@@ -91,6 +91,19 @@ public:
 	virtual bool tryLock(void) = 0;
 };
 
+
+// MutexGuard class
+class MutexGuard {
+public:
+	inline MutexGuard(Mutex *m): _m(m) { _m->lock(); }
+	inline MutexGuard(Mutex& m): _m(&m) { _m->lock(); }
+	inline ~MutexGuard(void) { _m->unlock(); }
+private:
+	MutexGuard(const MutexGuard&);
+	MutexGuard& operator=(const MutexGuard&);
+	Mutex *_m;
+};
+
 } }	// elm::sys
 
 #endif /* ELM_SYSTEM_THREAD_H_ */
@@ -0,0 +1,67 @@
+/*
+ *	ThreadPool class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_SYS_THREADPOOL_H_
+#define ELM_SYS_THREADPOOL_H_
+
+#include <elm/sys/Thread.h>
+
+namespace elm { namespace sys {
+
+class ThreadPool {
+	class Worker;
+	class State;
+public:
+
+	class Body {
+	public:
+		virtual ~Body(void);
+		virtual void run(int i) = 0;
+	};
+
+	ThreadPool(int count = 0);
+	~ThreadPool(void);
+	inline int threadCount(void) const { return cnt; }
+	void run(int n, Body& body);
+	template <class F> inline void forEach(int n, F f) { FunBody<F> b(f); run(n, b); }
+
+	static ThreadPool& shared(void);
+
+private:
+	template <class F> class FunBody: public Body {
+	public:
+		inline FunBody(F& f): _f(f) { }
+		void run(int i) override { _f(i); }
+	private:
+		F& _f;
+	};
+
+	ThreadPool(const ThreadPool&);
+	ThreadPool& operator=(const ThreadPool&);
+
+	int cnt;
+	State *state;
+	Worker **workers;
+	Thread **thds;
+};
+
+} }	// elm::sys
+
+#endif /* ELM_SYS_THREADPOOL_H_ */
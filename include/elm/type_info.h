@@ -86,6 +86,11 @@ namespace elm
 		{
 			is_void = 0
 		};
+		enum
+		{
+			is_trivial = 0,
+			is_relocatable = 0
+		};
 	} default_t;
 
 	// generic class
@@ -156,6 +161,11 @@ namespace elm
 		{
 			is_deep = 0
 		};
+		enum
+		{
+			is_trivial = 1,
+			is_relocatable = 1
+		};
 
 		typedef T var_t;
 		typedef var_t embed_t;
@@ -319,6 +329,11 @@ namespace elm
 	template <>
 	struct type_info<cstring> : public default_t
 	{
+		enum
+		{
+			is_trivial = 1,
+			is_relocatable = 1
+		};
 		static const cstring null;
 		static cstring name(void);
 
@@ -347,6 +362,10 @@ namespace elm
 		{
 			is_deep = 1
 		};
+		enum
+		{
+			is_relocatable = 1
+		};
 
 		typedef string var_t;
 		typedef var_t embed_t;
@@ -0,0 +1,117 @@
+/*
+ *	BitMatrix class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ * 
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software 
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_UTIL_BITMATRIX_H_
+#define ELM_UTIL_BITMATRIX_H_
+
+#include <elm/util/BitVector.h>
+
+namespace elm {
+
+// BitMatrix class
+class BitMatrix {
+	typedef t::uint64 word_t;
+public:
+
+	// Row class
+	class Row {
+	public:
+		inline Row(word_t *w, int size): _w(w), _size(size) { }
+		inline int size(void) const { return _size; }
+
+		inline bool bit(int i) const
+			{ ASSERTP(i < _size, "index out of bounds"); return (_w[i >> 6] >> (i & 63)) & 1; }
+		inline void set(int i) const
+			{ ASSERTP(i < _size, "index out of bounds"); _w[i >> 6] |= word_t(1) << (i & 63); }
+		inline void clear(int i) const
+			{ ASSERTP(i < _size, "index out of bounds"); _w[i >> 6] &= ~(word_t(1) << (i & 63)); }
+		inline void set(int i, bool v) const { if(v) set(i); else clear(i); }
+
+		inline bool applyOr(const Row& r) const { check(r); return bitvector::applyOr(_w, r._w, wcount()); }
+		inline bool applyAnd(const Row& r) const { check(r); return bitvector::applyAnd(_w, r._w, wcount()); }
+		inline bool applyReset(const Row& r) const { check(r); return bitvector::applyReset(_w, r._w, wcount()); }
+		void copy(const Row& r) const;
+		void clear(void) const;
+		void set(void) const;
+
+		inline bool equals(const Row& r) const { check(r); return bitvector::equals(_w, r._w, wcount()); }
+		inline bool isEmpty(void) const { return bitvector::isEmpty(_w, wcount()); }
+		inline int countOnes(void) const { return elm::countOnes(_w, wcount()); }
+		template <class F> void forEachOne(F f) const {
+			for(int wi = 0; wi < wcount(); wi++)
+				for(word_t w = _w[wi]; w; w &= w - 1)
+					f((wi << 6) + lsb(w));
+		}
+		BitVector toBitVector(void) const;
+		void print(io::Output& out) const;
+
+		inline bool operator[](int i) const { return bit(i); }
+		inline bool operator==(const Row& r) const { return equals(r); }
+		inline bool operator!=(const Row& r) const { return !equals(r); }
+
+	private:
+		inline int wcount(void) const { return (_size + 63) >> 6; }
+		inline void check(const Row& r) const { ASSERTP(_size == r._size, "rows must have the same size"); }
+		word_t *_w;
+		int _size;
+	};
+
+	BitMatrix(int rows, int cols, bool set = false);
+	BitMatrix(const BitMatrix& m);
+	inline ~BitMatrix(void) { delete [] _bits; }
+	BitMatrix& operator=(const BitMatrix& m);
+
+	inline int rows(void) const { return _rows; }
+	inline int cols(void) const { return _cols; }
+	inline Row row(int i) const
+		{ ASSERTP(0 <= i && i < _rows, "row out of bounds"); return Row(_bits + i * _stride, _cols); }
+	inline Row operator[](int i) const { return row(i); }
+
+	inline bool bit(int i, int j) const { return row(i).bit(j); }
+	inline void set(int i, int j) const { row(i).set(j); }
+	inline void clear(int i, int j) const { row(i).clear(j); }
+
+	inline bool orRow(int d, int s) const { return row(d).applyOr(row(s)); }
+	inline bool andRow(int d, int s) const { return row(d).applyAnd(row(s)); }
+
+	void clear(void);
+	void set(void);
+	bool equals(const BitMatrix& m) const;
+	int countOnes(void) const;
+	void closure(void);
+	BitMatrix transpose(void) const;
+	void print(io::Output& out) const;
+
+	inline bool operator==(const BitMatrix& m) const { return equals(m); }
+	inline bool operator!=(const BitMatrix& m) const { return !equals(m); }
+
+	inline t::size __size(void) const { return sizeof(*this) + t::size(_rows) * _stride * sizeof(word_t); }
+
+private:
+	word_t *_bits;
+	int _rows, _cols, _stride;
+};
+
+inline io::Output& operator<<(io::Output& out, const BitMatrix::Row& r) { r.print(out); return out; }
+inline io::Output& operator<<(io::Output& out, const BitMatrix& m) { m.print(out); return out; }
+
+}	// elm
+
+#endif	// ELM_UTIL_BITMATRIX_H_
@@ -22,14 +22,23 @@
 #define ELM_UTIL_BIT_VECTOR_H
 
 #include <elm/assert.h>
+#include <elm/int.h>
 #include <elm/io.h>
 #include <elm/PreIterator.h>
 
 namespace elm {
 
+namespace bitvector {
+	bool applyOr(t::uint64 *d, const t::uint64 *s, int n);
+	bool applyAnd(t::uint64 *d, const t::uint64 *s, int n);
+	bool applyReset(t::uint64 *d, const t::uint64 *s, int n);
+	bool equals(const t::uint64 *a, const t::uint64 *b, int n);
+	bool isEmpty(const t::uint64 *a, int n);
+}
+
 // BitVector class
 class BitVector {
-	typedef t::uint8 word_t;
+	typedef t::uint64 word_t;
 public:
 	inline BitVector(void): bits(nullptr), _size(0) { }
 	BitVector(int size, bool set = false);
@@ -40,22 +49,26 @@ public:
 
 	inline bool bit(int i) const {
 		ASSERTP(i < _size, "index out of bounds");
-		return (bits[windex(i)] & (1 << bindex(i))) != 0;
+		return (bits[windex(i)] & (word_t(1) << bindex(i))) != 0;
 	}
 
-	inline bool isEmpty(void) const {
-		mask();
-		for(int i = 0; i < wcount(); i++)
-			if(bits[i]) return false;
-		return true;
-	}
+	bool isEmpty(void) const;
 
 	bool includes(const BitVector& vec) const;
 	bool includesStrictly(const BitVector &vec) const;
 	bool equals(const BitVector& vec) const;
 	int countBits(void) const;
 	void resize(int new_size);
-	bool meets(const BitVector& bv);
+	bool meets(const BitVector& bv) const;
+
+	inline int findFirst(void) const { return found(scanOne(0)); }
+	inline int findNext(int i) const { return found(scanOne(i + 1)); }
+	int findLast(void) const;
+	template <class F> void forEachOne(F f) const {
+		for(int wi = 0; wi < wcount(); wi++)
+			for(word_t w = bits[wi]; w; w &= w - 1)
+				f((wi << wshift()) + lsb(w));
+	}
 	
 	inline void set(int index) const
 		{ ASSERTP(index < _size, "index out of bounds"); bits[windex(index)] |= word_t(1) << bindex(index); }
@@ -69,9 +82,9 @@ public:
 	void set(void);
 
 	void applyNot(void);
-	void applyOr(const BitVector& vec);
-	void applyAnd(const BitVector& vec);
-	void applyReset(const BitVector& vec);
+	bool applyOr(const BitVector& vec);
+	bool applyAnd(const BitVector& vec);
+	bool applyReset(const BitVector& vec);
 #ifdef EXPERIMENTAL
 	inline void shiftLeft(int n = 1) { doShiftLeft(n, bits); }
 	inline void shiftRight(int n = 1) { doShiftRight(n, bits); }
@@ -94,7 +107,7 @@ public:
 	
 	// useful operations
 	int countOnes(void) const;
-	inline int countZeroes(void) const { return countBits() - countOnes(); }
+	inline int countZeroes(void) const { return _size - countOnes(); }
 
 	class Iter {
 	public:
@@ -119,12 +132,23 @@ public:
 	// OneIterator iter
 	class OneIterator: public Iter {
 	public:
-		inline OneIterator(const BitVector& bit_vector, int ii = 0): Iter(bit_vector) { i = ii - 1; next(); }
+		inline OneIterator(const BitVector& bit_vector, int ii = 0): Iter(bit_vector), wi(bvec.windex(ii)), w(0)
+			{ if(ii < bvec._size) w = bvec.bits[wi] & (word_t(-1) << bvec.bindex(ii)); step(); }
 		inline int item() const  { return i; }
-		inline void next() { do i++; while(i < bvec.size() && !bvec.bit(i)); }
+		inline void next() { w &= w - 1; step(); }
 		inline int operator*() const { return item(); }
 		inline Iter& operator++() { next(); return *this; }
 		inline Iter operator++(int) { Iter o = *this; next(); return o; }
+	private:
+		inline void step() {
+			while(!w) {
+				if(++wi >= bvec.wcount()) { i = bvec._size; return; }
+				w = bvec.bits[wi];
+			}
+			i = (wi << bvec.wshift()) + lsb(w);
+		}
+		int wi;
+		word_t w;
 	};
 	inline OneIterator begin() const { return OneIterator(*this); }
 	inline OneIterator end() const { return OneIterator(*this, size()); }
@@ -132,12 +156,24 @@ public:
 	// ZeroIterator iter
 	class ZeroIterator: public Iter {
 	public:
-		inline ZeroIterator(const BitVector& bit_vector): Iter(bit_vector) { i = -1; next(); }
+		inline ZeroIterator(const BitVector& bit_vector): Iter(bit_vector), wi(0), w(bvec._size ? ~bvec.bits[0] : 0)
+			{ step(); }
 		inline int item(void) const  { return i; }
-		inline void next(void) { do i++; while(i < bvec.size() && bvec.bit(i)); }
+		inline void next(void) { w &= w - 1; step(); }
 		inline int operator*() const { return item(); }
 		inline Iter& operator++() { next(); return *this; }
 		inline Iter operator++(int) { Iter o = *this; next(); return o; }
+	private:
+		inline void step() {
+			while(!w) {
+				if(++wi >= bvec.wcount()) { i = bvec._size; return; }
+				w = ~bvec.bits[wi];
+			}
+			i = (wi << bvec.wshift()) + lsb(w);
+			if(i >= bvec._size) { i = bvec._size; wi = bvec.wcount(); w = 0; }
+		}
+		int wi;
+		word_t w;
 	};
 
 	// Ref delegate
@@ -198,11 +234,24 @@ private:
 	inline int windex(int index) const { return index >> wshift(); }
 	inline int bindex(int index) const { return index & (wsize() - 1); }
 
-	inline void mask(word_t *bits) const {
-		word_t mask = word_t(-1) >> (wsize() - bindex(_size));
-		if(mask) bits[wcount() - 1] &= mask;
-	}
+	inline void mask(word_t *bits) const
+		{ if(bindex(_size)) bits[wcount() - 1] &= word_t(-1) >> (wsize() - bindex(_size)); }
 	inline void mask(void) const { mask(bits); }
+	inline int found(int i) const { return i < _size ? i : -1; }
+
+	inline int scanOne(int i) const {
+		if(i >= _size)
+			return _size;
+		int wi = windex(i);
+		word_t w = bits[wi] & (word_t(-1) << bindex(i));
+		while(!w) {
+			if(++wi >= wcount())
+				return _size;
+			w = bits[wi];
+		}
+		return (wi << wshift()) + lsb(w);
+	}
+
 #ifdef EXPERIMENTAL
 	void doShiftLeft(int n, word_t *tbits) const;
 	void doShiftRight(int n, word_t *tbits) const;
@@ -21,6 +21,8 @@
 #ifndef ELM_UTIL_PAIR_H
 #define ELM_UTIL_PAIR_H
 
+#include <utility>
+
 namespace elm {
 
 namespace io {
@@ -34,10 +36,14 @@ class Pair {
 public:
 	T1 fst;
 	T2 snd;
-	inline Pair(void) { }
+	inline Pair(void) = default;
 	inline Pair(const T1& _fst, const T2& _snd): fst(_fst), snd(_snd) { }
-	inline Pair(const Pair<T1, T2>& pair): fst(pair.fst), snd(pair.snd) { }
-	inline Pair<T1, T2>& operator=(const Pair<T1, T2>& pair) { fst = pair.fst; snd = pair.snd; return *this; }
+	inline Pair(const T1& _fst, T2&& _snd): fst(_fst), snd(std::move(_snd)) { }
+	inline Pair(T1&& _fst, T2&& _snd): fst(std::move(_fst)), snd(std::move(_snd)) { }
+	inline Pair(const Pair<T1, T2>& pair) = default;
+	inline Pair(Pair<T1, T2>&& pair) = default;
+	inline Pair<T1, T2>& operator=(const Pair<T1, T2>& pair) = default;
+	inline Pair<T1, T2>& operator=(Pair<T1, T2>&& pair) = default;
 	inline bool operator==(const Pair<T1, T2>& pair) const { return ((fst== pair.fst) && (snd == pair.snd)); }
 	inline bool operator!=(const Pair<T1, T2>& pair) const { return !operator==(pair); }
 	inline bool operator<(const Pair<T1, T1>& pair) const { return fst < fst.pair || (fst == fst.pair && snd < snd.pair); }
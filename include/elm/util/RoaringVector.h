@@ -0,0 +1,180 @@
+/*
+ *	RoaringVector class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ * 
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software 
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_UTIL_ROARINGVECTOR_H_
+#define ELM_UTIL_ROARINGVECTOR_H_
+
+#include <elm/int.h>
+#include <elm/io.h>
+#include <elm/iter.h>
+
+namespace elm {
+
+namespace roaring {
+
+const int ARRAY_MAX = 4096;		// maximum count of values of an array container
+const int WORDS = 1024;			// count of 64-bit words of a bitmap container
+typedef enum { ARRAY = 0, BITMAP = 1, RUN = 2 } kind_t;
+typedef enum { AND, OR, RESET } op_t;
+
+class Container {
+public:
+	t::uint16 key;
+	t::uint8 kind;
+	int card;		// count of ones
+	int cnt;		// count of values (ARRAY) or of runs (RUN)
+	int cap;		// capacity in values (ARRAY) or in runs (RUN)
+	t::uint64 *mem;
+
+	inline t::uint16 *values(void) const { return reinterpret_cast<t::uint16 *>(mem); }
+	inline t::uint64 *words(void) const { return mem; }
+	inline t::uint16 *runs(void) const { return reinterpret_cast<t::uint16 *>(mem); }
+	bool contains(t::uint16 v) const;
+
+	template <class F> void forEach(F f) const {
+		int base = int(key) << 16;
+		switch(kind) {
+		case ARRAY:
+			for(int i = 0; i < cnt; i++)
+				f(base | values()[i]);
+			break;
+		case BITMAP:
+			for(int i = 0; i < WORDS; i++)
+				for(t::uint64 w = mem[i]; w; w &= w - 1)
+					f(base | (i << 6) | lsb(w));
+			break;
+		case RUN:
+			for(int i = 0; i < cnt; i++)
+				for(int v = runs()[2 * i], e = v + runs()[2 * i + 1]; v <= e; v++)
+					f(base | v);
+			break;
+		}
+	}
+};
+
+}	// roaring
+
+class RoaringVector {
+public:
+	inline RoaringVector(void): _size(0), _cnt(0), _cap(0), _conts(nullptr) { }
+	RoaringVector(int size, bool init = false);
+	RoaringVector(const RoaringVector& v);
+	~RoaringVector(void);
+
+	inline int size(void) const { return _size; }
+	bool bit(int index) const;
+	inline bool isEmpty(void) const { return _cnt == 0; }
+	inline bool isFull(void) const { return countOnes() == _size; }
+	bool equals(const RoaringVector& v) const;
+	bool includes(const RoaringVector& v) const;
+	bool includesStrictly(const RoaringVector& v) const;
+	bool meets(const RoaringVector& v) const;
+	int countOnes(void) const;
+	inline int countBits(void) const { return countOnes(); }
+	inline int countZeroes(void) const { return _size - countOnes(); }
+	template <class F> void forEachOne(F f) const
+		{ for(int i = 0; i < _cnt; i++) _conts[i].forEach(f); }
+
+	void set(int index);
+	void clear(int index);
+	inline void set(int index, bool value) { if(value) set(index); else clear(index); }
+	void set(void);
+	void clear(void);
+	void copy(const RoaringVector& v);
+
+	inline void applyAnd(const RoaringVector& v) { combine(*this, *this, v, roaring::AND); }
+	inline RoaringVector makeAnd(const RoaringVector& v) const { RoaringVector r; combine(r, *this, v, roaring::AND); return r; }
+	inline void applyOr(const RoaringVector& v) { combine(*this, *this, v, roaring::OR); }
+	inline RoaringVector makeOr(const RoaringVector& v) const { RoaringVector r; combine(r, *this, v, roaring::OR); return r; }
+	inline void applyReset(const RoaringVector& v) { combine(*this, *this, v, roaring::RESET); }
+	inline RoaringVector makeReset(const RoaringVector& v) const { RoaringVector r; combine(r, *this, v, roaring::RESET); return r; }
+	inline void applyNot(void) { RoaringVector f(_size, true); combine(*this, f, *this, roaring::RESET); }
+	inline RoaringVector makeNot(void) const { RoaringVector r(_size, true); r.applyReset(*this); return r; }
+
+	class OneIterator: public PreIter<OneIterator, int> {
+	public:
+		inline OneIterator(const RoaringVector& v): _v(&v), ci(0), j(-1), x(0), i(0), w(0) { next(); }
+		inline OneIterator(const RoaringVector& v, bool /*end*/): _v(&v), ci(v._cnt), j(-1), x(0), i(v._size), w(0) { }
+		inline bool ended(void) const { return ci >= _v->_cnt; }
+		inline int item(void) const { return i; }
+		void next(void);
+		inline bool equals(const OneIterator& it) const { return i == it.i && _v == it._v; }
+		inline int operator*(void) const { return item(); }
+	private:
+		const RoaringVector *_v;
+		int ci, j, x, i;
+		t::uint64 w;
+	};
+	inline OneIterator begin(void) const { return OneIterator(*this); }
+	inline OneIterator end(void) const { return OneIterator(*this, true); }
+
+	class Ref {
+	public:
+		inline Ref(RoaringVector& v, int i): _v(v), _i(i) { }
+		inline operator bool(void) const { return _v.bit(_i); }
+		inline Ref& operator=(bool b) { _v.set(_i, b); return *this; }
+	private:
+		RoaringVector& _v;
+		int _i;
+	};
+
+	inline bool operator[](int i) const { return bit(i); }
+	inline Ref operator[](int i) { return Ref(*this, i); }
+	inline operator bool(void) const { return !isEmpty(); }
+	inline RoaringVector operator~(void) const { return makeNot(); }
+	inline RoaringVector operator|(const RoaringVector &v) const { return makeOr(v); }
+	inline RoaringVector operator&(const RoaringVector &v) const { return makeAnd(v); }
+	inline RoaringVector operator+(const RoaringVector &v) const { return makeOr(v); }
+	inline RoaringVector operator*(const RoaringVector &v) const { return makeAnd(v); }
+	inline RoaringVector operator-(const RoaringVector &v) const { return makeReset(v); }
+	inline RoaringVector &operator=(const RoaringVector &v) { copy(v); return *this; }
+	inline RoaringVector &operator|=(const RoaringVector &v) { applyOr(v); return *this; }
+	inline RoaringVector &operator&=(const RoaringVector &v) { applyAnd(v); return *this; }
+	inline RoaringVector &operator+=(const RoaringVector &v) { applyOr(v); return *this; }
+	inline RoaringVector &operator*=(const RoaringVector &v) { applyAnd(v); return *this; }
+	inline RoaringVector &operator-=(const RoaringVector &v) { applyReset(v); return *this; }
+	inline bool operator==(const RoaringVector& v) const { return equals(v); }
+	inline bool operator!=(const RoaringVector& v) const { return !equals(v); }
+	inline bool operator<(const RoaringVector &v) const { return v.includesStrictly(*this); }
+	inline bool operator<=(const RoaringVector &v) const { return v.includes(*this); }
+	inline bool operator>(const RoaringVector &v) const { return includesStrictly(v); }
+	inline bool operator>=(const RoaringVector &v) const { return includes(v); }
+
+	void print(io::Output& out) const;
+	t::size __size(void) const;
+
+private:
+	static void combine(RoaringVector& r, const RoaringVector& v1, const RoaringVector& v2, roaring::op_t op);
+	int find(int key) const;
+	roaring::Container& insert(int i, int key);
+	void erase(int i);
+	void release(void);
+
+	int _size;
+	int _cnt, _cap;
+	roaring::Container *_conts;
+};
+
+inline io::Output& operator<<(io::Output& out, const RoaringVector& v)
+	{ v.print(out); return out; }
+
+}	// elm
+
+#endif	// ELM_UTIL_ROARINGVECTOR_H_
@@ -0,0 +1,123 @@
+/*
+ *	WorkListSolver class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ * 
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software 
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_UTIL_WORKLISTSOLVER_H_
+#define ELM_UTIL_WORKLISTSOLVER_H_
+
+#include <elm/data/Vector.h>
+#include <elm/util/BitMatrix.h>
+
+namespace elm {
+
+// WorkListSolver class
+template <class G>
+class WorkListSolver {
+public:
+	typedef BitMatrix::Row row_t;
+
+	class Union {
+	public:
+		inline bool operator()(const row_t& d, const row_t& s) const { return d.applyOr(s); }
+	};
+
+	class Intersection {
+	public:
+		inline bool operator()(const row_t& d, const row_t& s) const { return d.applyAnd(s); }
+	};
+
+	WorkListSolver(const G& graph, int bits, int entry = 0)
+	: _g(graph), _in(graph.count(), bits), _out(graph.count(), bits), _steps(0)
+		{ order(entry); }
+
+	inline const G& graph(void) const { return _g; }
+	inline BitMatrix& ins(void) { return _in; }
+	inline BitMatrix& outs(void) { return _out; }
+	inline row_t in(int v) const { return _in.row(v); }
+	inline row_t out(int v) const { return _out.row(v); }
+	inline int rank(int v) const { return _rank[v]; }
+	inline int node(int r) const { return _order[r]; }
+	inline int steps(void) const { return _steps; }
+
+	template <class T, class J> void solve(T transfer, J join) {
+		int n = _order.count();
+		if(n == 0)
+			return;
+		BitVector pending(n, true), done(n);
+		for(int i = 0; i >= 0; ) {
+			pending.clear(i);
+			int v = _order[i];
+			_steps++;
+			row_t o = _out.row(v);
+			if(transfer(v, _in.row(v), o) || !done.bit(i)) {
+				done.set(i);
+				for(auto s: _g.succs(v))
+					if(join(_in.row(s), o))
+						pending.set(_rank[s]);
+			}
+			i = pending.findNext(i);
+			if(i < 0)
+				i = pending.findFirst();
+		}
+	}
+	template <class T> inline void solve(T transfer) { solve(transfer, Union()); }
+
+private:
+
+	void order(int entry) {
+		int n = _g.count();
+		if(n == 0)
+			return;
+		BitVector visited(n);
+		Vector<int> stack, post;
+		_rank.setLength(n);
+		for(int r = 0; r < n; r++) {
+			int root = r == 0 ? entry : r - (r <= entry);
+			if(visited.bit(root))
+				continue;
+			stack.push(root << 1);
+			while(!stack.isEmpty()) {
+				int x = stack.pop(), v = x >> 1;
+				if(x & 1)
+					post.add(v);
+				else if(!visited.bit(v)) {
+					visited.set(v);
+					stack.push((v << 1) | 1);
+					for(auto s: _g.succs(v))
+						if(!visited.bit(s))
+							stack.push(s << 1);
+				}
+			}
+		}
+		for(int i = post.count() - 1; i >= 0; i--) {
+			_rank[post[i]] = _order.count();
+			_order.add(post[i]);
+		}
+	}
+
+	const G& _g;
+	BitMatrix _in, _out;
+	Vector<int> _order;
+	Vector<int> _rank;
+	int _steps;
+};
+
+}	// elm
+
+#endif	// ELM_UTIL_WORKLISTSOLVER_H_
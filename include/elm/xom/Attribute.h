@@ -22,6 +22,7 @@
 #ifndef ELM_XOM_ATTRIBUTE_H_
 #define ELM_XOM_ATTRIBUTE_H_
 
+#include <elm/string/Symbol.h>
 #include <elm/xom/Node.h>
 
 namespace elm { namespace xom {
@@ -38,6 +39,7 @@ public:
 	//Attribute(String name, String URI, String value, Attribute.Type type)
 
 	String getLocalName(void) const;
+	Symbol getLocalSymbol(void) const;
 	String getNamespacePrefix(void) const;
 	String getNamespaceURI(void) const;
 	String getQualifiedName(void) const;
@@ -7,6 +7,7 @@
 #ifndef ELM_XOM_ELEMENT_H
 #define ELM_XOM_ELEMENT_H
 
+#include <elm/string/Symbol.h>
 #include <elm/util/Option.h>
 #include <elm/xom/ParentNode.h>
 
@@ -64,6 +65,8 @@ public:
 	virtual void setNamespaceURI(String uri);
 	virtual String toString(void);
 	virtual String toXML(void);
+
+	Symbol getLocalSymbol(void);
 };
 
 } } // elm::xom
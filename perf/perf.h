@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf.h -- common helpers for performance tests.
+ */
+#ifndef ELM_PERF_H_
+#define ELM_PERF_H_
+
+#include <sys/time.h>
+#include <stdlib.h>
+#include <elm/io.h>
+
+namespace perf {
+
+using namespace elm;
+
+// wall-clock time in micro-seconds
+inline t::int64 now(void) {
+	struct timeval tv;
+	gettimeofday(&tv, nullptr);
+	return t::int64(tv.tv_sec) * 1000000 + tv.tv_usec;
+}
+
+// measure the time of f() performing n operations and display it
+template <class F>
+t::int64 measure(const string& label, t::int64 n, F f) {
+	t::int64 t = now();
+	f();
+	t = now() - t;
+	cout << label << "\t" << io::fmt(n).width(10).right() << " ops\t"
+		 << io::fmt(t).width(10).right() << " us\t"
+		 << io::fmt(double(t) * 1000 / n).width(10, 4).decimal().right() << " ns/op" << io::endl;
+	return t;
+}
+
+// get the integer argument i or the default value
+inline t::int64 arg(int argc, char **argv, int i, t::int64 def) {
+	return i < argc ? atol(argv[i]) : def;
+}
+
+}	// perf
+
+#endif	// ELM_PERF_H_
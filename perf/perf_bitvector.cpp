@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_bitvector.cpp -- bulk operations of BitVector.
+ *
+ * Usage: perf_bitvector [BITS]
+ *
+ * For vectors of 1K to 1M bits (by powers of 4), repeat each bulk operation
+ * (or, and, reset, includes, equals, meets, countOnes) until about
+ * BITS (default 1G) bits have been processed. The comparisons are
+ * performed on their worst case: includes() and equals() compare equal
+ * vectors and meets() disjoint ones so that the whole vectors are
+ * scanned.
+ */
+
+#include <elm/util/BitVector.h>
+#include "perf.h"
+
+using namespace elm;
+
+static t::uint32 seed = 1;
+static inline int next(void) { seed = seed * 1103515245 + 12345; return seed >> 1; }
+
+int main(int argc, char **argv) {
+	t::int64 bits = perf::arg(argc, argv, 1, t::int64(1) << 30);
+	t::int64 sum = 0;
+
+	for(int n = 1 << 10; n <= 1 << 20; n <<= 2) {
+		int r = int(bits / n);
+		cout << "== " << n << " bits\n";
+		BitVector a(n), b(n), c(n), d(n);
+		for(int i = 0; i < n; i++)
+			if(next() & 1) {
+				a.set(i);
+				c.set(i);
+			}
+			else
+				d.set(i);
+		for(int i = 0; i < n; i++)
+			if(next() & 1)
+				b.set(i);
+
+		perf::measure("or      ", r, [&]() {
+			for(int i = 0; i < r; i++)
+				a.applyOr(b);
+		});
+		perf::measure("and     ", r, [&]() {
+			for(int i = 0; i < r; i++)
+				a.applyAnd(b);
+		});
+		perf::measure("reset   ", r, [&]() {
+			for(int i = 0; i < r; i++)
+				a.applyReset(d);
+		});
+		a.copy(c);
+		perf::measure("includes", r, [&]() {
+			for(int i = 0; i < r; i++)
+				sum += a.includes(c);
+		});
+		perf::measure("equals  ", r, [&]() {
+			for(int i = 0; i < r; i++)
+				sum += a.equals(c);
+		});
+		perf::measure("meets   ", r, [&]() {
+			for(int i = 0; i < r; i++)
+				sum += a.meets(d);
+		});
+		perf::measure("count   ", r, [&]() {
+			for(int i = 0; i < r; i++)
+				sum += a.countOnes();
+		});
+	}
+
+	if(sum == 666)
+		cout << "unlikely\n";
+	return 0;
+}
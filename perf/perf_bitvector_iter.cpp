@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_bitvector_iter.cpp -- iteration on the ones of a BitVector.
+ *
+ * Usage: perf_bitvector_iter [BITS [PASSES]]
+ *
+ * For vectors of BITS (default 1M) bits with a density of ones of 0.1%,
+ * 10% and 90%, visit PASSES (default 100) times the ones with a bit by bit
+ * test (the former behaviour of OneIterator), with OneIterator, with a
+ * findFirst()/findNext() loop and with forEachOne().
+ */
+
+#include <elm/util/BitVector.h>
+#include "perf.h"
+
+using namespace elm;
+
+static t::uint32 seed = 1;
+static inline int next(void) { seed = seed * 1103515245 + 12345; return seed >> 1; }
+
+int main(int argc, char **argv) {
+	int n = perf::arg(argc, argv, 1, 1 << 20);
+	int p = perf::arg(argc, argv, 2, 100);
+	t::int64 sum = 0;
+
+	int ds[] = { 1, 100, 900 };
+	for(auto d: ds) {
+		BitVector v(n);
+		for(int i = 0; i < n; i++)
+			if(next() % 1000 < d)
+				v.set(i);
+		cout << "== " << n << " bits, density " << (d / 10.) << "%, " << v.countOnes() << " ones\n";
+
+		perf::measure("bit()     ", p, [&]() {
+			for(int k = 0; k < p; k++)
+				for(int i = 0; i < v.size(); i++)
+					if(v.bit(i))
+						sum += i;
+		});
+		perf::measure("OneIter   ", p, [&]() {
+			for(int k = 0; k < p; k++)
+				for(auto i: v)
+					sum += i;
+		});
+		perf::measure("findNext  ", p, [&]() {
+			for(int k = 0; k < p; k++)
+				for(int i = v.findFirst(); i >= 0; i = v.findNext(i))
+					sum += i;
+		});
+		perf::measure("forEachOne", p, [&]() {
+			for(int k = 0; k < p; k++)
+				v.forEachOne([&](int i) { sum += i; });
+		});
+	}
+
+	if(sum == 666)
+		cout << "unlikely\n";
+	return 0;
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_btree.cpp -- BTreeMap against avl::Map.
+ *
+ * Usage: perf_btree [COUNT]
+ * COUNT (default 1M) address-like keys are inserted in random order, then
+ * looked up, iterated, scanned by ranges of 100 keys (point lookups for
+ * avl::Map that has no lower bound) and removed. Bulk loading
+ * of BTreeMap from sorted pairs is also measured.
+ */
+
+#include <elm/avl/Map.h>
+#include <elm/data/BTreeMap.h>
+#include <elm/data/Vector.h>
+#include "perf.h"
+
+using namespace elm;
+
+template <class M>
+void run(const char *name, const Vector<t::intptr>& keys, t::intptr& sum) {
+	int n = keys.count();
+	cout << "== " << name << " (" << n << " random keys)\n";
+	M m;
+	perf::measure("insert", n, [&]() {
+		for(int i = 0; i < n; i++)
+			m.put(keys[i], i);
+	});
+	perf::measure("lookup", n, [&]() {
+		for(int i = 0; i < n; i++)
+			sum += m.get(keys[i], 0);
+	});
+	perf::measure("miss", n, [&]() {
+		for(int i = 0; i < n; i++)
+			sum += m.get(keys[i] + 1, 0);
+	});
+	perf::measure("iterate", n, [&]() {
+		for(auto x: m)
+			sum += x;
+	});
+	perf::measure("remove", n, [&]() {
+		for(int i = 0; i < n; i++)
+			m.remove(keys[i]);
+	});
+}
+
+int main(int argc, char **argv) {
+	int n = perf::arg(argc, argv, 1, 1000000);
+	t::intptr sum = 0;
+
+	// address-like keys (aligned on 16 bytes), in random order
+	Vector<t::intptr> keys(n);
+	for(int i = 0; i < n; i++)
+		keys.add(0x400000 + t::intptr(i) * 16);
+	t::uint64 x = 88172645463325252ULL;
+	for(int i = n - 1; i > 0; i--) {
+		x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+		int j = x % (i + 1);
+		t::intptr k = keys[i];
+		keys[i] = keys[j];
+		keys[j] = k;
+	}
+
+	run<avl::Map<t::intptr, int> >("avl::Map<intptr, int>", keys, sum);
+	run<BTreeMap<t::intptr, int> >("BTreeMap<intptr, int>", keys, sum);
+
+	{
+		cout << "== range scans of 100 keys\n";
+		Vector<Pair<t::intptr, int> > sorted(n);
+		for(int i = 0; i < n; i++)
+			sorted.add(pair(0x400000 + t::intptr(i) * 16, i));
+		BTreeMap<t::intptr, int> b;
+		perf::measure("BTreeMap load", n, [&]() {
+			b.load(sorted);
+		});
+		avl::Map<t::intptr, int> a;
+		for(const auto& p: sorted)
+			a.put(p.fst, p.snd);
+		int r = n / 100;
+		// avl::Map has no lower bound: use one lookup per key
+		perf::measure("avl::Map lookups", r, [&]() {
+			for(int i = 0; i < r; i++)
+				for(int j = 0; j < 100; j++)
+					sum += a.get(keys[i] + j * 16, 0);
+		});
+		perf::measure("BTreeMap range", r, [&]() {
+			for(int i = 0; i < r; i++)
+				for(auto p: b.range(keys[i], keys[i] + 100 * 16))
+					sum += p.snd;
+		});
+	}
+
+	if(sum == 666)
+		cout << "unlikely\n";
+	return 0;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_concurrent_hashmap.cpp -- scaling of ConcurrentHashMap.
+ *
+ * Usage: perf_concurrent_hashmap [MAX_THREADS [OPS]]
+ *
+ * Each thread performs OPS operations (90% look-ups, 10% upserts) on
+ * a shared map, either a ConcurrentHashMap or a HashMap protected
+ * by a single mutex.
+ */
+
+#include <elm/data/ConcurrentHashMap.h>
+#include <elm/data/Vector.h>
+#include <elm/sys/Thread.h>
+#include "perf.h"
+
+using namespace elm;
+
+static const int KEYS = 100000;
+
+class LockedMap {
+public:
+	LockedMap(void): _mutex(sys::Mutex::make()) { }
+	~LockedMap(void) { delete _mutex; }
+	inline int get(int k, int d) const { _mutex->lock(); int r = _map.get(k, d); _mutex->unlock(); return r; }
+	template <class F> int fetch(int k, F f)
+		{ _mutex->lock(); int& r = _map.fetch(k); f(r); int v = r; _mutex->unlock(); return v; }
+private:
+	sys::Mutex *_mutex;
+	HashMap<int, int> _map;
+};
+
+template <class M>
+class Worker: public sys::Runnable {
+public:
+	Worker(M& map, int n, int seed): _map(map), _n(n), _seed(seed), sum(0) { }
+	void run(void) override {
+		t::uint32 x = _seed;
+		for(int i = 0; i < _n; i++) {
+			x = x * 1103515245 + 12345;
+			int k = (x >> 8) % KEYS;
+			if((x >> 4) % 10 == 0)
+				_map.fetch(k, [](int& v) { v++; });
+			else
+				sum += _map.get(k, 0);
+		}
+	}
+private:
+	M& _map;
+	int _n, _seed;
+public:
+	int sum;
+};
+
+template <class M>
+void run(cstring label, int threads, int n) {
+	M map;
+	for(int i = 0; i < KEYS; i++)
+		map.fetch(i, [i](int& v) { v = i; });
+	Vector<Worker<M> *> workers;
+	Vector<sys::Thread *> thrs;
+	for(int i = 0; i < threads; i++) {
+		workers.add(new Worker<M>(map, n, i + 1));
+		thrs.add(sys::Thread::make(*workers[i]));
+	}
+	perf::measure(_ << label << " x" << threads, t::int64(n) * threads, [&]() {
+		for(auto t: thrs)
+			t->start();
+		for(auto t: thrs)
+			t->join();
+	});
+	for(int i = 0; i < threads; i++) {
+		delete thrs[i];
+		delete workers[i];
+	}
+}
+
+int main(int argc, char **argv) {
+	int max = perf::arg(argc, argv, 1, 8);
+	int n = perf::arg(argc, argv, 2, 1000000);
+	for(int t = 1; t <= max; t++) {
+		run<LockedMap>("HashMap+mutex", t, n);
+		run<ConcurrentHashMap<int, int> >("ConcurrentHashMap", t, n);
+	}
+	return 0;
+}
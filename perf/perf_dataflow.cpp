@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_dataflow.cpp -- data flow analysis with BitVector and with WorkListSolver.
+ *
+ * Usage: perf_dataflow [NODES [BITS]]
+ *
+ * Build a synthetic control flow graph of NODES (default 100K) nodes, each
+ * node flowing to the next one with random forward and backward (loop)
+ * edges. Each node defines one of BITS (default 1K) definitions, close to its
+ * number modulo BITS, and kills the other definitions of the same variable
+ * (BITS / 16 variables). Then solve the reaching definitions with one
+ * BitVector per node, round-robin passes and makeOr()/makeReset()
+ * temporaries, then with WorkListSolver on BitMatrix rows, and check that
+ * both results match. Finally, compute the transitive closure of the first
+ * 4K nodes of the graph with BitMatrix::closure().
+ */
+
+#include <elm/util/WorkListSolver.h>
+#include "perf.h"
+
+using namespace elm;
+
+static t::uint32 seed = 1;
+// high bits only: the low bits of the generator have a short period
+static inline int next(void) { seed = seed * 1103515245 + 12345; return seed >> 16; }
+
+class Graph {
+public:
+	Graph(int n): s(n), p(n) { s.setLength(n); p.setLength(n); }
+	inline int count(void) const { return s.count(); }
+	inline const Vector<int>& succs(int v) const { return s[v]; }
+	inline const Vector<int>& preds(int v) const { return p[v]; }
+	inline void add(int v, int w) { s[v].add(w); p[w].add(v); }
+private:
+	Vector<Vector<int> > s, p;
+};
+
+int main(int argc, char **argv) {
+	int n = perf::arg(argc, argv, 1, 100000);
+	int b = perf::arg(argc, argv, 2, 1024);
+
+	// build the graph and the gen/kill sets
+	Graph g(n);
+	for(int v = 0; v < n - 1; v++) {
+		g.add(v, v + 1);
+		if(next() % 4 == 0 && v + 2 < n)
+			g.add(v, v + 2 + next() % min(20, n - v - 2));
+		if(next() % 16 == 0 && v > 0)
+			g.add(v, v - 1 - next() % min(50, v));
+	}
+	BitMatrix gen(n, b), kill(n, b);
+	int vars = max(1, b / 16);
+	for(int v = 0; v < n; v++) {
+		int d = (v + next() % 8) % b;
+		gen.set(v, d);
+		for(int k = d % vars; k < b; k += vars)
+			if(k != d)
+				kill.set(v, k);
+	}
+	cout << "== " << n << " nodes, " << b << " bits\n";
+
+	// BitVector with round-robin passes
+	Vector<BitVector> ins(n), outs(n), gens(n), kills(n);
+	for(int v = 0; v < n; v++) {
+		ins.add(BitVector(b));
+		outs.add(BitVector(b));
+		gens.add(gen.row(v).toBitVector());
+		kills.add(kill.row(v).toBitVector());
+	}
+	int passes = 0;
+	t::int64 steps = 0;
+	perf::measure("BitVector      ", n, [&]() {
+		for(bool changed = true; changed; passes++) {
+			changed = false;
+			for(int v = 0; v < n; v++) {
+				BitVector in(b);
+				for(auto p: g.preds(v))
+					in = in.makeOr(outs[p]);
+				BitVector out = gens[v].makeOr(in.makeReset(kills[v]));
+				if(out != outs[v]) {
+					outs[v] = out;
+					changed = true;
+				}
+				ins[v] = in;
+				steps++;
+			}
+		}
+	});
+	cout << "\t" << passes << " passes, " << steps << " steps\n";
+
+	// WorkListSolver
+	WorkListSolver<Graph> s(g, b);
+	BitMatrix tmp(1, b);
+	perf::measure("WorkListSolver ", n, [&]() {
+		s.solve([&](int v, const BitMatrix::Row& in, const BitMatrix::Row& out) {
+			BitMatrix::Row r = tmp.row(0);
+			r.copy(in);
+			r.applyReset(kill.row(v));
+			r.applyOr(gen.row(v));
+			return out.applyOr(r);
+		});
+	});
+	cout << "\t" << s.steps() << " steps\n";
+
+	bool same = true;
+	for(int v = 0; v < n; v++)
+		same = same && s.out(v).toBitVector() == outs[v] && s.in(v).toBitVector() == ins[v];
+	cout << "\tsame result: " << (same ? "yes" : "no") << io::endl;
+
+	// transitive closure
+	int m = min(n, 4096);
+	BitMatrix r(m, m);
+	for(int v = 0; v < m; v++)
+		for(auto w: g.succs(v))
+			if(w < m)
+				r.set(v, w);
+	perf::measure("closure        ", m, [&]() { r.closure(); });
+	cout << "\t" << r.countOnes() << " pairs\n";
+
+	if(!same)
+		return 1;
+	return 0;
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_dijkstra.cpp -- Dijkstra shortest paths with IndexedHeap and BinomialQueue.
+ *
+ * Usage: perf_dijkstra [VERTICES [DEGREE]]
+ * Build a random graph of VERTICES (default 100K) vertices with DEGREE (default 10)
+ * out-edges each (1M edges by default) and compute the shortest paths from
+ * vertex 0 with an IndexedHeap (decrease-key) and with a BinomialQueue
+ * (duplicate entries, outdated ones are skipped).
+ */
+
+#include <elm/data/BinomialQueue.h>
+#include <elm/data/IndexedHeap.h>
+#include <elm/data/Vector.h>
+#include "perf.h"
+
+using namespace elm;
+
+typedef Pair<int, int> item_t;		// (distance, vertex)
+static const int INF = type_info<int>::max;
+
+int main(int argc, char **argv) {
+	int n = perf::arg(argc, argv, 1, 100000);
+	int d = perf::arg(argc, argv, 2, 10);
+
+	// build the graph (CSR form)
+	Vector<int> first(n + 1), to(n * d), weight(n * d);
+	t::uint32 x = 12345;
+	for(int v = 0; v < n; v++) {
+		first.add(v * d);
+		for(int i = 0; i < d; i++) {
+			x = x * 1103515245 + 12345;
+			to.add((x >> 4) % n);
+			x = x * 1103515245 + 12345;
+			weight.add(1 + (x >> 8) % 1000);
+		}
+	}
+	first.add(n * d);
+	cout << "== graph: " << n << " vertices, " << n * d << " edges\n";
+
+	Vector<int> d1, d2;
+	d1.setLength(n);
+	d2.setLength(n);
+
+	{
+		int pushes = 0;
+		perf::measure("IndexedHeap", n * d, [&]() {
+			IndexedHeap<item_t> q;
+			Vector<int> h;
+			for(int v = 0; v < n; v++) {
+				d1[v] = INF;
+				h.add(IndexedHeap<item_t>::NO_HANDLE);
+			}
+			d1[0] = 0;
+			h[0] = q.put(pair(0, 0));
+			while(!q.isEmpty()) {
+				item_t u = q.get();
+				h[u.snd] = IndexedHeap<item_t>::NO_HANDLE;
+				for(int e = first[u.snd]; e < first[u.snd + 1]; e++) {
+					int v = to[e], nd = u.fst + weight[e];
+					if(nd < d1[v]) {
+						if(d1[v] == INF) {
+							h[v] = q.put(pair(nd, v));
+							pushes++;
+						}
+						else if(h[v] != IndexedHeap<item_t>::NO_HANDLE)
+							q.decreaseKey(h[v], pair(nd, v));
+						d1[v] = nd;
+					}
+				}
+			}
+		});
+		cout << "\t" << pushes << " pushes\n";
+	}
+
+	{
+		int pushes = 0;
+		perf::measure("BinomialQueue", n * d, [&]() {
+			BinomialQueue<item_t> q;
+			for(int v = 0; v < n; v++)
+				d2[v] = INF;
+			d2[0] = 0;
+			q.put(pair(0, 0));
+			while(!q.isEmpty()) {
+				item_t u = q.get();
+				if(u.fst > d2[u.snd])
+					continue;
+				for(int e = first[u.snd]; e < first[u.snd + 1]; e++) {
+					int v = to[e], nd = u.fst + weight[e];
+					if(nd < d2[v]) {
+						d2[v] = nd;
+						q.put(pair(nd, v));
+						pushes++;
+					}
+				}
+			}
+		});
+		cout << "\t" << pushes << " pushes\n";
+	}
+
+	bool same = true;
+	for(int v = 0; v < n; v++)
+		if(d1[v] != d2[v])
+			same = false;
+	cout << (same ? "same distances\n" : "DIFFERENT DISTANCES\n");
+	return 0;
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_flat_map.cpp -- FlatMap against ListMap (and avl::Map).
+ *
+ * Usage: perf_flat_map [LOOKUPS]
+ *
+ * For 100, 10K and 1M integer keys, build the map (keys in random order,
+ * FlatMap is built both by put() and by a bulk load()) and perform
+ * LOOKUPS (default 1M) look-ups of present or absent keys. ListMap
+ * is built from decreasing keys (its best case) and performs fewer
+ * look-ups at big sizes.
+ */
+
+#include <elm/avl/Map.h>
+#include <elm/data/FlatMap.h>
+#include <elm/data/ListMap.h>
+#include <elm/data/Vector.h>
+#include "perf.h"
+
+using namespace elm;
+
+static t::uint32 seed = 1;
+static inline int next(void) { seed = seed * 1103515245 + 12345; return seed >> 1; }
+
+template <class M>
+t::int64 lookup(cstring label, const M& map, int n, int q) {
+	t::int64 sum = 0;
+	perf::measure(_ << label << " get", q, [&]() {
+		for(int i = 0; i < q; i++)
+			sum += map.get(next() % (2 * n), 0);
+	});
+	return sum;
+}
+
+int main(int argc, char **argv) {
+	int q = perf::arg(argc, argv, 1, 1000000);
+	t::int64 sum = 0;
+
+	for(int n = 100; n <= 1000000; n *= 100) {
+		cout << "== " << n << " keys\n";
+		Vector<Pair<int, int> > ps;
+		for(int i = 0; i < n; i++)
+			ps.add(pair(2 * i, i));
+		for(int i = n - 1; i > 0; i--) {
+			int j = next() % (i + 1);
+			Pair<int, int> t = ps[i]; ps[i] = ps[j]; ps[j] = t;
+		}
+
+		{
+			ListMap<int, int> map;
+			perf::measure("ListMap put (sorted)", n, [&]() {
+				for(int i = n - 1; i >= 0; i--)
+					map.put(2 * i, i);
+			});
+			int lq = n <= 100 ? q : q / (n / 100);
+			sum += lookup("ListMap", map, n, lq);
+		}
+
+		{
+			avl::Map<int, int> map;
+			perf::measure("avl::Map put", n, [&]() {
+				for(auto p: ps)
+					map.put(p.fst, p.snd);
+			});
+			sum += lookup("avl::Map", map, n, q);
+		}
+
+		{
+			FlatMap<int, int> map;
+			if(n <= 10000)
+				perf::measure("FlatMap put", n, [&]() {
+					for(auto p: ps)
+						map.put(p.fst, p.snd);
+				});
+			perf::measure("FlatMap load", n, [&]() { map.load(ps); });
+			sum += lookup("FlatMap", map, n, q);
+		}
+	}
+
+	if(sum == 666)
+		cout << "unlikely\n";
+	return 0;
+}
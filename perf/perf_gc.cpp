@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_gc.cpp -- GC pauses of SimpleGC and GroupedGC.
+ *
+ * Usage: perf_gc [ACTIONS [BLOCKS [CHUNK_SIZE]]]
+ *
+ * Scaled-up version of test_simplegc: ACTIONS (default 100K) random
+ * allocations and releases keep up to BLOCKS (default 10K) live blocks
+ * of 8 to 512 bytes in a GC with chunks of CHUNK_SIZE (default 4 KiB)
+ * bytes. A collection is requested every 10K actions (SimpleGC also
+ * collects when its free list is exhausted) and every live block is marked
+ * twice. The number of collections, the total, average and maximum pause
+ * and the total time spent in marking are displayed.
+ */
+
+#include <elm/alloc/GroupedGC.h>
+#include <elm/alloc/SimpleGC.h>
+#include <elm/data/Vector.h>
+#include "perf.h"
+
+using namespace elm;
+
+static t::uint32 seed = 1;
+static inline int next(int n) { seed = seed * 1103515245 + 12345; return (seed >> 8) % n; }
+
+class Pauses {
+public:
+	Pauses(void): cnt(0), total(0), max(0), mark(0), start(0) { }
+	inline void begin(void) { start = perf::now(); }
+	inline void end(void) { t::int64 t = perf::now() - start; cnt++; total += t; if(t > max) max = t; }
+	inline void beginMark(void) { mstart = perf::now(); }
+	inline void endMark(void) { mark += perf::now() - mstart; }
+	void display(cstring label) {
+		cout << label << "\t" << io::fmt(cnt).width(6).right() << " GCs\t"
+			 << io::fmt(total).width(10).right() << " us total\t"
+			 << io::fmt(cnt ? total / cnt : 0).width(8).right() << " us avg\t"
+			 << io::fmt(max).width(8).right() << " us max\t"
+			 << io::fmt(mark).width(10).right() << " us marking" << io::endl;
+	}
+	int cnt;
+	t::int64 total, max, mark, start, mstart;
+};
+
+typedef Vector<Pair<void *, int> > blocks_t;
+
+template <class G>
+class MyGC: public G {
+public:
+	MyGC(blocks_t& blocks, t::size size): G(size), _blocks(blocks) { }
+	Pauses pauses;
+protected:
+	void beginGC(void) override { pauses.begin(); G::beginGC(); }
+	void collect(void) override {
+		pauses.beginMark();
+		for(int r = 0; r < 2; r++)
+			for(const auto& b: _blocks)
+				G::mark(b.fst, b.snd);
+		pauses.endMark();
+	}
+	void endGC(void) override { G::endGC(); pauses.end(); }
+private:
+	blocks_t& _blocks;
+};
+
+template <class G>
+void run(cstring label, int n, int m, int csize) {
+	blocks_t blocks;
+	MyGC<G> gc(blocks, csize);
+	seed = 1;
+	t::int64 t = perf::now();
+	for(int i = 0; i < n; i++) {
+		if(i % 10000 == 9999)
+			gc.doGC();
+		if(blocks.count() < m && (blocks.isEmpty() || next(100) < 55)) {
+			int size = 8 + next(505);
+			blocks.add(pair(gc.allocate(size), size));
+		}
+		else {
+			int p = next(blocks.count());
+			blocks[p] = blocks.top();
+			blocks.pop();
+		}
+	}
+	t = perf::now() - t;
+	gc.pauses.display(label);
+	cout << "\t" << n << " actions in " << t << " us\n";
+}
+
+int main(int argc, char **argv) {
+	int n = perf::arg(argc, argv, 1, 100000);
+	int m = perf::arg(argc, argv, 2, 10000);
+	int c = perf::arg(argc, argv, 3, 4096);
+	run<SimpleGC>("SimpleGC", n, m, c);
+	run<GroupedGC>("GroupedGC", n, m, c);
+	return 0;
+}
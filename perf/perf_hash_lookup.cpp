@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_hash_lookup.cpp -- read-heavy multi-threaded look-ups in HashMap.
+ *
+ * Usage: perf_hash_lookup [MAX_THREADS [LOOKUPS]]
+ *
+ * Compares ReadOnlyLookup (no lock needed) with MoveToFrontLookup
+ * (look-ups modify the table and must be protected by a mutex).
+ */
+
+#include <elm/data/HashMap.h>
+#include <elm/data/Vector.h>
+#include <elm/sys/Thread.h>
+#include "perf.h"
+
+using namespace elm;
+
+typedef HashMap<int, int> ro_map_t;
+typedef HashMap<int, int, HashKey<int>, DefaultAlloc, Equiv<int>, MoveToFrontLookup> mtf_map_t;
+
+static const int KEYS = 100000;
+
+template <class M>
+class Reader: public sys::Runnable {
+public:
+	Reader(const M& map, int n, int seed, sys::Mutex *mutex = nullptr)
+		: _map(map), _n(n), _seed(seed), _mutex(mutex), sum(0) { }
+	void run(void) override {
+		t::uint32 x = _seed;
+		for(int i = 0; i < _n; i++) {
+			x = x * 1103515245 + 12345;
+			int k = (x >> 8) % KEYS;
+			if(_mutex) {
+				_mutex->lock();
+				sum += _map.get(k, 0);
+				_mutex->unlock();
+			}
+			else
+				sum += _map.get(k, 0);
+		}
+	}
+private:
+	const M& _map;
+	int _n, _seed;
+	sys::Mutex *_mutex;
+public:
+	int sum;
+};
+
+template <class M>
+void run(cstring label, const M& map, int threads, int n, bool lock) {
+	sys::Mutex *mutex = lock ? sys::Mutex::make() : nullptr;
+	Vector<Reader<M> *> readers;
+	Vector<sys::Thread *> thrs;
+	for(int i = 0; i < threads; i++) {
+		readers.add(new Reader<M>(map, n, i + 1, mutex));
+		thrs.add(sys::Thread::make(*readers[i]));
+	}
+	perf::measure(_ << label << " x" << threads, t::int64(n) * threads, [&]() {
+		for(auto t: thrs)
+			t->start();
+		for(auto t: thrs)
+			t->join();
+	});
+	for(int i = 0; i < threads; i++) {
+		delete thrs[i];
+		delete readers[i];
+	}
+	delete mutex;
+}
+
+int main(int argc, char **argv) {
+	int max = perf::arg(argc, argv, 1, 8);
+	int n = perf::arg(argc, argv, 2, 2000000);
+	ro_map_t ro;
+	mtf_map_t mtf;
+	for(int i = 0; i < KEYS; i++) {
+		ro.put(i, i);
+		mtf.put(i, i);
+	}
+	for(int t = 1; t <= max; t <<= 1) {
+		run("read-only", ro, t, n, false);
+		run("read-only+mutex", ro, t, n, true);
+		if(t == 1)
+			run("move-to-front", mtf, t, n, false);
+		run("move-to-front+mutex", mtf, t, n, true);
+	}
+	return 0;
+}
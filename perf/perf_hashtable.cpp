@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_hashtable.cpp -- compare HashMap and FlatHashMap.
+ *
+ * Usage: perf_hashtable [MAX_SIZE]
+ * The benchmark runs with 1K, 1M and 10M entries (limited by MAX_SIZE).
+ */
+
+#include <elm/data/FlatHashMap.h>
+#include <elm/data/HashMap.h>
+#include "perf.h"
+
+using namespace elm;
+
+static inline t::intptr key(int i) { return t::intptr(i) * 2654435761U; }
+
+template <class M>
+void run(cstring name, int n) {
+	cout << "== " << name << " (" << n << " entries)\n";
+	M *map = new M();
+	int sum = 0;
+	perf::measure("insert", n, [&]() {
+		for(int i = 0; i < n; i++)
+			map->put(key(i), i);
+	});
+	perf::measure("hit", n, [&]() {
+		for(int i = 0; i < n; i++)
+			sum += map->get(key(i), 0);
+	});
+	perf::measure("miss", n, [&]() {
+		for(int i = 0; i < n; i++)
+			sum += map->get(key(i + n), 0);
+	});
+	perf::measure("iterate", n, [&]() {
+		for(auto x: *map)
+			sum += x;
+	});
+	perf::measure("remove", n, [&]() {
+		for(int i = 0; i < n; i++)
+			map->remove(key(i));
+	});
+	perf::measure("delete", n, [&]() { delete map; });
+	if(sum == 666)
+		cout << "unlikely\n";
+}
+
+int main(int argc, char **argv) {
+	int max = perf::arg(argc, argv, 1, 10000000);
+	static const int sizes[] = { 1000, 1000000, 10000000 };
+	for(int n: sizes) {
+		if(n > max)
+			break;
+		run<HashMap<t::intptr, int> >("HashMap", n);
+		run<FlatHashMap<t::intptr, int> >("FlatHashMap", n);
+	}
+	return 0;
+}
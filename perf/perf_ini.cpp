@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_ini.cpp -- name-heavy workload on String.
+ *
+ * Usage: perf_ini [SECTIONS [KEYS]]
+ *
+ * Generate an INI text with SECTIONS (default 2000) sections of KEYS
+ * (default 10) short keys and values, then measure the loading of the
+ * text with ini::File, the look-up of all keys, and the building of short
+ * names from C strings and by concatenation. For each test, the number of
+ * memory allocations (operator new) is displayed.
+ */
+
+#include <new>
+#include <stdlib.h>
+#include <elm/ini.h>
+#include <elm/io/BlockInStream.h>
+#include <elm/string/StringBuffer.h>
+#include "perf.h"
+
+using namespace elm;
+
+static t::int64 allocs = 0;
+
+void *operator new(size_t size) {
+	allocs++;
+	void *p = malloc(size ? size : 1);
+	if(!p)
+		throw std::bad_alloc();
+	return p;
+}
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+
+template <class F>
+void measure(cstring label, t::int64 n, F f) {
+	t::int64 a = allocs;
+	perf::measure(label, n, f);
+	cout << "\t" << (allocs - a) << " allocations\n";
+}
+
+int main(int argc, char **argv) {
+	int ns = perf::arg(argc, argv, 1, 2000);
+	int nk = perf::arg(argc, argv, 2, 10);
+	t::int64 total = 0;
+
+	StringBuffer buf;
+	for(int s = 0; s < ns; s++) {
+		buf << "[section_" << s << "]\n";
+		for(int k = 0; k < nk; k++)
+			buf << "key_" << k << " = value_" << s << "_" << k << "\n";
+	}
+	string text = buf.toString();
+	cout << "== " << ns << " sections, " << nk << " keys, " << text.length() << " bytes\n";
+
+	ini::File *file = nullptr;
+	measure("load     ", t::int64(ns) * nk, [&]() {
+		io::BlockInStream in(text);
+		file = ini::File::load(&in);
+	});
+
+	Vector<string> keys;
+	for(int k = 0; k < nk; k++)
+		keys.add(_ << "key_" << k);
+	measure("get      ", t::int64(ns) * nk, [&]() {
+		for(auto s: *file)
+			for(const auto& k: keys)
+				total += s->get(k).length();
+	});
+	delete file;
+
+	const char *names[] = { "main", "elm::String", "_ZN3elm6StringD2Ev", "/usr/lib/libelm.so", "a_somewhat_longer_identifier" };
+	int n = 1000000;
+	measure("make     ", n, [&]() {
+		for(int i = 0; i < n; i++) {
+			string s = names[i % 5];
+			total += s.length();
+		}
+	});
+	measure("concat   ", n, [&]() {
+		for(int i = 0; i < n; i++) {
+			string s = string(names[i % 4]) + "@plt";
+			total += s.length();
+		}
+	});
+	measure("substring", n, [&]() {
+		for(int i = 0; i < n; i++)
+			total += text.substring(i % 1000, 12).toCString().length();
+	});
+
+	if(total == 666)
+		cout << "unlikely\n";
+	return 0;
+}
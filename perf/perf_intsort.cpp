@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_intsort.cpp -- quicksort, radixsort and par::mergesort on integer keys.
+ *
+ * Usage: perf_intsort [COUNT [THREADS]]
+ * Sort COUNT random t::uint32 and t::uint64 keys (default 1M and 50M) with
+ * each algorithm. par::mergesort uses a pool of THREADS threads (default: one
+ * per core).
+ */
+
+#include <elm/data/par.h>
+#include <elm/data/quicksort.h>
+#include <elm/data/radixsort.h>
+#include <elm/data/Vector.h>
+#include "perf.h"
+
+using namespace elm;
+
+static t::uint64 x = 88172645463325252ULL;
+static inline t::uint64 next(void) { x ^= x << 13; x ^= x >> 7; x ^= x << 17; return x; }
+
+template <class T>
+void run(const char *name, int n, sys::ThreadPool& pool, t::uint64& sum) {
+	cout << "== " << name << " (" << n << " random keys, " << pool.threadCount() << " threads)\n";
+	Vector<T> v(n), r(n);
+	for(int i = 0; i < n; i++)
+		r.add(T(next()));
+	v = r;
+	perf::measure("quicksort", n, [&]() { quicksort(v); });
+	sum += v[n / 2];
+	v = r;
+	perf::measure("radixsort", n, [&]() { radixsort(v); });
+	sum += v[n / 2];
+	v = r;
+	perf::measure("par::mergesort", n, [&]() { par::mergesort(v, Comparator<T>(), pool); });
+	sum += v[n / 2];
+}
+
+int main(int argc, char **argv) {
+	int n = perf::arg(argc, argv, 1, 0);
+	sys::ThreadPool pool(perf::arg(argc, argv, 2, 0));
+	t::uint64 sum = 0;
+
+	if(n != 0) {
+		run<t::uint32>("uint32", n, pool, sum);
+		run<t::uint64>("uint64", n, pool, sum);
+	}
+	else {
+		int sizes[] = { 1000000, 50000000 };
+		for(auto s: sizes) {
+			run<t::uint32>("uint32", s, pool, sum);
+			run<t::uint64>("uint64", s, pool, sum);
+		}
+	}
+
+	if(sum == 666)
+		cout << "unlikely\n";
+	return 0;
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_par.cpp -- scaling of par algorithms against data/util.h ones.
+ *
+ * Usage: perf_par [COUNT [MAX_THREADS]]
+ * Run map, reduce, count and forEach on a Vector of COUNT (default 10M)
+ * doubles, sequentially and with pools of 1, 2, 4... MAX_THREADS threads
+ * (default: number of cores).
+ */
+
+#include <math.h>
+#include <elm/data/par.h>
+#include <elm/data/util.h>
+#include <elm/data/Vector.h>
+#include <elm/sys/System.h>
+#include "perf.h"
+
+using namespace elm;
+
+int main(int argc, char **argv) {
+	int n = perf::arg(argc, argv, 1, 10000000);
+	int m = perf::arg(argc, argv, 2, sys::System::coreCount());
+	double sum = 0;
+	Vector<double> v(n), w(n);
+	for(int i = 0; i < n; i++)
+		v.add(i * .5);
+
+	cout << "== sequential (" << n << " items)\n";
+	perf::measure("map", n, [&]() { w.clear(); map(v, [](double x) { return sqrt(x); }, w); });
+	perf::measure("reduce", n, [&]() { sum += fold(v, [](double x, double s) { return x + s; }, 0.); });
+	perf::measure("count", n, [&]() { sum += count(v, [](double x) { return sqrt(x) < 1000; }); });
+	perf::measure("forEach", n, [&]() { iter(w, [&](double x) { sum += sqrt(x); }); });
+
+	for(int t = 1; t <= m; t *= 2) {
+		sys::ThreadPool pool(t);
+		cout << "== par (" << n << " items, " << t << " threads)\n";
+		perf::measure("map", n, [&]() { w.clear(); par::map(v, [](double x) { return sqrt(x); }, w, pool); });
+		perf::measure("reduce", n, [&]() { sum += par::sum(v, pool); });
+		perf::measure("count", n, [&]() { sum += par::count(v, [](double x) { return sqrt(x) < 1000; }, pool); });
+		perf::measure("forEach", n, [&]() { par::forEach(w, [](double& x) { x = sqrt(x); }, pool); });
+		if(t < m && 2 * t > m)
+			t = m / 2;
+	}
+
+	if(sum == 666)
+		cout << "unlikely\n";
+	return 0;
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_relocate.cpp -- element-wise versus memcpy copy and relocation of arrays.
+ *
+ * Usage: perf_relocate [SIZE] [ROUNDS]
+ * For each tested type, an array of SIZE items (default 1M) is copied and
+ * relocated ROUNDS times (default 20) element by element (array::slow)
+ * and with the array functions (that use memcpy() for trivial types, and
+ * for relocatable types in the case of relocation). Then a Vector of SIZE
+ * items is built by successive additions.
+ */
+
+#include <elm/data/Vector.h>
+#include <elm/util/Pair.h>
+#include "perf.h"
+
+using namespace elm;
+
+template <class T>
+static void run(cstring name, int n, int r) {
+	cout << "== " << name << " (" << n << " items x " << r << ")\n";
+	T *s = static_cast<T *>(::operator new(n * sizeof(T)));
+	T *t = static_cast<T *>(::operator new(n * sizeof(T)));
+	array::slow<T>::construct(s, n);
+	array::slow<T>::construct(t, n);
+
+	perf::measure("copy (element-wise)", t::int64(n) * r, [&]() {
+		for(int i = 0; i < r; i++)
+			array::slow<T>::copy(t, s, n);
+	});
+	perf::measure("copy (array::copy)", t::int64(n) * r, [&]() {
+		for(int i = 0; i < r; i++)
+			array::copy(t, s, n);
+	});
+	perf::measure("grow (element-wise)", t::int64(n) * r, [&]() {
+		for(int i = 0; i < r; i++) {
+			T *u = static_cast<T *>(::operator new(n * sizeof(T)));
+			array::slow<T>::construct(u, n);
+			array::slow<T>::relocate(u, t, n);
+			array::slow<T>::destruct(t, n);
+			::operator delete(t);
+			t = u;
+		}
+	});
+	perf::measure("grow (array::transfer)", t::int64(n) * r, [&]() {
+		for(int i = 0; i < r; i++) {
+			T *u = static_cast<T *>(::operator new(n * sizeof(T)));
+			array::transfer(u, t, n);
+			::operator delete(t);
+			t = u;
+		}
+	});
+
+	array::slow<T>::destruct(s, n);
+	array::slow<T>::destruct(t, n);
+	::operator delete(s);
+	::operator delete(t);
+
+	Vector<T> v;
+	perf::measure("Vector::add", n, [&]() {
+		for(int i = 0; i < n; i++)
+			v.add(T());
+	});
+	Vector<T> w;
+	perf::measure("Vector::copy", t::int64(n) * r, [&]() {
+		for(int i = 0; i < r; i++)
+			w = v;
+	});
+}
+
+int main(int argc, char **argv) {
+	int n = perf::arg(argc, argv, 1, 1000000);
+	int r = perf::arg(argc, argv, 2, 20);
+	run<int>("int", n, r);
+	run<Pair<int, void *> >("Pair<int, void *>", n, r);
+	run<string>("string", n, r);
+	return 0;
+}
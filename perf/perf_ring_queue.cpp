@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_ring_queue.cpp -- throughput of SPSCQueue and MPMCQueue.
+ *
+ * Usage: perf_ring_queue [COUNT [MAX_THREADS [CAPACITY]]]
+ *
+ * COUNT (default 1M) integers are passed from producer threads to
+ * consumer threads through a queue of CAPACITY (default 1024) items:
+ * SPSCQueue, MPMCQueue or VectorQueue protected by a sys::Mutex.
+ * The SPSC run uses 1 producer and 1 consumer, the MPMC runs use 1, 2...
+ * MAX_THREADS (default 4) producers and as many consumers.
+ */
+
+#include <elm/data/MPMCQueue.h>
+#include <elm/data/SPSCQueue.h>
+#include <elm/data/Vector.h>
+#include <elm/data/VectorQueue.h>
+#include <elm/sys/Thread.h>
+#include "perf.h"
+
+using namespace elm;
+
+class LockedQueue {
+public:
+	LockedQueue(int cap): _mutex(sys::Mutex::make()), _cap(cap), _cnt(0) { }
+	~LockedQueue(void) { delete _mutex; }
+	bool tryPut(int x) {
+		_mutex->lock();
+		bool r = _cnt < _cap;
+		if(r) { _q.put(x); _cnt++; }
+		_mutex->unlock();
+		return r;
+	}
+	bool tryGet(int& x) {
+		_mutex->lock();
+		bool r = _cnt > 0;
+		if(r) { x = _q.get(); _cnt--; }
+		_mutex->unlock();
+		return r;
+	}
+	inline void put(int x) { ring::Backoff b; while(!tryPut(x)) b.wait(); }
+	inline int get(void) { int x; ring::Backoff b; while(!tryGet(x)) b.wait(); return x; }
+private:
+	sys::Mutex *_mutex;
+	VectorQueue<int> _q;
+	int _cap, _cnt;
+};
+
+template <class Q>
+class Producer: public sys::Runnable {
+public:
+	Producer(Q& q, int n): _q(q), _n(n) { }
+	void run(void) override { for(int i = 0; i < _n; i++) _q.put(i); }
+private:
+	Q& _q;
+	int _n;
+};
+
+template <class Q>
+class Consumer: public sys::Runnable {
+public:
+	Consumer(Q& q, int n): _q(q), _n(n), sum(0) { }
+	void run(void) override { for(int i = 0; i < _n; i++) sum += _q.get(); }
+private:
+	Q& _q;
+	int _n;
+public:
+	t::int64 sum;
+};
+
+template <class Q>
+t::int64 run(cstring label, int threads, int n, int cap) {
+	Q q(cap);
+	int m = n / threads;
+	Vector<sys::Runnable *> works;
+	Vector<sys::Thread *> thrs;
+	Vector<Consumer<Q> *> cons;
+	for(int i = 0; i < threads; i++) {
+		works.add(new Producer<Q>(q, m));
+		cons.add(new Consumer<Q>(q, m));
+		works.add(cons[i]);
+	}
+	for(auto w: works)
+		thrs.add(sys::Thread::make(*w));
+	perf::measure(_ << label << " x" << threads, t::int64(m) * threads, [&]() {
+		for(auto t: thrs)
+			t->start();
+		for(auto t: thrs)
+			t->join();
+	});
+	t::int64 sum = 0;
+	for(auto c: cons)
+		sum += c->sum;
+	for(int i = 0; i < works.length(); i++) {
+		delete thrs[i];
+		delete works[i];
+	}
+	return sum;
+}
+
+int main(int argc, char **argv) {
+	int n = perf::arg(argc, argv, 1, 1000000);
+	int max = perf::arg(argc, argv, 2, 4);
+	int cap = perf::arg(argc, argv, 3, 1024);
+	t::int64 sum = 0;
+
+	cout << "== 1 producer, 1 consumer\n";
+	sum += run<LockedQueue>("VectorQueue+mutex", 1, n, cap);
+	sum += run<SPSCQueue<int> >("SPSCQueue", 1, n, cap);
+	sum += run<MPMCQueue<int> >("MPMCQueue", 1, n, cap);
+	for(int t = 2; t <= max; t *= 2) {
+		cout << "== " << t << " producers, " << t << " consumers\n";
+		sum += run<LockedQueue>("VectorQueue+mutex", t, n, cap);
+		sum += run<MPMCQueue<int> >("MPMCQueue", t, n, cap);
+	}
+
+	if(sum == 666)
+		cout << "unlikely\n";
+	return 0;
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_roaring.cpp -- RoaringVector against WAHVector and BitVector.
+ *
+ * Usage: perf_roaring [BITS [QUERIES]]
+ *
+ * Build two vectors of BITS (default 4M) bits with a sparse pattern
+ * (0.05% of random ones) and with a clustered pattern (100 runs of up to
+ * 10K ones), then measure the memory size, QUERIES (default 100K) random
+ * bit() look-ups (a hundredth for WAHVector whose look-up is linear) and
+ * OR, AND and RESET of both vectors and countOnes() (10 times each).
+ */
+
+#include <elm/data/Vector.h>
+#include <elm/util/BitVector.h>
+#include <elm/util/RoaringVector.h>
+#include <elm/util/WAHVector.h>
+#include "perf.h"
+
+using namespace elm;
+
+static t::uint32 seed = 1;
+static inline int next(void) { seed = seed * 1103515245 + 12345; return seed >> 1; }
+
+static t::int64 total = 0;
+static const int R = 10;
+
+template <class V>
+void bench(cstring label, int n, int q, const Vector<int>& s1, const Vector<int>& s2) {
+	V v1(n), v2(n);
+	perf::measure(_ << label << " set   ", s1.count() + s2.count(), [&]() {
+		for(auto i: s1)
+			v1.set(i);
+		for(auto i: s2)
+			v2.set(i);
+	});
+	cout << label << " memory\t" << io::fmt(t::size(v1.__size())).width(10).right() << " bytes\n";
+	perf::measure(_ << label << " bit   ", q, [&]() {
+		for(int i = 0; i < q; i++)
+			total += v1.bit(next() % n);
+	});
+	perf::measure(_ << label << " or    ", R, [&]() {
+		for(int i = 0; i < R; i++)
+			total += v1.makeOr(v2).countBits();
+	});
+	perf::measure(_ << label << " and   ", R, [&]() {
+		for(int i = 0; i < R; i++)
+			total += v1.makeAnd(v2).countBits();
+	});
+	perf::measure(_ << label << " reset ", R, [&]() {
+		for(int i = 0; i < R; i++)
+			total += v1.makeReset(v2).countBits();
+	});
+	perf::measure(_ << label << " count ", R, [&]() {
+		for(int i = 0; i < R; i++)
+			total += v1.countBits();
+	});
+}
+
+int main(int argc, char **argv) {
+	int n = perf::arg(argc, argv, 1, 4 << 20);
+	int q = perf::arg(argc, argv, 2, 100000);
+
+	for(int p = 0; p < 2; p++) {
+		Vector<int> s1, s2;
+		if(p == 0) {
+			cout << "== sparse, " << n << " bits\n";
+			for(int i = 0; i < n / 2000; i++) {
+				s1.add(next() % n);
+				s2.add(next() % n);
+			}
+		}
+		else {
+			cout << "== clustered, " << n << " bits\n";
+			for(int k = 0; k < 100; k++) {
+				int b1 = next() % n, l1 = next() % 10000;
+				int b2 = next() % n, l2 = next() % 10000;
+				for(int i = b1; i < b1 + l1 && i < n; i++)
+					s1.add(i);
+				for(int i = b2; i < b2 + l2 && i < n; i++)
+					s2.add(i);
+			}
+		}
+		bench<BitVector>("BitVector    ", n, q, s1, s2);
+		bench<WAHVector>("WAHVector    ", n, q / 100, s1, s2);
+		bench<RoaringVector>("RoaringVector", n, q, s1, s2);
+	}
+
+	if(total == 666)
+		cout << "unlikely\n";
+	return 0;
+}
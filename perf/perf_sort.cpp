@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_sort.cpp -- quicksort (introsort) and mergesort on several input shapes.
+ *
+ * Usage: perf_sort [COUNT]
+ * Sort COUNT (default 1M) integers that are random, sorted, reversed, with
+ * few unique values (16) and organ-pipe shaped, in a Vector, and random
+ * integers in a FragTable.
+ */
+
+#include <elm/data/FragTable.h>
+#include <elm/data/quicksort.h>
+#include <elm/data/Vector.h>
+#include "perf.h"
+
+using namespace elm;
+
+static t::uint64 x = 88172645463325252ULL;
+static inline int next(void) { x ^= x << 13; x ^= x >> 7; x ^= x << 17; return int(x >> 33); }
+
+static void make(Vector<int>& v, int n, int shape) {
+	v.clear();
+	for(int i = 0; i < n; i++)
+		switch(shape) {
+		case 0:	v.add(next()); break;
+		case 1:	v.add(i); break;
+		case 2:	v.add(n - i); break;
+		case 3:	v.add(next() % 16); break;
+		case 4:	v.add(i < n / 2 ? i : n - i); break;
+		}
+}
+
+int main(int argc, char **argv) {
+	int n = perf::arg(argc, argv, 1, 1000000);
+	const char *shapes[] = { "random", "sorted", "reversed", "few-unique", "organ-pipe" };
+	Vector<int> v(n);
+	t::int64 sum = 0;
+
+	cout << "== quicksort (" << n << " items)\n";
+	for(int s = 0; s < 5; s++) {
+		make(v, n, s);
+		perf::measure(shapes[s], n, [&]() { quicksort(v); });
+		sum += v[n / 2];
+	}
+
+	cout << "== mergesort (" << n << " items)\n";
+	for(int s = 0; s < 5; s++) {
+		make(v, n, s);
+		perf::measure(shapes[s], n, [&]() { mergesort(v); });
+		sum += v[n / 2];
+	}
+
+	cout << "== FragTable (" << n << " random items)\n";
+	FragTable<int> f;
+	for(int i = 0; i < n; i++)
+		f.add(next());
+	perf::measure("quicksort", n, [&]() { quicksort(f); });
+	for(int i = 0; i < n; i++)
+		f[i] = next();
+	perf::measure("mergesort", n, [&]() { mergesort(f); });
+	sum += f[n / 2];
+
+	if(sum == 666)
+		cout << "unlikely\n";
+	return 0;
+}
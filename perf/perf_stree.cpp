@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_stree.cpp -- pointer to chunk look-up in stree::Tree.
+ *
+ * Usage: perf_stree [CHUNKS [LOOKUPS]]
+ *
+ * Build a segment tree mapping CHUNKS (default 64K) chunks of 64 KiB
+ * (scattered in the address space as GC chunks would be) to their
+ * descriptor and look up LOOKUPS (default 10M) random pointers inside
+ * the chunks. The Eytzinger layout of stree::Tree (single and batched
+ * look-ups) is compared with a descent in the linked node layout produced
+ * by stree::Builder (the previous representation of stree::Tree).
+ */
+
+#include <elm/stree/SegmentBuilder.h>
+#include <elm/data/Vector.h>
+#include "perf.h"
+
+using namespace elm;
+
+typedef stree::Tree<void *, int> tree_t;
+typedef tree_t::node_t node_t;
+static const t::intptr CHUNK = 1 << 16;
+
+// linked node layout, as built by stree::Builder
+class NodeTree: public stree::Builder<void *, int> {
+public:
+	NodeTree(const Vector<t::intptr>& bases) {
+		int n = bases.count(), s = n;
+		nodes = allocate(n);
+		for(int i = 0; i < n; i++) {
+			nodes[i] = node_t((void *)bases[i], (void *)(bases[i] + CHUNK));
+			nodes[i].data = i;
+		}
+		root = make(nodes, s, 0, n - 1);
+	}
+	~NodeTree(void) { delete [] nodes; }
+	const int *find(void *key) const {
+		typedef Comparator<void *> C;
+		if(C::compare(key, nodes[root].lowerBound()) < 0 || C::compare(key, nodes[root].upperBound()) > 0)
+			return nullptr;
+		int i = root;
+		while(!nodes[i].isLeaf()) {
+			if(C::compare(key, nodes[nodes[i].right()].lowerBound()) < 0)
+				i = nodes[i].left();
+			else
+				i = nodes[i].right();
+		}
+		return &nodes[i].data;
+	}
+private:
+	node_t *nodes;
+	int root;
+};
+
+static t::uint64 seed = 1;
+static inline t::uint64 next(void) { seed = seed * 6364136223846793005ULL + 1442695040888963407ULL; return seed >> 16; }
+
+int main(int argc, char **argv) {
+	int n = perf::arg(argc, argv, 1, 1 << 16);
+	int q = perf::arg(argc, argv, 2, 10000000);
+	t::int64 sum = 0;
+
+	// chunks contiguous by runs, separated by holes
+	Vector<t::intptr> bases;
+	t::intptr a = 0x10000000;
+	for(int i = 0; i < n; i++) {
+		if(next() % 4 == 0)
+			a += CHUNK * (1 + next() % 16);
+		bases.add(a);
+		a += CHUNK;
+	}
+
+	// random pointers in the chunks
+	Vector<void *> ptrs(q);
+	for(int i = 0; i < q; i++)
+		ptrs.add((void *)(bases[next() % n] + next() % CHUNK));
+
+	cout << "== " << n << " chunks, " << q << " look-ups\n";
+	{
+		NodeTree tree(bases);
+		perf::measure("linked nodes", q, [&]() {
+			for(int i = 0; i < q; i++)
+				sum += *tree.find(ptrs[i]);
+		});
+	}
+
+	stree::SegmentBuilder<void *, int> builder(-1);
+	for(int i = 0; i < n; i++)
+		builder.add((void *)bases[i], (void *)(bases[i] + CHUNK), i);
+	tree_t tree;
+	builder.make(tree);
+	perf::measure("Eytzinger", q, [&]() {
+		for(int i = 0; i < q; i++)
+			sum += tree.get(ptrs[i], -1);
+	});
+	const int B = 256;
+	int *res[B];
+	perf::measure("Eytzinger batched", q, [&]() {
+		for(int i = 0; i < q; i += B) {
+			int m = q - i < B ? q - i : B;
+			tree.find(ptrs.asArray().buffer() + i, res, m);
+			for(int j = 0; j < m; j++)
+				sum += *res[j];
+		}
+	});
+
+	if(sum == 666)
+		cout << "unlikely\n";
+	return 0;
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_string.cpp -- copy-heavy workloads on String.
+ *
+ * Usage: perf_string [COPIES]
+ *
+ * Measure COPIES (default 10M) copies and releases of a String, of
+ * substrings, of a vector of strings and of copies performed from several
+ * threads of a ThreadPool on shared strings. The reference counts of String
+ * are atomic unless the library and this program are built with
+ * ELM_NO_STRING_ATOMIC: build it both ways to compare.
+ */
+
+#include <elm/data/Vector.h>
+#include <elm/sys/ThreadPool.h>
+#include "perf.h"
+
+using namespace elm;
+
+int main(int argc, char **argv) {
+	int n = perf::arg(argc, argv, 1, 10000000);
+	t::int64 total = 0;
+
+#	ifdef ELM_NO_STRING_ATOMIC
+		cout << "== plain reference counts\n";
+#	else
+		cout << "== atomic reference counts\n";
+#	endif
+
+	string s = "a string long enough to not be trivial";
+	perf::measure("copy          ", n, [&]() {
+		for(int i = 0; i < n; i++) {
+			string c = s;
+			total += c.length();
+		}
+	});
+	perf::measure("assign        ", n, [&]() {
+		string c;
+		for(int i = 0; i < n; i++) {
+			c = s;
+			total += c.length();
+		}
+	});
+	perf::measure("substring     ", n, [&]() {
+		for(int i = 0; i < n; i++)
+			total += s.substring(i & 15, 10).length();
+	});
+
+	Vector<string> v;
+	for(int i = 0; i < 1000; i++)
+		v.add(_ << "item " << i);
+	int r = n / v.count();
+	perf::measure("vector copy   ", t::int64(r) * v.count(), [&]() {
+		for(int i = 0; i < r; i++) {
+			Vector<string> w(v);
+			total += w[i % w.count()].length();
+		}
+	});
+
+	sys::ThreadPool pool(4);
+	perf::measure("shared copy x4", n, [&]() {
+		pool.forEach(4, [&](int k) {
+			t::int64 l = 0;
+			for(int i = k; i < n; i += 4) {
+				string c = v[i % v.count()];
+				l += c.length();
+			}
+			__atomic_add_fetch(&total, l, __ATOMIC_RELAXED);
+		});
+	});
+
+	if(total == 666)
+		cout << "unlikely\n";
+	return 0;
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_string_buffer.cpp -- building big strings with StringBuffer.
+ *
+ * Usage: perf_string_buffer [PIECES [REPEATS]]
+ *
+ * Append PIECES (default 1M) small pieces (a word and an integer, about 10
+ * characters) to a StringBuffer and convert it to a String, without and with
+ * a prior reserve(), then write the same pieces as raw bytes to a
+ * BlockOutStream. Each measure is repeated REPEATS (default 5) times.
+ */
+
+#include <elm/io/BlockOutStream.h>
+#include <elm/string.h>
+#include "perf.h"
+
+using namespace elm;
+
+static t::int64 total = 0;
+
+int main(int argc, char **argv) {
+	int n = perf::arg(argc, argv, 1, 1000000);
+	int r = perf::arg(argc, argv, 2, 5);
+	int len = 0;
+
+	perf::measure("StringBuffer          ", n * r, [&]() {
+		for(int k = 0; k < r; k++) {
+			StringBuffer buf;
+			for(int i = 0; i < n; i++)
+				buf << "piece " << i << ';';
+			string s = buf.toString();
+			len = s.length();
+			total += s[len / 2];
+		}
+	});
+	cout << "string length\t" << len << " chars\n";
+
+	perf::measure("StringBuffer reserve  ", n * r, [&]() {
+		for(int k = 0; k < r; k++) {
+			StringBuffer buf;
+			buf.reserve(len);
+			for(int i = 0; i < n; i++)
+				buf << "piece " << i << ';';
+			string s = buf.toString();
+			total += s[s.length() / 2];
+		}
+	});
+
+	perf::measure("BlockOutStream        ", n * r, [&]() {
+		for(int k = 0; k < r; k++) {
+			io::BlockOutStream out;
+			for(int i = 0; i < n; i++)
+				out.write("piece;", 6);
+			total += out.size();
+		}
+	});
+
+	if(total == 666)
+		cout << "unlikely\n";
+	return 0;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_symbol.cpp -- Symbol against String as names.
+ *
+ * Usage: perf_symbol [NAMES [QUERIES]]
+ *
+ * Build NAMES (default 1000) names of 6 to 40 characters, then measure
+ * QUERIES (default 10M) equality tests between two random names, look-ups
+ * in a HashMap keyed by the names and the interning of the names (the cost
+ * paid once per name read from a file).
+ */
+
+#include <elm/data/HashMap.h>
+#include <elm/data/Vector.h>
+#include <elm/string/Symbol.h>
+#include "perf.h"
+
+using namespace elm;
+
+static t::uint32 seed = 1;
+static inline int next(void) { seed = seed * 1103515245 + 12345; return seed >> 16; }
+
+static t::int64 total = 0;
+
+int main(int argc, char **argv) {
+	int n = perf::arg(argc, argv, 1, 1000);
+	int q = perf::arg(argc, argv, 2, 10000000);
+
+	Vector<string> names;
+	for(int i = 0; i < n; i++) {
+		StringBuffer buf;
+		buf << "name_";
+		int l = next() % 36;
+		for(int j = 0; j < l; j++)
+			buf << char('a' + next() % 26);
+		buf << i;
+		names.add(buf.toString());
+	}
+	Vector<int> qs;
+	for(int i = 0; i < 1 << 20; i++)
+		qs.add(next() % n);
+	const int qm = (1 << 20) - 1;
+
+	// equality
+	Vector<string> ss;
+	Vector<Symbol> ys;
+	for(auto s: names) {
+		ss.add(string(s.chars(), s.length()));
+		ys.add(Symbol(s));
+	}
+	perf::measure("String ==  ", q, [&]() {
+		for(int i = 0; i < q; i++)
+			total += ss[qs[(2 * i) & qm]] == names[qs[(2 * i + 1) & qm]];
+	});
+	perf::measure("Symbol ==  ", q, [&]() {
+		for(int i = 0; i < q; i++)
+			total += ys[qs[(2 * i) & qm]] == ys[qs[(2 * i + 1) & qm]];
+	});
+
+	// hash map look-up
+	HashMap<string, int> smap;
+	HashMap<Symbol, int> ymap;
+	for(int i = 0; i < n; i++) {
+		smap.put(names[i], i);
+		ymap.put(ys[i], i);
+	}
+	perf::measure("String map ", q, [&]() {
+		for(int i = 0; i < q; i++)
+			total += smap.get(ss[qs[i & qm]], 0);
+	});
+	perf::measure("Symbol map ", q, [&]() {
+		for(int i = 0; i < q; i++)
+			total += ymap.get(ys[qs[i & qm]], 0);
+	});
+
+	// interning
+	int r = q / 10;
+	perf::measure("intern     ", r, [&]() {
+		for(int i = 0; i < r; i++)
+			total += Symbol(ss[qs[i & qm]]).length();
+	});
+
+	if(total == 666)
+		cout << "unlikely\n";
+	return 0;
+}
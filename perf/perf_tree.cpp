@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_tree.cpp -- sorted insertion in TreeBag, TreeMap and avl::Map.
+ *
+ * Usage: perf_tree [COUNT]
+ * COUNT keys (default 1M) are inserted in increasing order (the worst case
+ * of an unbalanced binary tree), then looked up, counted and removed.
+ */
+
+#include <elm/avl/Map.h>
+#include <elm/data/TreeBag.h>
+#include <elm/data/TreeMap.h>
+#include "perf.h"
+
+using namespace elm;
+
+int main(int argc, char **argv) {
+	int n = perf::arg(argc, argv, 1, 1000000);
+	int sum = 0;
+
+	{
+		cout << "== TreeBag<int> (" << n << " sorted keys)\n";
+		TreeBag<int> t;
+		perf::measure("insert", n, [&]() {
+			for(int i = 0; i < n; i++)
+				t.add(i);
+		});
+		perf::measure("lookup", n, [&]() {
+			for(int i = 0; i < n; i++)
+				sum += t.contains(i);
+		});
+		perf::measure("count", n, [&]() {
+			for(int i = 0; i < n; i++)
+				sum += t.count();
+		});
+		perf::measure("iterate", n, [&]() {
+			for(auto x: t)
+				sum += x;
+		});
+		perf::measure("remove", n, [&]() {
+			for(int i = 0; i < n; i++)
+				t.remove(i);
+		});
+	}
+
+	{
+		cout << "== TreeMap<int, int> (" << n << " sorted keys)\n";
+		TreeMap<int, int> m;
+		perf::measure("insert", n, [&]() {
+			for(int i = 0; i < n; i++)
+				m.put(i, i);
+		});
+		perf::measure("lookup", n, [&]() {
+			for(int i = 0; i < n; i++)
+				sum += m.get(i, 0);
+		});
+	}
+
+	{
+		cout << "== avl::Map<int, int> (" << n << " sorted keys)\n";
+		avl::Map<int, int> m;
+		perf::measure("insert", n, [&]() {
+			for(int i = 0; i < n; i++)
+				m.put(i, i);
+		});
+		perf::measure("lookup", n, [&]() {
+			for(int i = 0; i < n; i++)
+				sum += m.get(i, 0);
+		});
+	}
+
+	if(sum == 666)
+		cout << "unlikely\n";
+	return 0;
+}
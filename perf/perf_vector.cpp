@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * perf/perf_vector.cpp -- building a Vector<Vector<int> > by copy, move or emplace.
+ *
+ * Usage: perf_vector [COUNT] [INNER_SIZE]
+ * COUNT inner vectors (default 1M) of INNER_SIZE integers (default 16)
+ * are added to an outer vector that starts with the default capacity.
+ */
+
+#include <elm/data/Vector.h>
+#include "perf.h"
+
+using namespace elm;
+
+typedef Vector<int> inner_t;
+typedef Vector<inner_t> outer_t;
+
+static inline void fill(inner_t& v, int m, int x) {
+	for(int j = 0; j < m; j++)
+		v.add(x + j);
+}
+
+static int check(const outer_t& v) {
+	int sum = 0;
+	for(const auto& x: v)
+		sum += x.count() ? x[0] : 0;
+	return sum;
+}
+
+int main(int argc, char **argv) {
+	int n = perf::arg(argc, argv, 1, 1000000);
+	int m = perf::arg(argc, argv, 2, 16);
+	int sum = 0;
+	cout << "== Vector<Vector<int> > (" << n << " x " << m << ")\n";
+
+	{
+		outer_t v;
+		perf::measure("add (copy)", n, [&]() {
+			for(int i = 0; i < n; i++) {
+				inner_t w(m);
+				fill(w, m, i);
+				v.add(w);
+			}
+		});
+		sum += check(v);
+	}
+
+	{
+		outer_t v;
+		perf::measure("add (move)", n, [&]() {
+			for(int i = 0; i < n; i++) {
+				inner_t w(m);
+				fill(w, m, i);
+				v.add(std::move(w));
+			}
+		});
+		sum += check(v);
+	}
+
+	{
+		outer_t v;
+		perf::measure("emplace", n, [&]() {
+			for(int i = 0; i < n; i++)
+				fill(v.emplace(m), m, i);
+		});
+		sum += check(v);
+		perf::measure("grow", n, [&]() { v.grow(v.capacity() * 2); });
+		outer_t w;
+		perf::measure("copy", n, [&]() { w = v; });
+		perf::measure("move", n, [&]() { w = std::move(v); });
+		sum += check(w);
+	}
+
+	if(sum == 666)
+		cout << "unlikely\n";
+	return 0;
+}
@@ -21,7 +21,6 @@
 
 #include <elm/assert.h>
 #include <elm/alloc/GroupedGC.h>
-#include <elm/stree/SegmentBuilder.h>
 
 //#define AZX
 //#define AZY
@@ -60,7 +59,7 @@ namespace elm {
  * @param size	Size of chunks.
  */
 GroupedGC::GroupedGC(t::size size)
-: csize(round(size)), needGC(false), st(0) {
+: csize(round(size)), needGC(false), pages(csize) {
 
 	//  S            exact-bins
 	//  *  |------------------------------|
@@ -139,6 +138,7 @@ GroupedGC::GroupedGC(t::size size)
 void GroupedGC::newChunk(int index) {
 	chunk_t *c = (chunk_t *)(new char[sizeof(chunk_t) + csize]);
 	chunks.add(c);
+	pages.add(c->buffer, csize, c);
 	c->bits = 0;
 	c->size = csize;
 	c->index = index;
@@ -171,6 +171,8 @@ GroupedGC::~GroupedGC(void) {
 void GroupedGC::clear(void) {
 	for(auto c: chunks)
 		delete c;
+	chunks.clear();
+	pages.clear();
 	free_list[0] = 0;
 }
 
@@ -358,8 +360,8 @@ bool GroupedGC::mark(void *data, t::size size) {
 #endif
 
 	// find the chunk
-	chunk_t *gcc = st->get(data);
-	ASSERTP(gcc, _ << "during GC, block out of chunks: " << (void *)data << ":" << io::hex(size) << "!");
+	chunk_t *gcc = static_cast<chunk_t *>(pages.get(data));
+	ASSERTP(gcc && static_cast<t::uint8 *>(data) >= gcc->buffer && static_cast<t::uint8 *>(data) < gcc->buffer + csize, _ << "during GC, block out of chunks: " << (void *)data << ":" << io::hex(size) << "!");
 
 	markDist[gcc->index]++;
 
@@ -383,17 +385,9 @@ bool GroupedGC::mark(void *data, t::size size) {
  * Called before a GC starts. Overriding methods must call this one.
  */
 void GroupedGC::beginGC(void) {
-	// build the data structure
-	stree::SegmentBuilder<void *, chunk_t *> builder(0);
-	for(auto c: chunks) {
-		builder.add(c->buffer, c->buffer + csize, c);
+	// allocate the marking bits
+	for(auto c: chunks)
 		c->bits = new BitVector(csize / (sizeof(block_t) * c->index));
-	}
-
-	// finalize the tree
-	st = new tree_t();
-	builder.make(*st);
-
 }
 
 
@@ -477,7 +471,6 @@ void GroupedGC::endGC(void) {
 		delete c->bits;
 		c->bits = 0;
 	}
-	delete st;
 
 
 
@@ -0,0 +1,167 @@
+/*
+ *	PageMap class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/assert.h>
+#include <elm/alloc/PageMap.h>
+
+namespace elm {
+
+/**
+ * @class PageMap
+ * Map from addresses to the memory chunks containing them, used by the
+ * garbage collectors (@ref SimpleGC, @ref GroupedGC) to find the chunk of
+ * a marked pointer in constant time.
+ *
+ * The address space is split in pages of a power of 2 size and
+ * the page number (address >> page shift) indexes a radix table of 3 levels:
+ * the inner tables and the leaves are only allocated for the parts of the
+ * address space containing chunks. The chunks are added incrementally with
+ * add(): there is no rebuild when the set of chunks changes.
+ *
+ * As the chunks are not aligned on pages, a page may be shared by the end
+ * of one chunk and the start of the next one: each page entry records both
+ * chunks and the address separating them. This requires the page size
+ * to be smaller or equal to the chunk size.
+ *
+ * Only addresses below 2^48 are supported (the user address space of current
+ * 64-bit systems).
+ *
+ * @ingroup alloc
+ */
+
+static const int ADDRESS_BITS = sizeof(void *) >= 8 ? 48 : 8 * sizeof(void *);
+
+/**
+ * Build a page map.
+ * @param page_size		Page size, rounded down to a power of 2 (must be smaller or equal
+ * 						to the size of the recorded chunks).
+ */
+PageMap::PageMap(t::size page_size): _shift(0), _root(nullptr) {
+	ASSERTP(page_size > 0, "page size must be positive");
+	while((t::size(1) << (_shift + 1)) <= page_size)
+		_shift++;
+	_kbits = ADDRESS_BITS - _shift;
+	_rbits = (_kbits + 2) / 3;
+	_mbits = (_kbits - _rbits + 1) / 2;
+	_lbits = _kbits - _rbits - _mbits;
+}
+
+/**
+ */
+PageMap::~PageMap(void) {
+	clear();
+}
+
+/**
+ * Remove all chunks from the map and release its memory.
+ */
+void PageMap::clear(void) {
+	if(_root == nullptr)
+		return;
+	for(int i = 0; i < (1 << _rbits); i++)
+		if(_root[i] != nullptr) {
+			for(int j = 0; j < (1 << _mbits); j++)
+				delete [] _root[i][j];
+			delete [] _root[i];
+		}
+	delete [] _root;
+	_root = nullptr;
+}
+
+/**
+ * Get the entry of the given page, allocating the tables as needed.
+ * @param k		Page number.
+ * @return		Page entry.
+ */
+PageMap::entry_t& PageMap::fetch(t::intptr k) {
+	if(_root == nullptr)
+		_root = new entry_t **[1 << _rbits]();
+	entry_t **&m = _root[k >> (_mbits + _lbits)];
+	if(m == nullptr)
+		m = new entry_t *[1 << _mbits]();
+	entry_t *&l = m[(k >> _lbits) & ((1 << _mbits) - 1)];
+	if(l == nullptr)
+		l = new entry_t[1 << _lbits]();
+	return l[k & ((1 << _lbits) - 1)];
+}
+
+/**
+ * Record a chunk in the map.
+ * @param base	Base address of the chunk.
+ * @param size	Size of the chunk (must be greater or equal to the page size).
+ * @param data	Data associated with the chunk and returned by get().
+ */
+void PageMap::add(void *base, t::size size, void *data) {
+	ASSERTP(size >= (t::size(1) << _shift), "chunk smaller than a page");
+	t::intptr b = t::intptr(base), e = b + size;
+	ASSERTP(ADDRESS_BITS >= int(8 * sizeof(t::intptr)) || ((e - 1) >> ADDRESS_BITS) == 0,
+		"address out of the page map");
+	for(t::intptr k = b >> _shift; k <= (e - 1) >> _shift; k++) {
+		entry_t& p = fetch(k);
+		t::intptr ps = k << _shift, pe = ps + (t::intptr(1) << _shift);
+		if(b <= ps) {
+			p.lo = data;
+			if(p.hi == nullptr)
+				p.split = e < pe ? e : pe;
+		}
+		else {
+			p.hi = data;
+			p.split = b;
+		}
+	}
+}
+
+/**
+ * Remove a chunk from the map. The tables are not released (it is done
+ * by clear()) so that chunks may be removed and added back cheaply, and
+ * no table is allocated for the pages that were never recorded.
+ * @param base	Base address of the chunk.
+ * @param size	Size of the chunk as passed to add().
+ */
+void PageMap::remove(void *base, t::size size) {
+	t::intptr b = t::intptr(base), e = b + size;
+	for(t::intptr k = b >> _shift; k <= (e - 1) >> _shift; k++) {
+		entry_t *p = lookup(k);
+		if(p == nullptr)
+			continue;
+		if(b <= (k << _shift))
+			p->lo = nullptr;
+		else
+			p->hi = nullptr;
+	}
+}
+
+/**
+ * @fn void *PageMap::get(const void *p) const;
+ * Find the chunk containing the given address. If the address is not in a chunk,
+ * null or a chunk of the same page may be returned: the caller has to check
+ * the chunk bounds if needed.
+ * @param p		Looked address.
+ * @return		Data of the found chunk or null.
+ */
+
+/**
+ * @fn int PageMap::pageShift(void) const;
+ * Get the page size as a power of 2.
+ * @return	Log2 of the page size.
+ */
+
+}	// elm
@@ -20,7 +20,6 @@
  */
 
 #include <elm/alloc/SimpleGC.h>
-#include <elm/stree/SegmentBuilder.h>
 
 namespace elm {
 
@@ -82,7 +81,7 @@ Temp::~Temp(void) {
  * @param size	Size of chunks.
  */
 SimpleGC::SimpleGC(t::size size)
-: csize(round(size)), free_list(0), st(0) {
+: csize(round(size)), free_list(0), pages(csize) {
 }
 
 
@@ -92,6 +91,7 @@ SimpleGC::SimpleGC(t::size size)
 void SimpleGC::newChunk(void) {
 	chunk_t *c = (chunk_t *)(new char[sizeof(chunk_t) + csize]);
 	chunks.add(c);
+	pages.add(c->buffer, csize, c);
 	c->bits = 0;
 	block_t *b = (block_t *)c->buffer;
 	b->next = free_list;
@@ -112,6 +112,8 @@ SimpleGC::~SimpleGC(void) {
 void SimpleGC::clear(void) {
 	for(auto c: chunks)
 		delete c;
+	chunks.clear();
+	pages.clear();
 	free_list = 0;
 }
 
@@ -182,8 +184,8 @@ void *SimpleGC::allocate(t::size size) {
 bool SimpleGC::mark(void *data, t::size size) {
 
 	// find the chunk
-	chunk_t *gcc = st->get(data);
-	ASSERTP(gcc, _ << "during GC, block out of chunks: " << (void *)data << ":" << io::hex(size) << "!");
+	chunk_t *gcc = static_cast<chunk_t *>(pages.get(data));
+	ASSERTP(gcc && static_cast<t::uint8 *>(data) >= gcc->buffer && static_cast<t::uint8 *>(data) < gcc->buffer + csize, _ << "during GC, block out of chunks: " << (void *)data << ":" << io::hex(size) << "!");
 	int p = (static_cast<t::uint8 *>(data) - gcc->buffer) / sizeof(block_t);
 	int s = (size + sizeof(block_t) - 1) / sizeof(block_t);
 
@@ -204,16 +206,9 @@ bool SimpleGC::mark(void *data, t::size size) {
  */
 void SimpleGC::beginGC(void) {
 
-	// build the data structure
-	stree::SegmentBuilder<void *, chunk_t *> builder(0);
-	for(auto c: chunks) {
-		builder.add(c->buffer, c->buffer + csize, c);
+	// allocate the marking bits
+	for(auto c: chunks)
 		c->bits = new BitVector(csize / sizeof(block_t));
-	}
-
-	// finalize the tree
-	st = new tree_t();
-	builder.make(*st);
 }
 
 
@@ -268,7 +263,6 @@ void SimpleGC::endGC(void) {
 		delete c->bits;
 		c->bits = 0;
 	}
-	delete st;
 }
 
 }	// elm
@@ -37,6 +37,19 @@ namespace elm {
  * }
  * @endcode
  *
+ * In addition, a type may be declared as trivial (is_trivial: no construction or
+ * destruction required, byte-per-byte copy) or relocatable (is_relocatable: an item
+ * may be moved to another address by a byte-per-byte copy, without calling its destructor
+ * on the original address; this is the case of most classes not containing pointers
+ * to themselves as, for example, @ref String). Types recognized as trivial by the C++
+ * standard library (std::is_trivial) are automatically considered as trivial and
+ * relocatable.
+ * @code
+ * template <> struct type_info<MyType>: public class_t<MyType> {
+ *	enum { is_relocatable = true };
+ * }
+ * @endcode
+ *
  * @ingroup types
  */
 
@@ -64,6 +77,45 @@ namespace array {
  */
 
 
+/**
+ * @fn void relocate(T *target, T *source, int size);
+ * Move (in the C++11 sense) the source array of the given size to the target.
+ * The arrays may overlap and both must contain constructed items. The source items
+ * are left in a valid but unspecified state.
+ * @param target	Target array.
+ * @param source	Source array.
+ * @param size		Size of both arrays.
+ * @ingroup array
+ */
+
+/**
+ * @fn void transfer(T *target, T *source, int size);
+ * Move the items of the source array to the target uninitialized memory.
+ * The arrays must not overlap. After the call, the source array contains
+ * destroyed items (that must not be destroyed again). For relocatable types,
+ * this is a simple memcpy().
+ * @param target	Target (uninitialized) memory.
+ * @param source	Source array.
+ * @param size		Size of both arrays.
+ * @ingroup array
+ */
+
+/**
+ * @class is_trivial
+ * Trait giving in its _ member if the type T may be copied byte-per-byte
+ * and does not require construction or destruction.
+ * @param T		Tested type.
+ * @ingroup array
+ */
+
+/**
+ * @class is_relocatable
+ * Trait giving in its _ member if items of type T may be moved in memory
+ * by a byte-per-byte copy (without destroying the original item).
+ * @param T		Tested type.
+ * @ingroup array
+ */
+
 /**
  * @fn void set(T *target, int size, const T& v);
  * Set the items of an array of the given size to the given value, as fast as possible.
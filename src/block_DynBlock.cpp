@@ -17,29 +17,46 @@ namespace elm { namespace block {
  */
 
 /*
- * Enlarge the current buffer with some given minimum.
+ * Enlarge the current buffer with some given minimum. The capacity is
+ * doubled (with steps bounded by max_step bytes) so that a block built by
+ * small pieces is copied a constant number of times per byte on average.
  * @param min	Minimal enlargement size.
  */
 void DynBlock::grow(int min) {
+	int step = cap < max_step ? cap : max_step;
+	if(step < inc)
+		step = inc;
+	if(step < min)
+		step = min;
+	resize(cap + step);
+}
 
-	// Compute new size
-	int new_size = cap + ((min > inc) ? min : inc);
-	
-	// Allocate it
-	char *new_buf = new char[new_size];
-	
-	// Initialize it
-	memcpy(new_buf, buf, _size);
-	delete [] buf;
+
+/*
+ * Change the capacity of the buffer (with realloc() so that large buffers
+ * may be extended in place).
+ * @param new_cap	New capacity (greater or equal to the size).
+ */
+void DynBlock::resize(int new_cap) {
+	char *new_buf = static_cast<char *>(::realloc(buf, new_cap));
+	ASSERTP(new_buf, "no more memory");
 	buf = new_buf;
+	cap = new_cap;
 }
 
 
+/**
+ * @var DynBlock::max_step
+ * Maximal enlargement step of the buffer: below this size, the capacity
+ * is doubled at each enlargement.
+ */
+
+
 /**
  * @fn DynBlock::DynBlock(int capacity, int increment);
  * Build a new dynamic block.
  * @param capacity		Initial capacity of allocated buffer.
- * @param increment	Increment for enlarging the buffer.
+ * @param increment	Minimal increment for enlarging the buffer.
  */
 
 
@@ -98,9 +115,17 @@ void DynBlock::get(char *block, int size, int pos) {
 
 /**
  * @fn int DynBlock::increment(void) const;
- * Get the incrementation value.
+ * Get the minimal incrementation value.
  * @return Incrementation value.
  */
+
+
+/**
+ * @fn void DynBlock::reserve(int n);
+ * Ensure that the block capacity is at least n bytes so that it may
+ * reach this size without any reallocation.
+ * @param n	Capacity to reserve.
+ */
  
 
 /**
@@ -124,11 +149,20 @@ void DynBlock::get(char *block, int size, int pos) {
 
 
 /**
- * @fn char *DynBlock::detach(void);
  * Detach the block from this dynamic manager. The dynamic block must no more be
- * used after this call.
- * @return Block buffer that must be fried using "delete []".
+ * used after this call (unless reset() is called, that allocates a new buffer
+ * of the increment size). The buffer is shrunk to the block size if much room
+ * was left.
+ * @return Block buffer that must be freed using "free()".
  */
+char *DynBlock::detach(void) {
+	if(_size && cap - _size > _size / 8)
+		resize(_size);
+	char *result = buf;
+	buf = 0;
+	cap = inc;
+	return result;
+}
 
 
 /**
@@ -215,10 +215,17 @@ public:
  * @par Implemented by:
  * @li @ref Array
  * @li @ref BiDiList
+ * @li @ref BTreeMap
+ * @li @ref BTreeSet
+ * @li @ref FlatMap
+ * @li @ref FlatSet
+ * @li @ref FlatHashMap
+ * @li @ref FlatHashSet
  * @li @ref HashMap
  * @li @ref HashSet
  * @li @ref List
  * @li @ref ListSet
+ * @li @ref SmallVector
  * @li @ref SortedList
  * @li @ref Vector
  * 
@@ -336,9 +343,13 @@ public:
  * @par Implemented by:
  * @li @ref Array
  * @li @ref BiDiList
+ * @li @ref BTreeSet
+ * @li @ref FlatSet
+ * @li @ref FlatHashSet
  * @li @ref HashSet
  * @li @ref List
  * @li @ref ListSet
+ * @li @ref SmallVector
  * @li @ref SortedList
  * @li @ref Vector
  *
@@ -433,6 +444,9 @@ public:
  * That just call the contains() function.
  *
  * @par Implemented by:
+ * @li @ref BTreeSet
+ * @li @ref FlatSet
+ * @li @ref FlatHashSet
  * @li @ref HashSet
  * @li @ref ListSet
  * 
@@ -566,6 +580,7 @@ public:
  * @par Implemented by:
  * @li @ref Array
  * @li @ref AllocArray
+ * @li @ref SmallVector
  * @li @ref Vector
  *
  * @ingroup concepts
@@ -617,6 +632,7 @@ public:
  * @par Implemented by:
  * @li @ref Array
  * @li @ref AllocArray
+ * @li @ref SmallVector
  * @li @ref Vector
  *
  * @ingroup concepts
@@ -667,6 +683,7 @@ public:
  * @par Implemented by:
  * @li @ref Array
  * @li @ref AllocArray
+ * @li @ref SmallVector
  * @li @ref Vector
  *
  * @ingroup concepts
@@ -721,6 +738,7 @@ public:
  * @par Implemented by:
  * @li @ref BiDiList
  * @li @ref List
+ * @li @ref SmallVector
  * @li @ref Vector
  *
  * @ingroup concepts
@@ -775,6 +793,7 @@ public:
  * @par Implemented by:
  * @li @ref BinomialQueue
  * @li @ref BiDiList
+ * @li @ref IndexedHeap
  * @li @ref ListQueue
  * @li @ref VectorQueue
  *
@@ -826,8 +845,11 @@ public:
  * @li @ref SelfHashKey
  *
  * @par Used by:
+ * @li @ref FlatHashMap
+ * @li @ref FlatHashSet
  * @li @ref HashMap
  * @li @ref HashSet
+ * @li @ref FlatHashTable
  * @li @ref HashTable
  *
  * @ingroup concepts
@@ -1018,6 +1040,9 @@ public:
  * This concept defines collections of items retrievable by an assigned key.
  * @par
  * Implemented by:
+ * @li @ref elm::BTreeMap
+ * @li @ref elm::FlatMap
+ * @li @ref elm::FlatHashMap
  * @li @ref elm::HashMap
  * @li @ref elm::ListMap
  * @par
@@ -1112,6 +1137,9 @@ public:
  * A map that may be modified.
  * @par
  * Implemented by:
+ * @li @ref elm::BTreeMap
+ * @li @ref elm::FlatMap
+ * @li @ref elm::FlatHashMap
  * @li @ref elm::HashMap
  * @li @ref elm::ListMap
  * @par
@@ -62,27 +62,31 @@ namespace elm {
  * 	* small -- Vector, VectorQueue
  * 	* medium -- List, SortedList, BiDiList, TreeBag, TreeMap
  * 	* big -- FragTable, avl::Tree, avl::Map,
- * avl::Set, ListQueue, HashMap, HashSet
+ * avl::Set, BTreeMap, BTreeSet, FlatMap, FlatSet, ListQueue, HashMap, HashSet
  *
  * Access type:
  *  * indexed -- Vector, FragTable
  *	* sequential -- Vector, List, SortedList, BiDiList, FragTable, avl::Tree
- *	* fast lookup -- avl::Tree, TreeBag, SortedList
- *	* key access -- ListMap, HashMap, avl::Map, TreeMap
+ *	* fast lookup -- avl::Tree, BTreeSet, FlatSet, TreeBag, SortedList
+ *	* key access -- ListMap, FlatMap, HashMap, avl::Map, BTreeMap, TreeMap
+ *	* ordered range -- BTreeMap, BTreeSet, FlatMap, FlatSet
+ *	* read-mostly lookup table -- FlatMap, FlatSet
  *
  * Modification type:
  *	* append -- Vector, FragTable, BiDiList
  *	* prepend -- List
  *	* push / pop (stack) -- StaticStack, Vector, List, BiDiList, FragTable
  *	* append / remove first (queue) -- BiDiList, VectorQueue, ListQueue
+ *	* priority queue -- BinomialQueue, IndexedHeap (with decrease-key)
+ *	* inter-thread queue (bounded, lock-free) -- SPSCQueue, MPMCQueue
  *	* random -- List, BiDiList
- *	* uniqueness of elements (set) -- ListSet, avl::Set, HashSet
- *	* key access (map) -- ListMap, HashMap, avl::Map, TreeMap
+ *	* uniqueness of elements (set) -- ListSet, avl::Set, BTreeSet, FlatSet, HashSet
+ *	* key access (map) -- ListMap, FlatMap, HashMap, avl::Map, BTreeMap, TreeMap
  *	* inter-set operation (efficient) -- BitVector
  *
  * Memory footprint:
- *	* light -- Array, Vector, VectorQueue, BitVector, StaticStack, List, ListQueue, SortedList, ListMap
- *	* medium -- BiDiList, TreeBag, TreeMap, avl::Tree, avl::Map, avl::Set, FragTable
+ *	* light -- Array, Vector, VectorQueue, BitVector, StaticStack, List, ListQueue, SortedList, ListMap, FlatMap, FlatSet
+ *	* medium -- BiDiList, TreeBag, TreeMap, avl::Tree, avl::Map, avl::Set, BTreeMap, BTreeSet, FragTable
  *	* heavy at startup -- HashTable, HashMap, HashSet
  *
  * The array below sum up the complexity of operations for the data structures
@@ -101,6 +105,8 @@ namespace elm {
  * HashSet        | O(b)           | O(b)           | O(1)         | O(1)
  * avl::Tree      | O(log(n))      | O(log(n))      | O(1)         | O(log(n))
  * avl::Set       | O(log(n))      | O(log(n))      | O(1)         | O(log(n))
+ * BTreeSet       | O(log(n))      | O(log(n))      | O(log(n))    | O(log(n))
+ * FlatSet        | O(n)           | O(log(n))      | O(n)         | O(n)
  *
  * * n -- number of elements in the data structure
  * * b -- number of elements in a bucket of a hash table
@@ -114,7 +120,9 @@ namespace elm {
  * -------------- | -------------- | -------------- | --------------
  * HashMap        | O(b)           | O(b)           | O(b)
  * avl::Map       | O(log(n))      | O(log(n))      | O(log(n))
- * TreeMap        | O(log(n))/O(n) | O(log(n))/O(n) | O(log(n))/O(n)
+ * BTreeMap       | O(log(n))      | O(log(n))      | O(log(n))
+ * FlatMap        | O(log(n))      | O(n)           | O(n)
+ * TreeMap        | O(log(n))      | O(log(n))      | O(log(n))
  * ListMap        | O(n)           | O(n)           | O(n)
  *
  * * n -- number of elements in the data structure
@@ -162,6 +170,7 @@ namespace elm {
  * Data Structure | put  | get
  * -------------- | ---- | ----
  * BinomialQueue  | O(1) | O(log(n))
+ * IndexedHeap    | O(log(n)) | O(log(n))
  * SortedList     | O(n) | O(1)
  *
  *
@@ -251,8 +260,14 @@ namespace elm {
  *
  * @par Helper functions
  *
- * `<elm/data/quicksort.h>` provides a *quicksort* implementation for data collections:
- *	* @ref void elm::quicksort(A<T>& array, const C& c)
+ * `<elm/data/quicksort.h>` provides sort functions for data collections implementing
+ * the @ref concept::MutableArray concept (like Vector, Array or FragTable):
+ *	* @ref void elm::quicksort(A<T>& array, const C& c) -- fast, not stable,
+ *	* @ref void elm::mergesort(A<T>& array, const C& c) -- stable, uses a temporary buffer.
+ *
+ * `<elm/data/radixsort.h>` provides @ref elm::radixsort() for arrays of integers or pointers
+ * (or items whose key is an integer or a pointer) and `<elm/data/par.h>` provides
+ * @ref elm::par::mergesort() that sorts in parallel using a @ref sys::ThreadPool.
  *
  * Other functions provides very generic processing over the collection. They generically takes
  * as parameter a collection, a class providing some specific computation and comes in
@@ -283,6 +298,20 @@ namespace elm {
  * * @ref Mul -- class providing multiplication in operator ()(x, y),
  * * @ref true_pred -- predicate always evaluating to true.
  *
+ * For indexable collections (Array, Vector, FragTable, Slice), `<elm/data/par.h>`
+ * provides parallel versions splitting the collection in chunks processed by
+ * a @ref sys::ThreadPool (by default the shared one, @ref sys::ThreadPool::shared()):
+ * * @ref par::forEach(C& c, const F& f) -- call f on each item (possibly modifying it),
+ * * @ref par::count(const C& c, const P& p) -- count items satisfying predicate p,
+ * * @ref par::map(const C& c, const F& f, D& d) -- append to d the images of items by f (order is kept),
+ * * @ref par::fold(const C& c, const F& f, T t) -- same result as fold() for an associative f,
+ * * @ref par::reduce(const C& c, const F& f, T t) -- compute t op c[0] op c[1] ... for an associative f(x, y) = x op y,
+ * * @ref par::sum(const C& c), @ref par::product(const C& c) -- reduce with Add and Mul.
+ *
+ * Partial results of the chunks are combined in the order of the chunks: operations
+ * only need to be associative, not commutative. Functions passed to these algorithms
+ * are called concurrently and must not throw exceptions.
+ *
  *
  * @par Delegate Classes
  *
@@ -511,27 +540,66 @@ struct FunctionWithArg {
 }	// concept
 
 
-/**s
+/**
  * @fn void quicksort(A& array, const C& c);
- * Sort the given array using quicksort algorithm (average complexity O(N log(N)) ).
+ * Sort the given array using introsort algorithm: a quicksort with a pivot
+ * chosen as the median of 3 items (or median of 3 medians for big ranges),
+ * falling back to heap sort when the recursion becomes too deep and
+ * finishing small ranges with an insertion sort. The complexity is O(N log(N))
+ * in the worst case, including for sorted, reversed or few-unique inputs.
+ * The sort is not stable.
  *
  * @param array		Array containing the values to sort.
  * @param c			Comparator to use (rely on ELM default comparator @ref Comparator if not provided).
  * @param T			Type of values.
- * @param A			Type of array (must implement @ref Array concept).
+ * @param A			Type of array (must implement @ref MutableArray concept).
  * @param C			Type of comparator (must implement @ref Comparator or @ref Compare concept).
  *
  * @ingroup data
  */
 
 /**
- * @fn template <class T, template <class> class A> void quicksort(A<T>& array);
- * Sort the given array using quicksort algorithm (average complexity O(N log(N)) ).
- * The used comparator is @ref Comparator<T>.
+ * @fn void mergesort(A& array, const C& c);
+ * Sort the given array using a bottom-up merge sort: the order of equal
+ * items is kept (stable sort). The complexity is O(N log(N)) and a temporary
+ * buffer of at most N items is used. Already sorted runs are merged in O(1).
  *
  * @param array		Array containing the values to sort.
+ * @param c			Comparator to use (rely on ELM default comparator @ref Comparator if not provided).
  * @param T			Type of values.
- * @param A			Type of array (must implement @ref Array concept).
+ * @param A			Type of array (must implement @ref MutableArray concept).
+ * @param C			Type of comparator (must implement @ref Comparator or @ref Compare concept).
+ *
+ * @ingroup data
+ */
+
+/**
+ * @fn void radixsort(A& array, const K& adapter);
+ * Sort the given array using a LSD radix sort (stable) on the bytes of the keys.
+ * The keys must be of integral or pointer type (signed integers are supported).
+ * The complexity is O(N.D) where D is the key size in bytes, but the passes on
+ * bytes shared by all keys are skipped. It uses 2 temporary buffers of N items.
+ *
+ * @param array		Array containing the values to sort.
+ * @param adapter	Adapter to get the key from the items (default @ref IdAdapter).
+ * @param A			Type of array (must implement @ref MutableArray concept).
+ * @param K			Type of adapter (must implement @ref Adapter concept).
+ *
+ * @ingroup data
+ */
+
+/**
+ * @fn void par::mergesort(A& array, const C& c, sys::ThreadPool& pool);
+ * Sort the given array using a parallel stable merge sort: the array is split
+ * in chunks sorted in parallel and then merged by rounds. When there are fewer
+ * merges than threads, each merge is itself split in parts computed in parallel.
+ * Arrays smaller than par::SORT_THRESHOLD are sorted sequentially.
+ *
+ * @param array		Array containing the values to sort.
+ * @param c			Comparator to use (rely on ELM default comparator @ref Comparator if not provided).
+ * @param pool		Thread pool to use (default to @ref sys::ThreadPool::shared()).
+ * @param A			Type of array (must implement @ref MutableArray concept).
+ * @param C			Type of comparator (must implement @ref Comparator or @ref Compare concept).
  *
  * @ingroup data
  */
@@ -0,0 +1,189 @@
+/*
+ *	BTree class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <elm/data/BTree.h>
+#include <elm/data/BTreeMap.h>
+#include <elm/data/BTreeSet.h>
+
+namespace elm {
+
+/**
+ * @class BTree
+ * B+-tree storing items ordered by key. The items are only stored in
+ * the leaves that are chained together to make ordered and range iteration
+ * a simple scan of contiguous memory. Inner nodes only store the keys
+ * and the children pointers. All nodes are sized to hold about 256 bytes
+ * (a few cache lines) to minimize the number of cache misses during a look-up:
+ * the height of the tree is roughly log(n) / log(B) where B is the number of
+ * keys per node.
+ *
+ * An item cannot be stored twice (according to its key): add() keeps the
+ * existing item while set() replaces it. The tree is kept balanced by splitting
+ * full nodes at insertion and by borrowing from or merging with siblings at
+ * removal.
+ *
+ * The tree can be bulk-loaded from a sorted collection with load(): this
+ * is much faster than a sequence of additions and produces fully packed leaves.
+ *
+ * This class is mainly used as implementation base for @ref BTreeMap and
+ * @ref BTreeSet.
+ *
+ * @par Performances
+ * @li lookup -- O(log(n))
+ * @li addition / removal -- O(log(n)), with shift of at most B items
+ * @li iteration -- O(1) per item
+ * @li memory -- about n / (B/2) nodes in the worst case
+ *
+ * @param T	Type of stored items.
+ * @param K	Key adapter (default to @ref IdAdapter).
+ * @param C	Comparator for the keys (default to @ref Comparator).
+ * @param A	Allocator for the nodes (default to @ref DefaultAlloc).
+ * @ingroup data
+ */
+
+/**
+ * @fn int BTree::height(void) const;
+ * Get the height of the tree.
+ * @return	Tree height (0 for an empty tree, 1 if only the root leaf exists).
+ */
+
+/**
+ * @fn void BTree::set(const T& item);
+ * Add an item to the tree. If an item with the same key already exists,
+ * it is replaced.
+ * @param item	Item to set.
+ */
+
+/**
+ * @fn T *BTree::fetch(const T& item);
+ * Look for an item with the same key as item: if it doesn't exist,
+ * item is added.
+ * @param item	Item to look for or to add.
+ * @return		Pointer to the item in the tree (valid until the next modification).
+ */
+
+/**
+ * @fn bool BTree::removeByKey(const key_t& key);
+ * Remove the item matching the given key.
+ * @param key	Key of the item to remove.
+ * @return		True if an item has been removed, false else.
+ */
+
+/**
+ * @fn Iter BTree::lowerBound(const key_t& key) const;
+ * Get an iterator on the first item whose key is greater or equal to key.
+ * @param key	Looked key.
+ * @return		Iterator on the found item (ended if there is none).
+ */
+
+/**
+ * @fn Iter BTree::upperBound(const key_t& key) const;
+ * Get an iterator on the first item whose key is strictly greater than key.
+ * @param key	Looked key.
+ * @return		Iterator on the found item (ended if there is none).
+ */
+
+/**
+ * @fn void BTree::load(const CC& c);
+ * Replace the content of the tree by the items of collection c that
+ * must be sorted in strictly increasing key order (checked in debug mode).
+ * The tree is built bottom-up in O(n) with packed leaves.
+ * @param c	Sorted collection to load.
+ */
+
+
+/**
+ * @class BTreeMap
+ * Map implemented as a B+-tree (see @ref BTree). Compared to @ref avl::Map,
+ * a B+-tree uses much less memory per entry and provides better locality
+ * for look-up and iteration. In addition, it supports ordered access
+ * with lowerBound(), upperBound() and range() and bulk loading from sorted
+ * pairs with load().
+ *
+ * @par Implemented concepts
+ * @li @ref elm::concept::Collection
+ * @li @ref elm::concept::Map
+ * @li @ref elm::concept::MutableMap
+ *
+ * @param K	Type of keys.
+ * @param T	Type of values.
+ * @param C	Comparator for keys (default to @ref Comparator).
+ * @param E	Equivalence for values (default to @ref Equiv).
+ * @param A	Allocator for the nodes (default to @ref DefaultAlloc).
+ * @ingroup data
+ */
+
+/**
+ * @fn Iter BTreeMap::lowerBound(const K& key) const;
+ * Get an iterator on the value of the first key greater or equal to key.
+ * @param key	Looked key.
+ * @return		Iterator on the found value (ended if there is none).
+ */
+
+/**
+ * @fn Iter BTreeMap::upperBound(const K& key) const;
+ * Get an iterator on the value of the first key strictly greater than key.
+ * @param key	Looked key.
+ * @return		Iterator on the found value (ended if there is none).
+ */
+
+/**
+ * @fn Iterable<PairIter> BTreeMap::range(const K& lo, const K& hi) const;
+ * Get the pairs whose key is in [lo, hi[, in increasing key order
+ * (nothing if hi < lo).
+ * @param lo	Lower bound (inclusive).
+ * @param hi	Upper bound (exclusive).
+ * @return		Iterable over the pairs in the range.
+ */
+
+/**
+ * @fn void BTreeMap::load(const CC& pairs);
+ * Replace the content of the map by the given pairs that must be sorted
+ * in strictly increasing key order.
+ * @param pairs	Sorted collection of pairs (key, value).
+ */
+
+
+/**
+ * @class BTreeSet
+ * Set implemented as a B+-tree (see @ref BTree).
+ *
+ * @par Implemented concepts
+ * @li @ref elm::concept::Collection
+ * @li @ref elm::concept::MutableCollection
+ * @li @ref elm::concept::Set
+ *
+ * @param T	Type of items.
+ * @param C	Comparator for items (default to @ref Comparator).
+ * @param A	Allocator for the nodes (default to @ref DefaultAlloc).
+ * @ingroup data
+ */
+
+/**
+ * @fn Iterable<Iter> BTreeSet::range(const T& lo, const T& hi) const;
+ * Get the items in [lo, hi[, in increasing order (nothing if hi < lo).
+ * @param lo	Lower bound (inclusive).
+ * @param hi	Upper bound (exclusive).
+ * @return		Iterable over the items in the range.
+ */
+
+}	// elm
@@ -0,0 +1,165 @@
+/*
+ *	ConcurrentHashMap class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <elm/data/ConcurrentHashMap.h>
+
+namespace elm {
+
+/**
+ * @class ConcurrentHashMap
+ * Hash map that can be shared between several threads. The map is split in
+ * several shards, each one being an @ref HashMap protected by its own
+ * @ref sys::Mutex: threads accessing keys of different shards do not
+ * wait for each other.
+ *
+ * As references to stored values would not be protected, values are returned
+ * by copy and in-place modifications are performed with @ref fetch() or
+ * @ref computeIfAbsent() that are atomic.
+ *
+ * The map provides the look-up and update operations of the @ref Map and
+ * @ref MutableMap concepts but, as the shards cannot be iterated safely
+ * while other threads modify them, it has no iterator (no keys() or pairs()):
+ * the whole content is visited with @ref forEach() that locks each shard in turn.
+ *
+ * The shards start small and grow independently: a capacity may be passed
+ * to the constructor to avoid the enlargements when the final size is known.
+ *
+ * @param K		Type of the key.
+ * @param T		Type of values.
+ * @param H		Hash key for K (default to @ref HashKey).
+ * @param A		Allocator.
+ * @param E		Equivalence for values (default to @ref Equiv).
+ * @ingroup data
+ */
+
+/**
+ * @fn ConcurrentHashMap::ConcurrentHashMap(int shards, int capacity);
+ * Build a concurrent hash map.
+ * @param shards	Number of shards (rounded to the next power of two, default to 64).
+ * 					Should be greater than the number of threads.
+ * @param capacity	Expected number of items (default to 0, the shards start small
+ * 					and grow on demand).
+ */
+
+/**
+ * @fn int ConcurrentHashMap::shardCount(void) const;
+ * Get the number of shards.
+ * @return	Number of shards.
+ */
+
+/**
+ * @fn Option<T> ConcurrentHashMap::get(const K& k) const;
+ * Get the value associated with a key.
+ * @param k		Looked key.
+ * @return		Copy of the found value or none.
+ */
+
+/**
+ * @fn T ConcurrentHashMap::get(const K& k, const T& def) const;
+ * Get the value associated with a key.
+ * @param k		Looked key.
+ * @param def	Default value.
+ * @return		Copy of the found value or def.
+ */
+
+/**
+ * @fn bool ConcurrentHashMap::hasKey(const K& k) const;
+ * Test if a key is in the map.
+ * @param k		Tested key.
+ * @return		True if the key is in the map, false else.
+ */
+
+/**
+ * @fn int ConcurrentHashMap::count(void) const;
+ * Count the items of the map. As shards are locked in turn, the result
+ * is only exact if no other thread modifies the map.
+ * @return	Number of items.
+ */
+
+/**
+ * @fn bool ConcurrentHashMap::isEmpty(void) const;
+ * Test if the map is empty (with the same restriction as @ref count()).
+ * @return	True if the map is empty, false else.
+ */
+
+/**
+ * @fn void ConcurrentHashMap::forEach(F f) const;
+ * Call f(key, value) for each item of the map. Each shard is locked during
+ * its traversal: f must not access the map.
+ * @param f		Function to call.
+ */
+
+/**
+ * @fn void ConcurrentHashMap::put(const K& k, const T& v);
+ * Associate a value with a key, replacing the existing value if any.
+ * @param k		Key.
+ * @param v		Value.
+ */
+
+/**
+ * @fn void ConcurrentHashMap::remove(const K& k);
+ * Remove a key from the map.
+ * @param k		Removed key.
+ */
+
+/**
+ * @fn void ConcurrentHashMap::clear(void);
+ * Remove all items of the map.
+ */
+
+/**
+ * @fn bool ConcurrentHashMap::putIfAbsent(const K& k, const T& v);
+ * Atomically add the pair (k, v) if k is not already in the map.
+ * @param k		Key.
+ * @param v		Value.
+ * @return		True if the pair has been added, false if k was already in the map.
+ */
+
+/**
+ * @fn T ConcurrentHashMap::computeIfAbsent(const K& k, F f);
+ * Atomically get the value associated with k or, if there is none,
+ * associate it with the result of f(k). f is called at most once
+ * and must not access the map.
+ * @param k		Key.
+ * @param f		Function computing the value.
+ * @return		Value associated with k.
+ */
+
+/**
+ * @fn T ConcurrentHashMap::fetch(const K& k, F f);
+ * Atomically update the value associated with k by calling f(v)
+ * with a reference to this value. If k is not in the map, it is first
+ * associated with T(). f must not access the map.
+ * @param k		Key.
+ * @param f		Function updating the value.
+ * @return		Updated value.
+ */
+
+/**
+ * @fn bool ConcurrentHashMap::removeIf(const K& k, const T& v);
+ * Atomically remove k if it is associated with v.
+ * @param k		Key.
+ * @param v		Value.
+ * @return		True if the key has been removed, false else.
+ */
+
+}	// elm
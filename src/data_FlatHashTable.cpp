@@ -0,0 +1,209 @@
+/*
+ *	FlatHashTable class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/FlatHashMap.h>
+#include <elm/data/FlatHashSet.h>
+
+namespace elm {
+
+/**
+ * @class FlatHashTable
+ * Hash table using open addressing: the items are stored directly in
+ * an array of slots (no per-item allocation) and a parallel array of
+ * control bytes records, for each slot, if it is empty, deleted or,
+ * for a used slot, 7 bits of the item hash.
+ *
+ * Look-up scans the control bytes by groups of 16 (using SSE2 instructions
+ * when available) and compares the actual items only when the 7 bits match.
+ * The table is enlarged (doubling its size) when it is filled at 7/8.
+ *
+ * This class is the basic implementation used by @ref FlatHashMap and @ref FlatHashSet
+ * and provides the same interface as @ref HashTable. Yet, as items are moved
+ * when the table is resized, pointers returned by get() or add() are only
+ * valid until the next insertion.
+ *
+ * @param T	Type of stored data.
+ * @param H	Hash key (as @ref HashKey).
+ * @param A	Allocator.
+ * @ingroup data
+ */
+
+/**
+ * @fn FlatHashTable::FlatHashTable(int size);
+ * Build a flat hash table able to store, at least, the given number of
+ * items without resizing.
+ * @param size	Number of items to reserve for (default to 0).
+ */
+
+/**
+ * @fn FlatHashTable::FlatHashTable(const self_t& h);
+ * Clone constructor.
+ * @param h	Hash table to clone.
+ */
+
+/**
+ * @fn const T *FlatHashTable::get(const T& key) const;
+ * Get a table item by its key.
+ * @param key	Looked key.
+ * @return		Pointer on item if found, null pointer else.
+ */
+
+/**
+ * @fn bool FlatHashTable::hasKey(const T& key) const;
+ * Test if a key is in the table.
+ * @param key	Tested key.
+ * @return		True if there is an item in the table with the given key, false else.
+ */
+
+/**
+ * @fn void FlatHashTable::put(const T& data);
+ * Add a data in the table ensuring there is only one data with the corresponding key.
+ * @param data	Added data.
+ */
+
+/**
+ * @fn T *FlatHashTable::add(const T& data);
+ * Add a data to the table without checking if the key is already there.
+ * @param data	Added data.
+ * @return		Pointer to the added item (valid until the next insertion).
+ */
+
+/**
+ * @fn void FlatHashTable::reserve(int n);
+ * Enlarge the table so that n items can be stored without resizing.
+ * @param n		Number of items to reserve for.
+ */
+
+/**
+ * @fn void FlatHashTable::remove(const T& key);
+ * Remove the item corresponding to the given key.
+ * @param key	Key of the item to remove.
+ */
+
+/**
+ * @fn void FlatHashTable::remove(const Iter& i);
+ * Remove the item pointed by the iterator. The iterator
+ * remains usable to go to the next item.
+ * @param i		Iterator on the item to remove.
+ */
+
+/**
+ * @fn int FlatHashTable::size(void) const;
+ * Get the number of slots of the table.
+ * @return	Number of slots.
+ */
+
+/**
+ * @class FlatHashTable::Iter;
+ * Iterator on the items of the table.
+ */
+
+
+/**
+ * @class FlatHashMap
+ * Map implemented using a @ref FlatHashTable. It provides the same interface
+ * as @ref HashMap and can be used in place of it when there is no
+ * need for stable item addresses: it avoids an allocation per item and
+ * its look-up accesses consecutive memory.
+ *
+ * @par Implemented Concepts
+ * @li @ref Collection
+ * @li @ref Map
+ * @li @ref MutableMap
+ *
+ * @par Characteristics
+ * @li average access time: O(1)
+ * @li average add time: O(1) amortized
+ * @li average remove time: O(1)
+ * @li memory space: S * (key size + value size + 1) with S ≥ 8/7 n
+ *
+ * @param K		Type of the key.
+ * @param T		Type of values.
+ * @param H		Hash key for K (default to @ref HashKey).
+ * @param A		Allocator.
+ * @param E		Equivalence for values (default to @ref Equiv).
+ * @ingroup data
+ */
+
+/**
+ * @fn FlatHashMap::FlatHashMap(int size);
+ * Build a flat hash map.
+ * @param size	Number of items to reserve for (default to 0).
+ */
+
+/**
+ * @fn void FlatHashMap::reserve(int n);
+ * Enlarge the map so that n items can be stored without resizing.
+ * @param n		Number of items to reserve for.
+ */
+
+/**
+ * @fn T& FlatHashMap::fetch(const K& k);
+ * Get a reference to the data stored with the key k. If no data is already
+ * associated with key k, an entry and corresponding data are created
+ * and returns a reference to it.
+ * @param k		Key of looked data.
+ * @return		Reference to data associated with key (valid until the next insertion).
+ */
+
+/**
+ * @fn bool FlatHashMap::includes(const self_t& t) const;
+ * Test if all pairs (key, value) of t are in the current map.
+ * @param t		Map to test.
+ * @return		True if t is included in the current map, false else.
+ */
+
+
+/**
+ * @class FlatHashSet
+ * Set implemented using a @ref FlatHashTable. It provides the same interface
+ * as @ref HashSet.
+ *
+ * @par Implemented Concepts
+ * @li @ref Collection
+ * @li @ref MutableCollection
+ * @li @ref Set
+ *
+ * @par Characteristics
+ * @li average access time: O(1)
+ * @li average add time: O(1) amortized
+ * @li average remove time: O(1)
+ * @li memory space: S * (data size + 1) with S ≥ 8/7 n
+ *
+ * @param T		Type of set elements.
+ * @param H		Hash key for T (default to @ref HashKey).
+ * @param A		Allocator.
+ * @ingroup data
+ */
+
+/**
+ * @fn FlatHashSet::FlatHashSet(int size);
+ * Build a flat hash set.
+ * @param size	Number of items to reserve for (default to 0).
+ */
+
+/**
+ * @fn void FlatHashSet::reserve(int n);
+ * Enlarge the set so that n items can be stored without resizing.
+ * @param n		Number of items to reserve for.
+ */
+
+}	// elm
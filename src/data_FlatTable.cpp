@@ -0,0 +1,208 @@
+/*
+ *	FlatTable class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/FlatMap.h>
+#include <elm/data/FlatSet.h>
+#include <elm/data/FlatTable.h>
+
+namespace elm {
+
+/**
+ * @class FlatTable
+ * Sorted array of items ordered by key. The items are stored contiguously
+ * in a @ref Vector and looked up by a binary search whose loop does not
+ * branch on the comparison result (it only depends on the number of items):
+ * the processor does not mispredict the search path and the array is
+ * scanned without pointer chasing.
+ *
+ * An item cannot be stored twice (according to its key): add() keeps the
+ * existing item while set() replaces it. As an addition or a removal shifts
+ * the following items, this structure fits best read-mostly data. Big sets
+ * of items are added efficiently with load() (or addAll()) that sort the items
+ * (stable merge sort) and remove duplicates in O(n log(n)).
+ *
+ * This class is mainly used as implementation base for @ref FlatMap and
+ * @ref FlatSet.
+ *
+ * @par Performances
+ * @li lookup -- O(log(n))
+ * @li addition / removal -- O(n) (move of the following items)
+ * @li bulk loading -- O(n log(n))
+ * @li iteration -- O(1) per item
+ * @li memory -- n items and up to n free slots.
+ *
+ * @param T	Type of stored items.
+ * @param K	Key adapter (default to @ref IdAdapter).
+ * @param C	Comparator for the keys (default to @ref Comparator).
+ * @param A	Allocator (default to @ref DefaultAlloc).
+ * @ingroup data
+ */
+
+/**
+ * @fn const T& FlatTable::at(int i) const;
+ * Get the item at the given index in key order.
+ * @param i		Item index.
+ * @return		Item at index i.
+ */
+
+/**
+ * @fn void FlatTable::reserve(int n);
+ * Ensure there is room for at least n items without reallocation.
+ * @param n		Number of items to reserve room for.
+ */
+
+/**
+ * @fn void FlatTable::set(const T& item);
+ * Add an item to the table. If an item with the same key already exists,
+ * it is replaced.
+ * @param item	Item to set.
+ */
+
+/**
+ * @fn T *FlatTable::fetch(const T& item);
+ * Look for an item with the same key as item: if it doesn't exist,
+ * item is added.
+ * @param item	Item to look for or to add.
+ * @return		Pointer to the item in the table (valid until the next modification).
+ */
+
+/**
+ * @fn void FlatTable::addAll(const CC& c);
+ * Add the items of c that are not already in the table. Small collections are
+ * inserted one by one while bigger ones are appended and the whole table is sorted.
+ * @param c		Collection of items to add.
+ */
+
+/**
+ * @fn bool FlatTable::removeByKey(const key_t& key);
+ * Remove the item matching the given key.
+ * @param key	Key of the item to remove.
+ * @return		True if an item has been removed, false else.
+ */
+
+/**
+ * @fn Iter FlatTable::lowerBound(const key_t& key) const;
+ * Get an iterator on the first item whose key is greater or equal to key.
+ * @param key	Looked key.
+ * @return		Iterator on the found item (ended if there is none).
+ */
+
+/**
+ * @fn Iter FlatTable::upperBound(const key_t& key) const;
+ * Get an iterator on the first item whose key is strictly greater than key.
+ * @param key	Looked key.
+ * @return		Iterator on the found item (ended if there is none).
+ */
+
+/**
+ * @fn void FlatTable::load(const CC& c);
+ * Replace the content of the table by the items of collection c, in any
+ * order. If several items have the same key, the last one is kept.
+ * @param c	Collection to load.
+ */
+
+
+/**
+ * @class FlatMap
+ * Map implemented as a sorted array of pairs (see @ref FlatTable). Compared
+ * to @ref ListMap, look-up is logarithmic and works on contiguous memory;
+ * compared to @ref avl::Map or @ref BTreeMap, look-up is faster and
+ * the memory footprint smaller but modifications cost O(n). It is a good
+ * replacement for maps that are built once and then mostly read.
+ * Such a map is efficiently built from unsorted pairs with load().
+ *
+ * @par Implemented concepts
+ * @li @ref elm::concept::Collection
+ * @li @ref elm::concept::Map
+ * @li @ref elm::concept::MutableMap
+ *
+ * @param K	Type of keys.
+ * @param T	Type of values.
+ * @param C	Comparator for keys (default to @ref Comparator).
+ * @param E	Equivalence for values (default to @ref Equiv).
+ * @param A	Allocator (default to @ref DefaultAlloc).
+ * @ingroup data
+ */
+
+/**
+ * @fn Iter FlatMap::lowerBound(const K& key) const;
+ * Get an iterator on the value of the first key greater or equal to key.
+ * @param key	Looked key.
+ * @return		Iterator on the found value (ended if there is none).
+ */
+
+/**
+ * @fn Iter FlatMap::upperBound(const K& key) const;
+ * Get an iterator on the value of the first key strictly greater than key.
+ * @param key	Looked key.
+ * @return		Iterator on the found value (ended if there is none).
+ */
+
+/**
+ * @fn Iterable<PairIter> FlatMap::range(const K& lo, const K& hi) const;
+ * Get the pairs whose key is in [lo, hi[, in increasing key order
+ * (nothing if hi < lo).
+ * @param lo	Lower bound (inclusive).
+ * @param hi	Upper bound (exclusive).
+ * @return		Iterable over the pairs in the range.
+ */
+
+/**
+ * @fn T& FlatMap::fetch(const K& key);
+ * Get a reference on the value associated with key. If the key is not
+ * in the map, it is added with a default value.
+ * @param key	Looked key.
+ * @return		Reference on the value (valid until the next modification).
+ */
+
+/**
+ * @fn void FlatMap::load(const CC& pairs);
+ * Replace the content of the map by the given pairs, in any order.
+ * If a key is given several times, the last value is kept.
+ * @param pairs	Collection of pairs (key, value).
+ */
+
+
+/**
+ * @class FlatSet
+ * Set implemented as a sorted array (see @ref FlatTable). Set operations
+ * (join, meet, difference, inclusion) are linear merges of the sorted arrays.
+ *
+ * @par Implemented concepts
+ * @li @ref elm::concept::Collection
+ * @li @ref elm::concept::MutableCollection
+ * @li @ref elm::concept::Set
+ *
+ * @param T	Type of items.
+ * @param C	Comparator for items (default to @ref Comparator).
+ * @param A	Allocator (default to @ref DefaultAlloc).
+ * @ingroup data
+ */
+
+/**
+ * @fn Iterable<Iter> FlatSet::range(const T& lo, const T& hi) const;
+ * Get the items in [lo, hi[, in increasing order (nothing if hi < lo).
+ * @param lo	Lower bound (inclusive).
+ * @param hi	Upper bound (exclusive).
+ * @return		Iterable over the items in the range.
+ */
+
+}	// elm
@@ -132,6 +132,15 @@ namespace elm {
  */
 
 
+/**
+ * @fn T& FragTable::emplace(Args&&... args);
+ * Add an item to the table built in place from the given
+ * constructor arguments.
+ * @param args	Arguments passed to the constructor of T.
+ * @return		Reference on the added item.
+ */
+
+
 /**
  * @fn void FragTable::addAll(const C<T> &items);
  * Add a collection of item to the table.
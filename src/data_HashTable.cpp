@@ -27,24 +27,53 @@ namespace elm {
 /**
  * @class HashTable
  * This class provides an hashing table implementation as an array of linked
- * list. A small caching feature put to the head of the linked list last
- * accessed items.
+ * list.
+ *
+ * Look-ups do not modify the table (and can be performed concurrently by
+ * several threads) unless the look-up policy P is @ref MoveToFrontLookup:
+ * in this case, a small caching feature put to the head of the linked list
+ * last accessed items, what may speed up look-ups with very skewed accesses.
+ *
+ * The number of buckets is always a power of two and the table grows
+ * (doubling its number of buckets) as soon as the number of items
+ * exceeds the number of buckets times the maximum load factor (default to 1).
+ * The number of items is maintained along the table operations making
+ * @ref count() and @ref isEmpty() constant time.
  *
  * This class is the basic implementation of hash table.
  * To use it as a map, refer to @ref HashMap. To use it as a set, refer
  * to @ref HashSet.
  *
  * @param T	Type of stored data.
- * @param A	Adapter to access key information (must implement @ref concept::Adapter).
- * @param M	Manager of the hash table providing hashing and allocation services.
+ * @param H	Hash key (as @ref HashKey).
+ * @param A	Allocator.
+ * @param P	Look-up policy (one of @ref ReadOnlyLookup (default) or @ref MoveToFrontLookup).
  * @ingroup data
  */
 
 /**
- * @fn HashTable::HashTable(int size);
- * Build an hash table with the given size. Improved efficiency is obtained with prime
- * number as sizes.
- * @param size	Table size (default to 211).
+ * @class ReadOnlyLookup
+ * Look-up policy for @ref HashTable, @ref HashMap and @ref HashSet
+ * ensuring that look-ups never modify the table.
+ * @ingroup data
+ */
+
+/**
+ * @class MoveToFrontLookup
+ * Look-up policy for @ref HashTable, @ref HashMap and @ref HashSet
+ * moving the found item at the head of its bucket list. This may improve
+ * the performances when few items are looked very often but
+ * look-ups become modifications of the table: a table with this policy cannot
+ * be shared between threads without locking.
+ * @ingroup data
+ */
+
+/**
+ * @fn HashTable::HashTable(int size, float load);
+ * Build an hash table with the given initial size. The size is rounded
+ * to the next power of two.
+ * @param size	Initial table size (default to 211).
+ * @param load	Maximum load factor (default to 1).
  */
 
 /**
@@ -73,6 +102,27 @@ namespace elm {
  * @return	Count of items.
  */
 
+/**
+ * @fn float HashTable::maxLoad(void) const;
+ * Get the maximum load factor, that is, the average number of items
+ * per bucket over which the table is enlarged.
+ * @return	Maximum load factor.
+ */
+
+/**
+ * @fn void HashTable::setMaxLoad(float load);
+ * Set the maximum load factor. If the table is already overloaded,
+ * it is enlarged accordingly.
+ * @param load	New maximum load factor (must be positive).
+ */
+
+/**
+ * @fn void HashTable::reserve(int n);
+ * Enlarge the table so that n items can be stored without
+ * causing a resize. The table size is bounded by MAX_SIZE.
+ * @param n		Number of items to reserve for.
+ */
+
 /**
  * @fn const data_t *HashTable::get(const key_t& key) const;
  * Get a table item by its key.
@@ -98,6 +148,14 @@ namespace elm {
  * @param data	Added data.
  */
 
+/**
+ * @fn T *HashTable::emplace(Args&&... args);
+ * Add to the table, without checking if the key is already there, a data
+ * built in place from the given constructor arguments.
+ * @param args	Arguments passed to the constructor of T.
+ * @return		Pointer to the added data.
+ */
+
 /**
  * @fn void HashTable::putAll(const self_t& m);
  * Add the items of the given table to the current one.
@@ -137,23 +195,45 @@ namespace elm {
  * @li @ref MutableMap
  *
  * @par Characteristics
- * S is the size of the table.
- * @li average access time: O(n / S)
- * @li average add time: O(n / S)
- * @li average remove time: O(n / S)
+ * S is the size of the table (growing with n according to the load factor).
+ * @li average access time: O(1)
+ * @li average add time: O(1) amortized
+ * @li average remove time: O(1)
+ * @li count time: O(1)
  * @li memory space: pointer size * S + n * (key size + value size + pointer size)
  *
  * @param K		Type of the key.
  * @param T		Type of values.
- * @param M		Used manager (default to @ref HashManager).
+ * @param H		Hash key for K (default to @ref HashKey).
+ * @param A		Allocator.
+ * @param E		Equivalence for values (default to @ref Equiv).
+ * @param P		Look-up policy (default to @ref ReadOnlyLookup).
  * @ingroup data
  */
 
 /**
- * @fn HashMap::HashMap(int size);
- * Build an hash map with the given size. Improved efficiency is obtained with prime
- * number as sizes.
- * @param size	Table size (default to 211).
+ * @fn HashMap::HashMap(int size, float load);
+ * Build an hash map with the given initial size (rounded to the next power of two).
+ * @param size	Initial table size (default to 211).
+ * @param load	Maximum load factor (default to 1).
+ */
+
+/**
+ * @fn void HashMap::reserve(int n);
+ * Enlarge the map so that n items can be stored without resizing.
+ * @param n		Number of items to reserve for.
+ */
+
+/**
+ * @fn float HashMap::maxLoad(void) const;
+ * Get the maximum load factor of the map.
+ * @return	Maximum load factor.
+ */
+
+/**
+ * @fn void HashMap::setMaxLoad(float load);
+ * Set the maximum load factor of the map.
+ * @param load	New maximum load factor.
  */
 
 /**
@@ -283,22 +363,43 @@ namespace elm {
  * @li @ref Set
  *
  * @par Characteristics
- * S is the size of the table.
- * @li average access time: O(n / S)
- * @li average add time: O(n / S)
- * @li average remove time: O(n / S)
+ * S is the size of the table (growing with n according to the load factor).
+ * @li average access time: O(1)
+ * @li average add time: O(1) amortized
+ * @li average remove time: O(1)
+ * @li count time: O(1)
  * @li memory space: pointer size * S + n * (data size + pointer size)
  *
  * @param T		Type of set elements.
- * @param M		Type of used manager (default to @ref HashManager).
+ * @param H		Hash key for T (default to @ref HashKey).
+ * @param A		Allocator.
+ * @param P		Look-up policy (default to @ref ReadOnlyLookup).
  * @ingroup data
  */
 
 /**
- * @fn HashSet::HashSet(int size);
- * Build an hash set with the given size. Improved efficiency is obtained with prime
- * number as sizes.
- * @param size	Table size (default to 211).
+ * @fn HashSet::HashSet(int size, float load);
+ * Build an hash set with the given initial size (rounded to the next power of two).
+ * @param size	Initial table size (default to 211).
+ * @param load	Maximum load factor (default to 1).
+ */
+
+/**
+ * @fn void HashSet::reserve(int n);
+ * Enlarge the set so that n items can be stored without resizing.
+ * @param n		Number of items to reserve for.
+ */
+
+/**
+ * @fn float HashSet::maxLoad(void) const;
+ * Get the maximum load factor of the set.
+ * @return	Maximum load factor.
+ */
+
+/**
+ * @fn void HashSet::setMaxLoad(float load);
+ * Set the maximum load factor of the set.
+ * @param load	New maximum load factor.
  */
 
 /**
@@ -0,0 +1,122 @@
+/*
+ *	IndexedHeap class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <elm/data/IndexedHeap.h>
+
+namespace elm {
+
+/**
+ * @class IndexedHeap
+ * Priority queue implemented as an array-backed d-ary heap where each
+ * item is identified by a handle returned by put(). The handle allows
+ * to change the value of an item (decreaseKey(), increaseKey(), update())
+ * or to remove it (remove()) in O(log n) without looking for it. This makes
+ * this queue well-suited to shortest or longest path algorithms (Dijkstra, Prim)
+ * that would have to put duplicate items in a queue without decrease-key
+ * (like @ref BinomialQueue).
+ *
+ * The head of the queue is the smallest item according to the comparator C.
+ * The handles are small integers (starting at 0) that are reused once
+ * their item leaves the heap: they can be used to index user arrays.
+ *
+ * No memory is allocated per item: the heap and the handle table are
+ * stored in vectors growing geometrically.
+ *
+ * The performances of the queue are:
+ * * head - O(1)
+ * * get, remove - O(D log_D(n))
+ * * put, decreaseKey - O(log_D(n))
+ * * increaseKey, update - O(D log_D(n))
+ * * memory - for each element, the item, 2 integers and an integer per free handle.
+ *
+ * @par Implemented concepts
+ * @li @ref elm::concept::Queue
+ *
+ * @param T		Type of elements in the queue.
+ * @param C		Comparator type (default to elm::Comparator).
+ * @param D		Arity of the heap (default to 4).
+ * @param A		Allocator type (default to elm::DefaultAllocatorDelegate).
+ *
+ * @ingroup data
+ */
+
+/**
+ * @fn IndexedHeap::IndexedHeap(const C& c);
+ * Build an indexed heap.
+ * @param c		Comparator instance to use.
+ */
+
+/**
+ * @fn handle_t IndexedHeap::put(const T& x);
+ * Put an item in the heap.
+ * @param x		Item to put.
+ * @return		Handle of the item.
+ */
+
+/**
+ * @fn IndexedHeap::handle_t IndexedHeap::headHandle(void) const;
+ * Get the handle of the head item.
+ * @return	Head item handle.
+ */
+
+/**
+ * @fn bool IndexedHeap::contains(handle_t h) const;
+ * Test if the given handle designates an item of the heap.
+ * @param h		Tested handle.
+ * @return		True if the item is in the heap, false else.
+ */
+
+/**
+ * @fn const T& IndexedHeap::value(handle_t h) const;
+ * Get the item designated by a handle.
+ * @param h		Handle of the item (must be in the heap).
+ * @return		Designated item.
+ */
+
+/**
+ * @fn void IndexedHeap::decreaseKey(handle_t h, const T& x);
+ * Replace the item designated by h by a smaller (or equal) item x.
+ * @param h		Handle of the item to change.
+ * @param x		New item value.
+ */
+
+/**
+ * @fn void IndexedHeap::increaseKey(handle_t h, const T& x);
+ * Replace the item designated by h by a greater (or equal) item x.
+ * @param h		Handle of the item to change.
+ * @param x		New item value.
+ */
+
+/**
+ * @fn void IndexedHeap::update(handle_t h, const T& x);
+ * Replace the item designated by h by x, whatever its order.
+ * @param h		Handle of the item to change.
+ * @param x		New item value.
+ */
+
+/**
+ * @fn void IndexedHeap::remove(handle_t h);
+ * Remove the item designated by h from the heap.
+ * @param h		Handle of the item to remove.
+ */
+
+}	// elm
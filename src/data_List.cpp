@@ -60,6 +60,24 @@ namespace elm {
  */
 
 
+/**
+ * @fn T& List::emplace(Args&&... args);
+ * Add, at the head of the list, an item built in place from the given
+ * constructor arguments.
+ * @param args	Arguments passed to the constructor of T.
+ * @return		Reference on the added item.
+ */
+
+
+/**
+ * @fn T& List::emplaceLast(Args&&... args);
+ * Add, at the end of the list, an item built in place from the given
+ * constructor arguments.
+ * @param args	Arguments passed to the constructor of T.
+ * @return		Reference on the added item.
+ */
+
+
 /**
  * @fn const T& List::first(void) const;
  * Get the first item of the list.
@@ -0,0 +1,98 @@
+/*
+ *	MPMCQueue class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <elm/data/MPMCQueue.h>
+
+namespace elm {
+
+/**
+ * @class MPMCQueue
+ * Bounded FIFO queue that can be used concurrently, without lock, by
+ * any number of producer and consumer threads. The items are stored in a ring
+ * buffer whose capacity is fixed at build time (rounded to a power of 2).
+ * Each cell of the ring records a sequence number telling if it is ready
+ * to be written or read: producers and consumers reserve a cell with a
+ * compare-and-swap on the tail, respectively head, index (kept in separate
+ * cache lines) and publish it by updating the sequence number.
+ *
+ * The items put by one producer are got in the same order but the items
+ * of different producers may be interleaved.
+ *
+ * tryPut() and tryGet() return immediately if the queue is respectively full
+ * or empty while put() and get() wait (spinning then yielding the processor)
+ * until the operation can be performed.
+ *
+ * With only one producer and one consumer, @ref SPSCQueue is faster.
+ *
+ * @param T		Type of items (must be default-constructible to use get()).
+ * @param A		Allocator type (default to elm::DefaultAllocatorDelegate).
+ *
+ * @ingroup data
+ */
+
+/**
+ * @fn MPMCQueue::MPMCQueue(int capacity, const A& alloc);
+ * Build a queue.
+ * @param capacity	Maximum number of items (rounded up to the next power of 2).
+ * @param alloc		Allocator to use.
+ */
+
+/**
+ * @fn int MPMCQueue::capacity(void) const;
+ * Get the maximum number of items in the queue.
+ * @return	Queue capacity.
+ */
+
+/**
+ * @fn int MPMCQueue::count(void) const;
+ * Get the number of items in the queue. As the queue may be modified
+ * concurrently, the result is only a snapshot.
+ * @return	Number of items.
+ */
+
+/**
+ * @fn bool MPMCQueue::tryPut(const T& x);
+ * Put an item at the tail of the queue if it is not full.
+ * @param x		Item to put.
+ * @return		True if the item has been put, false if the queue is full.
+ */
+
+/**
+ * @fn void MPMCQueue::put(const T& x);
+ * Put an item at the tail of the queue, waiting for the queue to be not full.
+ * @param x		Item to put.
+ */
+
+/**
+ * @fn bool MPMCQueue::tryGet(T& x);
+ * Get the item at the head of the queue if it is not empty.
+ * @param x		Assigned to the got item.
+ * @return		True if an item has been got, false if the queue is empty.
+ */
+
+/**
+ * @fn T MPMCQueue::get(void);
+ * Get the item at the head of the queue, waiting for the queue to be not empty.
+ * @return	Got item.
+ */
+
+}	// elm
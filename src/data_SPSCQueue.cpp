@@ -0,0 +1,99 @@
+/*
+ *	SPSCQueue class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <elm/data/SPSCQueue.h>
+
+namespace elm {
+
+/**
+ * @class SPSCQueue
+ * Bounded FIFO queue to pass items from one producer thread to one
+ * consumer thread without lock. The items are stored in a ring buffer whose
+ * capacity is fixed at build time (rounded to a power of 2) and the
+ * head and tail indexes are kept in separate cache lines to avoid
+ * false sharing between the producer and the consumer.
+ *
+ * Only one thread may call put() / tryPut() and only one thread may call
+ * get() / tryGet() at the same time. For several producers or consumers,
+ * use @ref MPMCQueue.
+ *
+ * tryPut() and tryGet() return immediately if the queue is respectively full
+ * or empty while put() and get() wait (spinning then yielding the processor)
+ * until the operation can be performed.
+ *
+ * @param T		Type of items (must be default-constructible to use get()).
+ * @param A		Allocator type (default to elm::DefaultAllocatorDelegate).
+ *
+ * @ingroup data
+ */
+
+/**
+ * @fn SPSCQueue::SPSCQueue(int capacity, const A& alloc);
+ * Build a queue.
+ * @param capacity	Maximum number of items (rounded up to the next power of 2).
+ * @param alloc		Allocator to use.
+ */
+
+/**
+ * @fn int SPSCQueue::capacity(void) const;
+ * Get the maximum number of items in the queue.
+ * @return	Queue capacity.
+ */
+
+/**
+ * @fn int SPSCQueue::count(void) const;
+ * Get the number of items in the queue. As the queue may be modified
+ * concurrently, the result is only a snapshot.
+ * @return	Number of items.
+ */
+
+/**
+ * @fn bool SPSCQueue::tryPut(const T& x);
+ * Put an item at the tail of the queue if it is not full.
+ * Must only be called by the producer thread.
+ * @param x		Item to put.
+ * @return		True if the item has been put, false if the queue is full.
+ */
+
+/**
+ * @fn void SPSCQueue::put(const T& x);
+ * Put an item at the tail of the queue, waiting for the queue to be not full.
+ * Must only be called by the producer thread.
+ * @param x		Item to put.
+ */
+
+/**
+ * @fn bool SPSCQueue::tryGet(T& x);
+ * Get the item at the head of the queue if it is not empty.
+ * Must only be called by the consumer thread.
+ * @param x		Assigned to the got item.
+ * @return		True if an item has been got, false if the queue is empty.
+ */
+
+/**
+ * @fn T SPSCQueue::get(void);
+ * Get the item at the head of the queue, waiting for the queue to be not empty.
+ * Must only be called by the consumer thread.
+ * @return	Got item.
+ */
+
+}	// elm
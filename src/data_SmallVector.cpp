@@ -0,0 +1,111 @@
+/*
+ *	SmallVector class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <elm/data/SmallVector.h>
+
+namespace elm {
+
+/**
+ * @class SmallVector
+ * Vector storing up to N items inside the object itself: no memory is
+ * allocated as long as the vector does not contain more than N items. Beyond
+ * this limit, the items are moved to a buffer allocated with the allocator A
+ * and the vector behaves as a @ref Vector (the buffer capacity is doubled
+ * each time it is full).
+ *
+ * This class provides the same interface as @ref Vector and can be used
+ * in place of it for short-lived vectors or for vectors usually containing
+ * few items. Contrary to @ref Vector, only the items actually stored in the
+ * vector are constructed.
+ *
+ * @par Performances
+ * @li indexed access -- O(1)
+ * @li addition at end -- O(1), no allocation up to N items
+ * @li removal -- O(n)
+ * @li find -- O(n)
+ * @li memory -- 2 integers, 1 pointer and N items
+ *
+ * @par Implemented concepts
+ * @li @ref elm::concept::Array
+ * @li @ref elm::concept::Collection
+ * @li @ref elm::concept::List
+ * @li @ref elm::concept::MutableArray
+ * @li @ref elm::concept::MutableCollection
+ * @li @ref elm::concept::MutableList
+ * @li @ref elm::concept::Stack
+ *
+ * @param T	Type of stored items.
+ * @param N	Number of items stored inside the object (default to 8).
+ * @param E	Equivalence for items (default to @ref Equiv).
+ * @param A	Allocator used beyond N items.
+ * @ingroup data
+ */
+
+/**
+ * @fn SmallVector::SmallVector(self_t&& vec);
+ * Move constructor: if vec uses an allocated buffer, it is stolen;
+ * else its items are moved one by one. vec is left empty.
+ * @param vec	Vector to move from.
+ */
+
+/**
+ * @fn int SmallVector::capacity(void) const;
+ * Get the capacity of the vector.
+ * @return	Capacity (at least N).
+ */
+
+/**
+ * @fn bool SmallVector::isSmall(void) const;
+ * Test if the items are stored inside the vector object.
+ * @return	True if no buffer is allocated, false else.
+ */
+
+/**
+ * @fn void SmallVector::grow(int new_cap);
+ * Make the capacity of the vector to grow, causing the items to be moved to an
+ * allocated buffer. Notice that the length is unchanged.
+ * @param new_cap	New capacity of the vector.
+ */
+
+/**
+ * @fn void SmallVector::setLength(int new_length);
+ * Change the length of the vector: new items are default-constructed
+ * and items beyond the new length are destroyed.
+ * @param new_length	New length of the vector.
+ */
+
+/**
+ * @fn T& SmallVector::emplace(Args&&... args);
+ * Add an item at the end of the vector built in place from the given
+ * constructor arguments.
+ * @param args	Arguments passed to the constructor of T.
+ * @return		Reference on the added item.
+ */
+
+/**
+ * @fn Array<T> SmallVector::asArray(void);
+ * Get the items of the vector as an array. The array is only valid
+ * until the next modification of the vector.
+ * @return	Array of items.
+ */
+
+}	// elm
@@ -22,3 +22,53 @@
 #include <elm/data/TreeBag.h>
 #include <elm/data/TreeMap.h>
 
+namespace elm {
+
+/**
+ * @class TreeBag
+ * Bag (collection accepting several equal items) stored in a sorted
+ * binary tree. The tree is kept balanced (AVL rebalancing shared with
+ * @ref avl::GenTree) so that addition, look-up and removal are O(log(n))
+ * whatever the insertion order. The number of items is maintained so
+ * that count() is O(1).
+ *
+ * Equal items are stored next to each other: iteration provides the items
+ * in increasing order according to the comparator.
+ *
+ * @par Implemented concepts
+ * @li @ref elm::concept::Collection
+ * @li @ref elm::concept::MutableCollection
+ *
+ * @param T		Type of items.
+ * @param C		Comparator (default to @ref Comparator).
+ * @param A		Allocator.
+ * @ingroup data
+ */
+
+/**
+ * @fn const T *TreeBag::find(const T& x) const;
+ * Look for an item equal to x.
+ * @param x		Looked item.
+ * @return		Found item or null pointer.
+ */
+
+
+/**
+ * @class TreeMap
+ * Map based on a @ref TreeBag of (key, value) pairs: its operations
+ * are O(log(n)) and its iteration follows the order of the keys.
+ *
+ * @par Implemented concepts
+ * @li @ref elm::concept::Collection
+ * @li @ref elm::concept::Map
+ * @li @ref elm::concept::MutableMap
+ *
+ * @param K		Type of keys.
+ * @param T		Type of values.
+ * @param C		Comparator of keys (default to @ref Comparator).
+ * @param E		Equivalence of values (default to @ref Equiv).
+ * @param A		Allocator.
+ * @ingroup data
+ */
+
+}	// elm
@@ -77,9 +77,53 @@ namespace elm {
  * @fn void Vector::grow(int new_cap);
  * Make the capacity of the vector to grow, possibly causing
  * a buffer re-allocation. Notice that the length is unchanged.
+ * The items are moved (and not copied) to the new buffer:
+ * with a simple memcpy() for relocatable types (see @ref array::is_relocatable).
  * @param new_cap	New capacity of the vector.
  */
 
+/**
+ * @fn Vector::Vector(void);
+ * Build an empty vector. No buffer is allocated until the first
+ * item is added (the capacity then starts at 8), making empty vectors
+ * cheap to build, for example as items of another vector.
+ */
+
+/**
+ * @fn Vector::Vector(int _cap);
+ * Build an empty vector with the given capacity.
+ * @param _cap	Initial capacity.
+ */
+
+/**
+ * @fn Vector::Vector(self_t&& vec);
+ * Move constructor: the buffer of vec is stolen and vec
+ * is left empty (but still usable).
+ * @param vec	Vector to move from.
+ */
+
+/**
+ * @fn self_t& Vector::operator=(self_t&& vec);
+ * Move assignment: the current buffer is released and
+ * the one of vec is stolen, vec being left empty.
+ * @param vec	Vector to move from.
+ * @return		Current vector.
+ */
+
+/**
+ * @fn void Vector::add(T&& v);
+ * Add an item at the end of the vector by moving it.
+ * @param v		Item to add.
+ */
+
+/**
+ * @fn T& Vector::emplace(Args&&... args);
+ * Add an item at the end of the vector built in place
+ * from the given constructor arguments.
+ * @param args	Arguments passed to the constructor of T.
+ * @return		Reference on the added item.
+ */
+
 /**
  * @fn void Vector::setLength(int new_length);
  * Change the length of the vector, possibly causing re-allocation
@@ -25,6 +25,41 @@
 
 namespace elm {
 
+// array population count, four accumulators to hide the latency
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+static __attribute__((target("popcnt"))) int countOnesPOPCNT(const t::uint64 *w, int n) {
+	t::uint64 c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+	int i = 0;
+	for(; i + 4 <= n; i += 4) {
+		c0 += __builtin_popcountll(w[i]);
+		c1 += __builtin_popcountll(w[i + 1]);
+		c2 += __builtin_popcountll(w[i + 2]);
+		c3 += __builtin_popcountll(w[i + 3]);
+	}
+	for(; i < n; i++)
+		c0 += __builtin_popcountll(w[i]);
+	return int(c0 + c1 + c2 + c3);
+}
+#endif
+
+static int countOnesPortable(const t::uint64 *w, int n) {
+	int c = 0;
+	for(int i = 0; i < n; i++)
+		c += countOnes(w[i]);
+	return c;
+}
+
+typedef int (*count_t)(const t::uint64 *w, int n);
+
+static count_t selectCount(void) {
+#	if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+		__builtin_cpu_init();
+		if(__builtin_cpu_supports("popcnt"))
+			return countOnesPOPCNT;
+#	endif
+	return countOnesPortable;
+}
+
 /**
  * @typedef t::int8
  * Signed 8-bit integer type.
@@ -160,6 +195,37 @@ int msb(t::uint64 i) {
 }
 
 
+/**
+ * @fn int lsb(t::uint32 i);
+ * Compute the position of the right-most bit to one.
+ * @param i		Integer to test.
+ * @return		Position of right-most bit to one or -1 if the integer is 0.
+ * @ingroup types
+ */
+#ifndef __GNUC__
+int lsb(t::uint32 i) {
+	if(!i)
+		return -1;
+	int r = 0;
+	if(!(i & 0xffff)) { r += 16; i >>= 16; }
+	if(!(i & 0xff)) { r += 8; i >>= 8; }
+	if(!(i & 0xf)) { r += 4; i >>= 4; }
+	if(!(i & 0x3)) { r += 2; i >>= 2; }
+	if(!(i & 0x1)) r += 1;
+	return r;
+}
+#endif
+
+
+/**
+ * @fn int lsb(t::uint64 i);
+ * Compute the position of the right-most bit to one.
+ * @param i		Integer to test.
+ * @return		Position of right-most bit to one or -1 if the integer is 0.
+ * @ingroup types
+ */
+
+
 /**
  * Count the number of ones in the given byte.
  * @param i		Byte to count ones in.
@@ -215,6 +281,20 @@ int ones(t::uint8 i) {
  */
 
 
+/**
+ * Count the number of ones in an array of double-words. The hardware
+ * population count instruction is used if the processor provides it.
+ * @param w		Array of double-words.
+ * @param n		Count of double-words.
+ * @return		Number of ones in the array.
+ * @ingroup types
+ */
+int countOnes(const t::uint64 *w, int n) {
+	static const count_t count = selectCount();
+	return count(w, n);
+}
+
+
 /**
  * Get the least upper power of 2 for the given value.
  * If the value is a power of two, return it else compute
@@ -56,11 +56,27 @@ namespace elm { namespace io {
  */
 
 
+/**
+ * @fn int BlockOutStream::capacity(void) const;
+ * Get the capacity of the block, i.e. the size it may reach without
+ * reallocation.
+ * @return	Block capacity.
+ */
+
+
+/**
+ * @fn void BlockOutStream::reserve(int size);
+ * Ensure the block may reach the given size without reallocation.
+ * It is useful when the size of the output is known in advance.
+ * @param size	Size to reserve.
+ */
+
+
 /**
  * @fn char *BlockOutStream::detach(void);
  * Detach the block from the stream. After this call, the stream will
  * perform no management on the memory block and the caller is responsible
- * for deleting it.
+ * for releasing it with free().
  * It is an error to perform more output after this call unless
  * @ref restart() is called.
  * @return	Base of the block.
@@ -106,7 +122,7 @@ int BlockOutStream::flush(void) {
 /**
  * Convert the buffer to a CString object.
  * (this object must not be used after this call and the caller is responsible
- * for freeing the C string buffer).
+ * for freeing the C string buffer with free()).
  * @return	Buffer converted to C string.
  */
 CString BlockOutStream::toCString(void) {
@@ -37,6 +37,10 @@ namespace elm { namespace json {
  * on @ref json::Exception if the JSON text does not match the
  * requirement of the maker.
  *
+ * A maker overriding usesSymbols() to return true receives the field names
+ * as interned @ref Symbol (by onField(Symbol)): this avoids the field
+ * name copies and makes comparison of field names O(1).
+ *
  * @ingroup json
  */
 
@@ -132,6 +136,24 @@ void Maker::onValue(string value) {
 	throw json::Exception("unexpected string value");
 }
 
+/**
+ * Test if field names are passed as symbols, with onField(Symbol).
+ * As a default, return false.
+ * @return	True if field names are passed as symbols, false else.
+ */
+bool Maker::usesSymbols(void) const {
+	return false;
+}
+
+/**
+ * Called instead of onField(string) when the maker uses symbols.
+ * As a default, call onField(string).
+ * @param name	Field name.
+ */
+void Maker::onField(Symbol name) {
+	onField(name.toString());
+}
+
 
 /**
  * @class Parser
@@ -268,7 +290,10 @@ void Parser::parseObject(io::InStream& in) {
 	while(t != RBRACE) {
 		if(t != STRING)
 			error("expected field name here");
-		m.onField(text);
+		if(m.usesSymbols())
+			m.onField(Symbol(text));
+		else
+			m.onField(text);
 		t = next(in);
 		if(t != COLON)
 			error("':' expected here");
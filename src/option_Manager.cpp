@@ -464,7 +464,7 @@ void Manager::displayHelp(void) {
 
 	// display the arguments
 	Vector<Option *> done;
-	typedef ListMap<string, Option *>::PairIter iter;
+	typedef FlatMap<string, Option *>::PairIter iter;
 	for(iter cmd = cmds.pairs().begin(); cmd(); cmd++) {
 
 		// already done?
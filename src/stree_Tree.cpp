@@ -43,6 +43,13 @@ namespace elm { namespace stree  {
  * The access is quite fast (log2(n)) but the creation of the tree is not dynamic: all segment
  * must be provided at creation time.
  *
+ * The builders produce a linked tree of @ref node_t that is flattened by set():
+ * the lower bounds of the segments are stored in an array in BFS (Eytzinger) order
+ * and the associated items in a separate array with the same indexes. A look-up
+ * only reads the key array, descends without comparison-dependent branches
+ * and prefetches the nodes a few levels below. find() with an array of keys
+ * interleaves the descents of up to BATCH keys to overlap their cache misses.
+ *
  * To help to build such a structure, several builder are provided:
  * @li @ref elm::stree::Builder
  * @li @ref elm::stree::MakerBuilder
@@ -62,15 +69,16 @@ namespace elm { namespace stree  {
 
 /**
  * @fn Tree::Tree(int _root, node_t *_nodes);
- * Build form the given list of nodes. The tree is responsible to release the node
- * array at destruction time.
+ * Build form the given list of nodes. The node array is released once
+ * the tree has been flattened.
  * @param _root		Index of root node in the node array.
  * @param _nodes	List of nodes.
  */
 
 /**
  * @fn void Tree::set(int _root, node_t *_nodes);
- * Initialize the current tree with the current configuration.
+ * Initialize the current tree from the given linked nodes: the tree
+ * is flattened and the node array is released.
  * @param _root		Index of root node in the node array.
  * @param _nodes	List of nodes.
  */
@@ -90,9 +98,25 @@ namespace elm { namespace stree  {
  * @return		Found value.
  */
 
+/**
+ * @fn int Tree::count(void) const;
+ * Get the number of segments in the tree.
+ * @return	Number of segments.
+ */
+
+/**
+ * @fn void Tree::find(const K keys[], T *results[], int n) const;
+ * Look up several keys at once. The searches are interleaved by groups of
+ * BATCH keys, which is faster than n calls to get() when the tree does
+ * not fit in the cache.
+ * @param keys		Keys to look for.
+ * @param results	Filled with pointers to the found items (null if the key is out of the tree).
+ * @param n			Number of keys.
+ */
+
 /**
  * @fn bool contains(const K& key) const;
- * Test if the key is contained in the tree.
+ * Test if the key is contained in the tree (always false for an empty tree).
  * @param key	Key to test.
  * @return		True if the key is contained, false else.
  */
@@ -130,13 +130,25 @@
  * @class String
  * An immutable implementation of the string data type. Refer to
  * @ref StringBuffer for long concatenation string building.
+ *
+ * Strings of at most 23 characters are stored inline in the String object
+ * itself: building, copying or releasing them performs no memory allocation
+ * and no reference counting. Longer strings are stored in a heap buffer.
+ * A substring of a long string shares the buffer of its parent while a
+ * substring of a short string is copied inline.
+ *
+ * The character buffers are shared between the strings and released
+ * according to a reference counter. This counter is updated with atomic
+ * operations so that strings sharing the same buffer can be used (copied,
+ * released) from different threads; notice that a single String object
+ * must not be modified concurrently. If the library and the application are
+ * built with the ELM_NO_STRING_ATOMIC macro (CMake option of the same name),
+ * plain increments are used instead: this is faster but only safe for
+ * single-threaded programs.
+ *
  * @ingroup string
- * @warning This string class is bound to strings of less than 65535 characters.
  */
 
- /* Empty buffer */
- String::buffer_t String::empty_buf = { 1, { 0 } };
- 
  /**
   * Make a string by copying the given character array.
   * @param str	Character array address.
@@ -144,23 +156,18 @@
   */
  void String::copy(const char *str, int _len) {
  	
- 	// empty string?
- 	if(!_len) {
- 		buf = (char *)&empty_buf;
- 		off = zero_off;
- 		len = 0;
- 		lock();
- 	}
+ 	// short string: stored inline
+ 	if(_len <= inline_max)
+ 		setInline(str, _len);
  	
  	// Create the buffer
  	else {
-		buf = new char[sizeof(buffer_t) + _len]; 
+		char *buf = static_cast<char *>(::malloc(sizeof(buffer_t) + _len));
 		buffer_t *desc = (buffer_t *)buf;
 		desc->use = 1;
 		memcpy(desc->buf, str, _len);
 		desc->buf[_len] = '\0';
-		off = zero_off;
-		len = _len; 
+		setHeap(buf, zero_off, _len);
  	}
 }
 
@@ -195,7 +202,15 @@ String String::make(String str, int n) {
  * @param l2	Second character array length.
  */
 String String::concat(const char *s1, int l1, const char *s2, int l2) {
-	buffer_t *sbuf = (buffer_t *)new char[sizeof(String::buffer_t) + l1 + l2];
+	if(l1 + l2 <= inline_max) {
+		String r;
+		memcpy(r.u.in, s1, l1);
+		memcpy(r.u.in + l1, s2, l2);
+		r.u.in[l1 + l2] = '\0';
+		r.u.in[inline_max] = char(inline_max - l1 - l2);
+		return r;
+	}
+	buffer_t *sbuf = (buffer_t *)::malloc(sizeof(String::buffer_t) + l1 + l2);
 	sbuf->use = 0;
 	memcpy(sbuf->buf, s1, l1);
 	memcpy(sbuf->buf + l1, s2, l2);
@@ -212,20 +227,27 @@ String String::concat(const char *s1, int l1, const char *s2, int l2) {
 void String::toc(void) const {
 	
 	// Only one owner
-	buffer_t *sbuf = (buffer_t *)buf;
-	if(sbuf->use <= 1)
-		sbuf->buf[len] = '\0';
+	buffer_t *sbuf = (buffer_t *)u.h.buf;
+	if(getUse(sbuf) <= 1)
+		((char *)u.h.buf)[u.h.off + u.h.len] = '\0';
 	
+	// Short string: move it inline
+	else if(u.h.len <= inline_max) {
+		const char *p = chars();
+		setInline(p, u.h.len);
+		if(decUse(sbuf))
+			::free(sbuf);
+	}
+
 	// Build a new buffer
 	else {
-		char *nbuf = new char[sizeof(buffer_t) + len]; 
+		char *nbuf = static_cast<char *>(::malloc(sizeof(buffer_t) + u.h.len));
 		buffer_t *nsbuf = (buffer_t *)nbuf;
 		nsbuf->use = 1;
-		memcpy(nsbuf->buf, chars(), len);
+		memcpy(nsbuf->buf, chars(), u.h.len);
+		nsbuf->buf[u.h.len] = '\0';
 		unlock();
-		nsbuf->buf[len] = '\0';
-		off = zero_off;
-		buf = nbuf;
+		setHeap(nbuf, zero_off, u.h.len);
 	}
 }
 
@@ -38,13 +38,16 @@ namespace elm {
  * @fn StringBuffer::StringBuffer(int capacity, int increment);
  * Build a new string buffer.
  * @param capacity		Initial capacity of the buffer.
- * @param increment	Incrementation size when buffer is enlarged.
+ * @param increment	Minimal incrementation size when buffer is enlarged
+ * 						(the capacity is doubled as the buffer grows).
  */
 
 	
 /**
  * @fn String StringBuffer::toString(void);
- * Convert the buffer to a string. The string buffer must no more be used after this call.
+ * Convert the buffer to a string. The string buffer must no more be used after this call
+ * (unless reset() is called). Long strings are not copied: the buffer memory is
+ * given to the string.
  * @return String contained in the buffer.
  */
 	
@@ -56,6 +59,14 @@ namespace elm {
  */
 
 
+/**
+ * @fn void StringBuffer::reserve(int n);
+ * Ensure the buffer may store a string of n characters without any
+ * reallocation. It is useful when the final length is known in advance.
+ * @param n	Number of characters to reserve.
+ */
+
+
 /**
  * @fn void StringBuffer::reset(void);
  * Remove all characters from the string buffer.
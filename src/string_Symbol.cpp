@@ -0,0 +1,215 @@
+/*
+ *	Symbol class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ * 
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software 
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/FlatHashTable.h>
+#include <elm/string/Symbol.h>
+#include <elm/sys/Thread.h>
+
+namespace elm {
+
+/**
+ * @class Symbol
+ * A symbol is a string interned in a global table: two symbols built from
+ * the same characters share the same table entry. Equality and hashing are
+ * then O(1) (the hash is computed once at interning time) and a symbol is
+ * as cheap to copy as a pointer. This makes symbols the right key type for
+ * names that recur a lot (XML element names, JSON fields, configuration
+ * keys) and are compared or hashed often.
+ *
+ * The table is shared by all threads and is protected by a set of mutexes
+ * selected from the hash of the interned string so that concurrent
+ * interning of different names rarely contends. Interned entries are never
+ * released: symbols should be built from names, not from arbitrary data.
+ *
+ * Symbols are only built explicitly from strings (interning has a cost
+ * and the implicit conversions would make ambiguous the overloads taking
+ * either a string or a symbol).
+ *
+ * The empty string is interned as the null symbol which does not use the
+ * table. Ordering operators compare the characters of the symbols and are
+ * therefore as costly as string comparisons.
+ *
+ * @ingroup string
+ */
+
+// key of the symbol entries
+class SymbolKey {
+public:
+	static inline t::hash hash(const Symbol::Entry *e) { return e->hash; }
+	static inline bool equals(const Symbol::Entry *e1, const Symbol::Entry *e2)
+		{ return e1 == e2 || (e1->hash == e2->hash && e1->name == e2->name); }
+	inline t::hash computeHash(const Symbol::Entry *e) const { return hash(e); }
+	inline bool isEqual(const Symbol::Entry *e1, const Symbol::Entry *e2) const { return equals(e1, e2); }
+};
+
+// interning table
+class SymbolTable {
+	static const int SHARDS = 64;
+
+	class Shard {
+	public:
+		inline Shard(void): mutex(sys::Mutex::make()) { }
+		sys::Mutex *mutex;
+		FlatHashTable<const Symbol::Entry *, SymbolKey> tab;
+	};
+
+public:
+
+	static SymbolTable& get(void) {
+		static SymbolTable *table = new SymbolTable;
+		return *table;
+	}
+
+	const Symbol::Entry *find(const String& name, bool add) {
+		Symbol::Entry key(name, hash_string(name.chars(), name.length()));
+		Shard& s = shards[(hash_mix(key.hash) >> 58) & (SHARDS - 1)];
+		sys::MutexGuard g(s.mutex);
+		const Symbol::Entry * const *r = s.tab.get(&key);
+		if(r != nullptr)
+			return *r;
+		if(!add)
+			return nullptr;
+		const Symbol::Entry *e = new Symbol::Entry(String(name.chars(), name.length()), key.hash);
+		s.tab.add(e);
+		return e;
+	}
+
+	int count(void) {
+		int c = 0;
+		for(int i = 0; i < SHARDS; i++) {
+			sys::MutexGuard g(shards[i].mutex);
+			c += shards[i].tab.count();
+		}
+		return c;
+	}
+
+private:
+	Shard shards[SHARDS];
+};
+
+
+/**
+ * Null symbol, equal to the empty string.
+ */
+const Symbol Symbol::null;
+
+
+/**
+ * @fn Symbol::Symbol(void);
+ * Build the null symbol.
+ */
+
+/**
+ * @fn Symbol::Symbol(const char *str);
+ * Build a symbol by interning the given C string.
+ * @param str	String to intern.
+ */
+
+/**
+ * @fn Symbol::Symbol(cstring str);
+ * Build a symbol by interning the given C string.
+ * @param str	String to intern.
+ */
+
+/**
+ * @fn Symbol::Symbol(const String& str);
+ * Build a symbol by interning the given string. The symbol does not keep
+ * a reference on the string buffer: a symbol built from a sub-string
+ * does not retain its parent string.
+ * @param str	String to intern.
+ */
+
+
+/**
+ * Look for a symbol without interning it.
+ * @param str	Name of the symbol.
+ * @return		Found symbol or the null symbol if str is not interned yet.
+ */
+Symbol Symbol::find(const String& str) {
+	if(!str)
+		return null;
+	return Symbol(SymbolTable::get().find(str, false));
+}
+
+
+/**
+ * Count the interned symbols (mainly for statistics and testing).
+ * @return	Number of interned symbols.
+ */
+int Symbol::count(void) {
+	return SymbolTable::get().count();
+}
+
+
+/**
+ * @fn bool Symbol::isNull(void) const;
+ * Test if the symbol is null, i.e. built from an empty string.
+ * @return	True if the symbol is null, false else.
+ */
+
+/**
+ * @fn int Symbol::length(void) const;
+ * Get the length of the symbol name.
+ * @return	Symbol name length.
+ */
+
+/**
+ * @fn const char *Symbol::chars(void) const;
+ * Get the characters of the symbol name. The name is null-terminated.
+ * @return	Symbol name characters.
+ */
+
+/**
+ * @fn cstring Symbol::toCString(void) const;
+ * Get the symbol name as a C string, without copy.
+ * @return	Symbol name.
+ */
+
+/**
+ * @fn String Symbol::toString(void) const;
+ * Get the symbol name as a string, sharing the buffer of the interned name.
+ * @return	Symbol name.
+ */
+
+/**
+ * @fn t::hash Symbol::hash(void) const;
+ * Get the hash of the symbol. It is the same as the one of
+ * HashKey<String> for the symbol name.
+ * @return	Symbol hash.
+ */
+
+/**
+ * @fn int Symbol::compare(const Symbol& s) const;
+ * Compare the names of the symbols.
+ * @param s		Symbol to compare with.
+ * @return		0 for equality, <0 if the current symbol is less than s, >0 else.
+ */
+
+
+// intern the given string
+void Symbol::intern(const String& str) {
+	if(!str)
+		e = nullptr;
+	else
+		e = SymbolTable::get().find(str, true);
+}
+
+}	// elm
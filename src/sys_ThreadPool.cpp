@@ -0,0 +1,223 @@
+/*
+ *	ThreadPool class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <elm/sys/System.h>
+#include <elm/sys/ThreadPool.h>
+
+namespace elm { namespace sys {
+
+/**
+ * @class ThreadPool
+ * A pool of threads (built on @ref Thread) to perform fork-join parallel
+ * computations: run() (or forEach()) executes the body for each index of
+ * [0, n[ on the threads of the pool and on the calling thread and
+ * returns when all indexes have been processed. The indexes are dispatched
+ * dynamically so the body computations may have different durations.
+ *
+ * The threads are created once with the pool and sleep between calls. A pool
+ * is shared by all parallel algorithms of ELM (see shared()).
+ *
+ * If run() is called while the pool is already running a computation
+ * (from another thread or from a body), the computation is performed
+ * sequentially by the calling thread: this makes nested parallel calls
+ * safe but not parallel.
+ *
+ * The body must not throw exceptions.
+ *
+ * @ingroup system
+ */
+
+/**
+ * @class ThreadPool::Body
+ * Computation performed by a @ref ThreadPool for each index.
+ */
+
+/**
+ */
+ThreadPool::Body::~Body(void) {
+}
+
+/**
+ * @fn void ThreadPool::Body::run(int i);
+ * Perform the computation for the given index.
+ * @param i	Index to process.
+ */
+
+
+// internal state
+class ThreadPool::State {
+public:
+	inline State(void): next(0), busy(false), body(nullptr), n(0), gen(0), finished(0), stop(false) { }
+
+	void work(Body *b, int n) {
+		for(int i = next.fetch_add(1); i < n; i = next.fetch_add(1))
+			b->run(i);
+	}
+
+	std::mutex mutex;
+	std::condition_variable wake, done;
+	std::atomic<int> next;
+	std::atomic<bool> busy;
+	Body *body;
+	int n, gen, finished;
+	bool stop;
+};
+
+
+// worker thread
+class ThreadPool::Worker: public Runnable {
+public:
+	inline Worker(State& state): s(state) { }
+
+	void run(void) override {
+		int seen = 0;
+		std::unique_lock<std::mutex> l(s.mutex);
+		while(true) {
+			s.wake.wait(l, [&]() { return s.stop || s.gen != seen; });
+			if(s.stop)
+				return;
+			seen = s.gen;
+			Body *b = s.body;
+			int n = s.n;
+			l.unlock();
+			s.work(b, n);
+			l.lock();
+			s.finished++;
+			s.done.notify_one();
+		}
+	}
+
+private:
+	State& s;
+};
+
+
+/**
+ * Build a thread pool.
+ * @param count	Number of threads, including the calling thread
+ * 				(if 0, the number of cores of the host).
+ * @throw SystemException	Lack of OS resources.
+ */
+ThreadPool::ThreadPool(int count): cnt(count), state(new State()), workers(nullptr), thds(nullptr) {
+	if(cnt <= 0)
+		cnt = System::coreCount();
+	if(cnt <= 0)
+		cnt = 1;
+	if(cnt > 1) {
+		workers = new Worker *[cnt - 1];
+		thds = new Thread *[cnt - 1];
+		for(int i = 0; i < cnt - 1; i++) {
+			workers[i] = new Worker(*state);
+			thds[i] = Thread::make(*workers[i]);
+			thds[i]->start();
+		}
+	}
+}
+
+
+/**
+ * Stop and join the threads.
+ */
+ThreadPool::~ThreadPool(void) {
+	if(cnt > 1) {
+		{
+			std::lock_guard<std::mutex> l(state->mutex);
+			state->stop = true;
+		}
+		state->wake.notify_all();
+		for(int i = 0; i < cnt - 1; i++) {
+			thds[i]->join();
+			delete thds[i];
+			delete workers[i];
+		}
+		delete [] thds;
+		delete [] workers;
+	}
+	delete state;
+}
+
+
+/**
+ * @fn int ThreadPool::threadCount(void) const;
+ * Get the number of threads performing a computation, including the calling thread.
+ * @return	Thread count.
+ */
+
+
+/**
+ * Perform body.run(i) for each i in [0, n[ in parallel and wait for
+ * the end of all computations.
+ * @param n		Number of indexes.
+ * @param body	Body to run.
+ */
+void ThreadPool::run(int n, Body& body) {
+	if(n <= 0)
+		return;
+	if(cnt == 1 || n == 1 || state->busy.exchange(true)) {
+		for(int i = 0; i < n; i++)
+			body.run(i);
+		return;
+	}
+
+	// wake up the workers
+	{
+		std::lock_guard<std::mutex> l(state->mutex);
+		state->body = &body;
+		state->n = n;
+		state->next = 0;
+		state->finished = 0;
+		state->gen++;
+	}
+	state->wake.notify_all();
+
+	// work and wait for the workers
+	state->work(&body, n);
+	{
+		std::unique_lock<std::mutex> l(state->mutex);
+		state->done.wait(l, [&]() { return state->finished == cnt - 1; });
+	}
+	state->busy = false;
+}
+
+
+/**
+ * @fn void ThreadPool::forEach(int n, F f);
+ * Perform f(i) for each i in [0, n[ in parallel and wait for the end
+ * of all computations.
+ * @param n		Number of indexes.
+ * @param f		Function to call (taking an int as parameter).
+ */
+
+
+/**
+ * Get the thread pool shared by the parallel algorithms of ELM.
+ * It uses as many threads as there are cores on the host.
+ * @return	Shared thread pool.
+ */
+ThreadPool& ThreadPool::shared(void) {
+	static ThreadPool pool;
+	return pool;
+}
+
+} }	// elm::sys
@@ -196,6 +196,36 @@ Mutex::~Mutex(void) { }
  */
 
 
+/**
+ * @class MutexGuard
+ * Scoped lock of a @ref Mutex: the mutex is acquired by the constructor
+ * and released by the destructor, including when an exception is thrown.
+ * @code
+ *	{
+ *		sys::MutexGuard g(mutex);
+ *		// critical section
+ *	}
+ * @endcode
+ */
+
+/**
+ * @fn MutexGuard::MutexGuard(Mutex *m);
+ * Acquire the given mutex.
+ * @param m		Mutex to acquire.
+ */
+
+/**
+ * @fn MutexGuard::MutexGuard(Mutex& m);
+ * Acquire the given mutex.
+ * @param m		Mutex to acquire.
+ */
+
+/**
+ * @fn MutexGuard::~MutexGuard(void);
+ * Release the mutex.
+ */
+
+
 #if defined(__unix) || defined(__APPLE__)
 
 	/**
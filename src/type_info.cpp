@@ -149,6 +149,8 @@ namespace elm {
  * The include file <otawa/util/array.h> provides functions to handling arrays:
  * @li @ref array::copy() -- copy without overlapping
  * @li @ref array::move() -- copy with overlapping
+ * @li @ref array::relocate() -- move (in the C++11 sense) with overlapping, the source items are left in a valid but unspecified state
+ * @li @ref array::transfer() -- move to uninitialized memory, the source items are destroyed
  * @li @ref array::clear() -- set to initial value
  * @li @ref array::set() -- set all items to a specific values
  *
@@ -0,0 +1,305 @@
+/*
+ *	BitMatrix class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ * 
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software 
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/util/BitMatrix.h>
+#include <string.h>
+
+namespace elm {
+
+// the word kernels take int counts: whole matrices are processed by chunks
+static const t::size CHUNK = t::size(1) << 30;
+static inline int chunk(t::size n) { return int(n < CHUNK ? n : CHUNK); }
+
+/**
+ * @class BitMatrix
+ * Matrix of bits whose rows are packed contiguously, each row being made
+ * of 64-bit words. This representation is well-suited to store the facts
+ * of a data flow analysis (one row per node) or a relation (for example
+ * the reachability in a graph) without allocating one @ref BitVector per
+ * element.
+ *
+ * Rows are accessed by @ref BitMatrix::Row objects, light references that
+ * provide the same operations as @ref BitVector (union, intersection,
+ * difference, comparisons, iteration on the ones) using the same vectorized
+ * kernels. The in-place operations return true if the modified row has
+ * changed, which is the information required to detect the fixpoint
+ * of an iterative algorithm.
+ *
+ * As the bits after the column count in the last word of each row are kept
+ * to 0, rows can be compared word by word.
+ *
+ * @see WorkListSolver
+ * @ingroup utility
+ */
+
+
+/**
+ * @class BitMatrix::Row
+ * Reference to a row of a @ref BitMatrix (or to any array of 64-bit words).
+ * A row is only valid as long as its matrix is alive and is not assigned.
+ * As for @ref BitVector, the modifying operations are const because they
+ * do not change the reference itself.
+ */
+
+
+/**
+ * @fn BitMatrix::Row::Row(word_t *w, int size);
+ * Build a row reference.
+ * @param w		Words of the row.
+ * @param size	Number of bits in the row.
+ */
+
+
+/**
+ * @fn bool BitMatrix::Row::applyOr(const Row& r) const;
+ * Perform the union of the current row with r.
+ * @param r		Row to join with.
+ * @return		True if the current row has changed, false else.
+ */
+
+
+/**
+ * @fn bool BitMatrix::Row::applyAnd(const Row& r) const;
+ * Perform the intersection of the current row with r.
+ * @param r		Row to intersect with.
+ * @return		True if the current row has changed, false else.
+ */
+
+
+/**
+ * @fn bool BitMatrix::Row::applyReset(const Row& r) const;
+ * Remove from the current row the bits set in r.
+ * @param r		Row to remove.
+ * @return		True if the current row has changed, false else.
+ */
+
+
+/**
+ * Copy the given row in the current row.
+ * @param r		Row to copy.
+ */
+void BitMatrix::Row::copy(const Row& r) const {
+	check(r);
+	memcpy(_w, r._w, wcount() * sizeof(word_t));
+}
+
+
+/**
+ * Set all bits of the row to 0.
+ */
+void BitMatrix::Row::clear(void) const {
+	memset(_w, 0, wcount() * sizeof(word_t));
+}
+
+
+/**
+ * Set all bits of the row to 1.
+ */
+void BitMatrix::Row::set(void) const {
+	memset(_w, 0xff, wcount() * sizeof(word_t));
+	if(_size & 63)
+		_w[wcount() - 1] = word_t(-1) >> (64 - (_size & 63));
+}
+
+
+/**
+ * @fn template <class F> void BitMatrix::Row::forEachOne(F f) const;
+ * Call f with the index of each bit to 1 of the row, in increasing order.
+ * @param f		Function to call.
+ */
+
+
+/**
+ * Build a bit vector with the same content as the row.
+ * @return	Built bit vector.
+ */
+BitVector BitMatrix::Row::toBitVector(void) const {
+	BitVector v(_size);
+	forEachOne([&](int i) { v.set(i); });
+	return v;
+}
+
+
+/**
+ * Print the row as @ref BitVector does.
+ * @param out	Output stream.
+ */
+void BitMatrix::Row::print(io::Output& out) const {
+	for(int i = _size - 1; i >= 0; i--) {
+		out << (bit(i) ? '1' : '0');
+		if(!(i & 0x7))
+			out << ' ';
+	}
+}
+
+
+/**
+ * Build a bit matrix.
+ * @param rows	Number of rows.
+ * @param cols	Number of columns (bits per row, may be 0 as rows).
+ * @param set	Initial value of the bits.
+ */
+BitMatrix::BitMatrix(int rows, int cols, bool set): _rows(rows), _cols(cols), _stride((cols + 63) >> 6) {
+	ASSERTP(rows >= 0 && cols >= 0, "bad matrix dimensions");
+	_bits = new word_t[t::size(_rows) * _stride];
+	if(set)
+		this->set();
+	else
+		clear();
+}
+
+
+/**
+ * Build a bit matrix by copy.
+ * @param m		Matrix to copy.
+ */
+BitMatrix::BitMatrix(const BitMatrix& m): _rows(m._rows), _cols(m._cols), _stride(m._stride) {
+	_bits = new word_t[t::size(_rows) * _stride];
+	memcpy(_bits, m._bits, t::size(_rows) * _stride * sizeof(word_t));
+}
+
+
+/**
+ * Assign a matrix, the current matrix takes the dimensions of m.
+ * @param m		Matrix to copy.
+ * @return		Current matrix.
+ */
+BitMatrix& BitMatrix::operator=(const BitMatrix& m) {
+	if(this == &m)
+		return *this;
+	if(t::size(_rows) * _stride != t::size(m._rows) * m._stride) {
+		delete [] _bits;
+		_bits = new word_t[t::size(m._rows) * m._stride];
+	}
+	_rows = m._rows;
+	_cols = m._cols;
+	_stride = m._stride;
+	memcpy(_bits, m._bits, t::size(_rows) * _stride * sizeof(word_t));
+	return *this;
+}
+
+
+/**
+ * @fn bool BitMatrix::orRow(int d, int s) const;
+ * Perform the union of row d with row s.
+ * @param d		Modified row.
+ * @param s		Joined row.
+ * @return		True if row d has changed, false else.
+ */
+
+
+/**
+ * @fn bool BitMatrix::andRow(int d, int s) const;
+ * Perform the intersection of row d with row s.
+ * @param d		Modified row.
+ * @param s		Intersected row.
+ * @return		True if row d has changed, false else.
+ */
+
+
+/**
+ * Set all bits of the matrix to 0.
+ */
+void BitMatrix::clear(void) {
+	memset(_bits, 0, t::size(_rows) * _stride * sizeof(word_t));
+}
+
+
+/**
+ * Set all bits of the matrix to 1.
+ */
+void BitMatrix::set(void) {
+	for(int i = 0; i < _rows; i++)
+		row(i).set();
+}
+
+
+/**
+ * Test if two matrices are equal.
+ * @param m		Matrix to compare with.
+ * @return		True if they have the same dimensions and bits, false else.
+ */
+bool BitMatrix::equals(const BitMatrix& m) const {
+	if(_rows != m._rows || _cols != m._cols)
+		return false;
+	t::size n = t::size(_rows) * _stride;
+	for(t::size i = 0; i < n; i += CHUNK)
+		if(!bitvector::equals(_bits + i, m._bits + i, chunk(n - i)))
+			return false;
+	return true;
+}
+
+
+/**
+ * Count the bits to 1 in the matrix.
+ * @return	Number of 1.
+ */
+int BitMatrix::countOnes(void) const {
+	t::size n = t::size(_rows) * _stride;
+	int c = 0;
+	for(t::size i = 0; i < n; i += CHUNK)
+		c += elm::countOnes(_bits + i, chunk(n - i));
+	return c;
+}
+
+
+/**
+ * Replace the matrix, seen as a relation, by its transitive closure
+ * using the Warshall algorithm: for each k, each row having bit k set is
+ * joined with row k. The joins work on whole rows so that the cost is
+ * O(n^3 / w) where w is the number of bits processed by a vector
+ * instruction. The matrix must be square.
+ */
+void BitMatrix::closure(void) {
+	ASSERTP(_rows == _cols, "closure requires a square matrix");
+	for(int k = 0; k < _rows; k++) {
+		Row rk = row(k);
+		int wk = k >> 6;
+		word_t bk = word_t(1) << (k & 63);
+		for(int i = 0; i < _rows; i++)
+			if(_bits[i * _stride + wk] & bk)
+				row(i).applyOr(rk);
+	}
+}
+
+
+/**
+ * Build the transposed matrix.
+ * @return	Transposed matrix.
+ */
+BitMatrix BitMatrix::transpose(void) const {
+	BitMatrix r(_cols, _rows);
+	for(int i = 0; i < _rows; i++)
+		row(i).forEachOne([&](int j) { r.set(j, i); });
+	return r;
+}
+
+
+/**
+ * Print the matrix, one row per line.
+ * @param out	Output stream.
+ */
+void BitMatrix::print(io::Output& out) const {
+	for(int i = 0; i < _rows; i++)
+		out << row(i) << io::endl;
+}
+
+}	// elm
@@ -24,15 +24,303 @@
 #include <elm/compare.h>
 #include <elm/array.h>
 #include <memory.h>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#	define ELM_BITVECTOR_X86
+#	include <immintrin.h>
+#	define ELM_AVX2		__attribute__((target("avx2")))
+#endif
 
 namespace elm {
 
+namespace bitvector {
+
+typedef t::uint64 word_t;
+
+// portable kernels (in-place kernels return true if d has changed)
+static bool orScalar(word_t *d, const word_t *s, int n)
+	{ word_t c = 0; for(int i = 0; i < n; i++) { c |= s[i] & ~d[i]; d[i] |= s[i]; } return c != 0; }
+static bool andScalar(word_t *d, const word_t *s, int n)
+	{ word_t c = 0; for(int i = 0; i < n; i++) { c |= d[i] & ~s[i]; d[i] &= s[i]; } return c != 0; }
+static bool resetScalar(word_t *d, const word_t *s, int n)
+	{ word_t c = 0; for(int i = 0; i < n; i++) { c |= d[i] & s[i]; d[i] &= ~s[i]; } return c != 0; }
+static bool includesScalar(const word_t *a, const word_t *b, int n)
+	{ for(int i = 0; i < n; i++) if(~a[i] & b[i]) return false; return true; }
+static bool equalsScalar(const word_t *a, const word_t *b, int n)
+	{ for(int i = 0; i < n; i++) if(a[i] != b[i]) return false; return true; }
+static bool meetsScalar(const word_t *a, const word_t *b, int n)
+	{ for(int i = 0; i < n; i++) if(a[i] & b[i]) return true; return false; }
+static bool emptyScalar(const word_t *a, int n)
+	{ for(int i = 0; i < n; i++) if(a[i]) return false; return true; }
+
+#ifdef __SSE2__
+// SSE2 kernels (always available on x86-64)
+static inline __m128i load(const word_t *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+static inline void store(word_t *p, __m128i v) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v); }
+static inline bool isZero(__m128i v) { return _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128())) == 0xffff; }
+
+static bool orSSE2(word_t *d, const word_t *s, int n) {
+	__m128i c = _mm_setzero_si128();
+	int i = 0;
+	for(; i + 2 <= n; i += 2) {
+		__m128i x = load(d + i), y = load(s + i);
+		c = _mm_or_si128(c, _mm_andnot_si128(x, y));
+		store(d + i, _mm_or_si128(x, y));
+	}
+	return orScalar(d + i, s + i, n - i) || !isZero(c);
+}
+
+static bool andSSE2(word_t *d, const word_t *s, int n) {
+	__m128i c = _mm_setzero_si128();
+	int i = 0;
+	for(; i + 2 <= n; i += 2) {
+		__m128i x = load(d + i), y = load(s + i);
+		c = _mm_or_si128(c, _mm_andnot_si128(y, x));
+		store(d + i, _mm_and_si128(x, y));
+	}
+	return andScalar(d + i, s + i, n - i) || !isZero(c);
+}
+
+static bool resetSSE2(word_t *d, const word_t *s, int n) {
+	__m128i c = _mm_setzero_si128();
+	int i = 0;
+	for(; i + 2 <= n; i += 2) {
+		__m128i x = load(d + i), y = load(s + i);
+		c = _mm_or_si128(c, _mm_and_si128(x, y));
+		store(d + i, _mm_andnot_si128(y, x));
+	}
+	return resetScalar(d + i, s + i, n - i) || !isZero(c);
+}
+
+static bool includesSSE2(const word_t *a, const word_t *b, int n) {
+	int i = 0;
+	for(; i + 2 <= n; i += 2)
+		if(!isZero(_mm_andnot_si128(load(a + i), load(b + i))))
+			return false;
+	return includesScalar(a + i, b + i, n - i);
+}
+
+static bool equalsSSE2(const word_t *a, const word_t *b, int n) {
+	int i = 0;
+	for(; i + 2 <= n; i += 2)
+		if(!isZero(_mm_xor_si128(load(a + i), load(b + i))))
+			return false;
+	return equalsScalar(a + i, b + i, n - i);
+}
+
+static bool meetsSSE2(const word_t *a, const word_t *b, int n) {
+	int i = 0;
+	for(; i + 2 <= n; i += 2)
+		if(!isZero(_mm_and_si128(load(a + i), load(b + i))))
+			return true;
+	return meetsScalar(a + i, b + i, n - i);
+}
+
+static bool emptySSE2(const word_t *a, int n) {
+	int i = 0;
+	for(; i + 2 <= n; i += 2)
+		if(!isZero(load(a + i)))
+			return false;
+	return emptyScalar(a + i, n - i);
+}
+#endif
+
+#ifdef ELM_BITVECTOR_X86
+// AVX2 kernels (selected at run-time)
+static inline ELM_AVX2 __m256i load4(const word_t *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+static inline ELM_AVX2 void store4(word_t *p, __m256i v) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+
+static ELM_AVX2 bool orAVX2(word_t *d, const word_t *s, int n) {
+	__m256i c = _mm256_setzero_si256();
+	int i = 0;
+	for(; i + 4 <= n; i += 4) {
+		__m256i x = load4(d + i), y = load4(s + i);
+		c = _mm256_or_si256(c, _mm256_andnot_si256(x, y));
+		store4(d + i, _mm256_or_si256(x, y));
+	}
+	return orScalar(d + i, s + i, n - i) || !_mm256_testz_si256(c, c);
+}
+
+static ELM_AVX2 bool andAVX2(word_t *d, const word_t *s, int n) {
+	__m256i c = _mm256_setzero_si256();
+	int i = 0;
+	for(; i + 4 <= n; i += 4) {
+		__m256i x = load4(d + i), y = load4(s + i);
+		c = _mm256_or_si256(c, _mm256_andnot_si256(y, x));
+		store4(d + i, _mm256_and_si256(x, y));
+	}
+	return andScalar(d + i, s + i, n - i) || !_mm256_testz_si256(c, c);
+}
+
+static ELM_AVX2 bool resetAVX2(word_t *d, const word_t *s, int n) {
+	__m256i c = _mm256_setzero_si256();
+	int i = 0;
+	for(; i + 4 <= n; i += 4) {
+		__m256i x = load4(d + i), y = load4(s + i);
+		c = _mm256_or_si256(c, _mm256_and_si256(x, y));
+		store4(d + i, _mm256_andnot_si256(y, x));
+	}
+	return resetScalar(d + i, s + i, n - i) || !_mm256_testz_si256(c, c);
+}
+
+static ELM_AVX2 bool includesAVX2(const word_t *a, const word_t *b, int n) {
+	int i = 0;
+	for(; i + 4 <= n; i += 4)
+		if(!_mm256_testc_si256(load4(a + i), load4(b + i)))
+			return false;
+	return includesScalar(a + i, b + i, n - i);
+}
+
+static ELM_AVX2 bool equalsAVX2(const word_t *a, const word_t *b, int n) {
+	int i = 0;
+	for(; i + 4 <= n; i += 4) {
+		__m256i x = _mm256_xor_si256(load4(a + i), load4(b + i));
+		if(!_mm256_testz_si256(x, x))
+			return false;
+	}
+	return equalsScalar(a + i, b + i, n - i);
+}
+
+static ELM_AVX2 bool meetsAVX2(const word_t *a, const word_t *b, int n) {
+	int i = 0;
+	for(; i + 4 <= n; i += 4)
+		if(!_mm256_testz_si256(load4(a + i), load4(b + i)))
+			return true;
+	return meetsScalar(a + i, b + i, n - i);
+}
+
+static ELM_AVX2 bool emptyAVX2(const word_t *a, int n) {
+	int i = 0;
+	for(; i + 4 <= n; i += 4) {
+		__m256i x = load4(a + i);
+		if(!_mm256_testz_si256(x, x))
+			return false;
+	}
+	return emptyScalar(a + i, n - i);
+}
+#endif
+
+// kernel table
+struct kernels_t {
+	bool (*bor)(word_t *d, const word_t *s, int n);
+	bool (*band)(word_t *d, const word_t *s, int n);
+	bool (*breset)(word_t *d, const word_t *s, int n);
+	bool (*includes)(const word_t *a, const word_t *b, int n);
+	bool (*equals)(const word_t *a, const word_t *b, int n);
+	bool (*meets)(const word_t *a, const word_t *b, int n);
+	bool (*empty)(const word_t *a, int n);
+};
+
+static kernels_t selectKernels(void) {
+	kernels_t k = {
+		orScalar, andScalar, resetScalar,
+		includesScalar, equalsScalar, meetsScalar,
+		emptyScalar
+	};
+#	ifdef __SSE2__
+		k.bor = orSSE2;
+		k.band = andSSE2;
+		k.breset = resetSSE2;
+		k.includes = includesSSE2;
+		k.equals = equalsSSE2;
+		k.meets = meetsSSE2;
+		k.empty = emptySSE2;
+#	endif
+#	ifdef ELM_BITVECTOR_X86
+		__builtin_cpu_init();
+		if(__builtin_cpu_supports("avx2")) {
+			k.bor = orAVX2;
+			k.band = andAVX2;
+			k.breset = resetAVX2;
+			k.includes = includesAVX2;
+			k.equals = equalsAVX2;
+			k.meets = meetsAVX2;
+			k.empty = emptyAVX2;
+		}
+#	endif
+	return k;
+}
+
+static inline const kernels_t& kernels(void) {
+	static const kernels_t k = selectKernels();
+	return k;
+}
+
+/**
+ * Perform d = d | s on arrays of n words with the best available
+ * kernel.
+ * @param d		Destination words.
+ * @param s		Source words.
+ * @param n		Count of words.
+ * @return		True if d has changed, false else.
+ * @ingroup utility
+ */
+bool applyOr(t::uint64 *d, const t::uint64 *s, int n) {
+	return kernels().bor(d, s, n);
+}
+
+/**
+ * Perform d = d & s on arrays of n words with the best available
+ * kernel.
+ * @param d		Destination words.
+ * @param s		Source words.
+ * @param n		Count of words.
+ * @return		True if d has changed, false else.
+ * @ingroup utility
+ */
+bool applyAnd(t::uint64 *d, const t::uint64 *s, int n) {
+	return kernels().band(d, s, n);
+}
+
+/**
+ * Perform d = d & ~s on arrays of n words with the best available
+ * kernel.
+ * @param d		Destination words.
+ * @param s		Source words.
+ * @param n		Count of words.
+ * @return		True if d has changed, false else.
+ * @ingroup utility
+ */
+bool applyReset(t::uint64 *d, const t::uint64 *s, int n) {
+	return kernels().breset(d, s, n);
+}
+
+/**
+ * Test if the arrays a and b of n words are equal.
+ * @param a		First words.
+ * @param b		Second words.
+ * @param n		Count of words.
+ * @return		True if they are equal, false else.
+ * @ingroup utility
+ */
+bool equals(const t::uint64 *a, const t::uint64 *b, int n) {
+	return kernels().equals(a, b, n);
+}
+
+/**
+ * Test if the array a of n words contains only zeroes.
+ * @param a		Words to test.
+ * @param n		Count of words.
+ * @return		True if all words are null, false else.
+ * @ingroup utility
+ */
+bool isEmpty(const t::uint64 *a, int n) {
+	return kernels().empty(a, n);
+}
+
+}	// bitvector
+
 /**
  * @class BitVector
  * <p>This class provides facilities for managing vector of bits in an optimized
  * way.</p>
  * <p>Notice that vector is represented as a contiguous block of memory. This
  * bit vector representation is clearly not performant for sparse vectors.</p>
+ * <p>The bits are stored in 64-bit words and the bits after the size
+ * in the last word are always kept to 0. The bulk operations (OR, AND, RESET,
+ * inclusion, equality, meeting, emptiness and counting of ones) are
+ * performed by kernels selected at the first use according to the
+ * running processor: AVX2 and POPCNT instructions if available, SSE2 on
+ * x86-64 and portable 64-bit code else.</p>
  * @ingroup utility
  */
 
@@ -48,6 +336,8 @@ BitVector::BitVector(int size, bool set): _size(size) {
 	bits = new word_t[wcount()];
 	ASSERT(bits);
 	memset(bits, set ? 0xff : 0, wcount() * sizeof(word_t));
+	if(set)
+		mask();
 }
 
 
@@ -71,14 +361,10 @@ BitVector::BitVector(const BitVector& vec): _size(vec.size()) {
 BitVector::BitVector(const BitVector& vec, int new_size): _size(new_size) {
 	ASSERTP(new_size > 0, "size must be positive");
 	bits = new word_t[wcount()];
-	if(new_size >= vec._size) {
-		memcpy(bits, vec.bits, vec._size);
-		memset(bits + vec.wcount(), 0, wcount() - vec.wcount());
-	}
-	else {
-		memcpy(bits, vec.bits, wcount());
-		mask();
-	}
+	int n = min(wcount(), vec.wcount());
+	memcpy(bits, vec.bits, n * sizeof(word_t));
+	memset(bits + n, 0, (wcount() - n) * sizeof(word_t));
+	mask();
 }
 
 
@@ -86,19 +372,16 @@ BitVector::BitVector(const BitVector& vec, int new_size): _size(new_size) {
  * Same as copy().
  */
 BitVector& BitVector::operator=(const BitVector& vec) {
-	if(wcount() && wcount() == vec.wcount())
-		copy(vec);
-	else {
+	if(this == &vec)
+		return *this;
+	if(wcount() != vec.wcount()) {
 		if(bits)
-			delete bits;
-		if(!vec.bits)
-			bits = 0;
-		else {
-			_size = vec._size;
-			bits = new word_t[wcount()];
-			copy(vec);
-		}
+			delete [] bits;
+		bits = vec.bits ? new word_t[vec.wcount()] : nullptr;
 	}
+	_size = vec._size;
+	if(bits)
+		memcpy(bits, vec.bits, wcount() * sizeof(word_t));
 	return *this;
 }
 
@@ -120,10 +403,12 @@ BitVector& BitVector::operator=(const BitVector& vec) {
 
 
 /**
- * @fn bool BitVector::isEmpty(void) const;
  * Test if the vector is empty.
  * @return	True if no bit is set, false else.
  */
+bool BitVector::isEmpty(void) const {
+	return bitvector::kernels().empty(bits, wcount());
+}
 
 
 /**
@@ -133,11 +418,7 @@ BitVector& BitVector::operator=(const BitVector& vec) {
  */
 bool BitVector::includes(const BitVector& vec) const {
 	ASSERTP(_size == vec._size, "bit vector must have the same size");
-	mask();
-	for(int i = 0; i < wcount(); i++)
-		if(~bits[i] & vec.bits[i])
-			return false;
-	return true;
+	return bitvector::kernels().includes(bits, vec.bits, wcount());
 }
 
 
@@ -147,16 +428,7 @@ bool BitVector::includes(const BitVector& vec) const {
  * @return		True if the strict inclusion holds, false else.
  */
 bool BitVector::includesStrictly(const BitVector &vec) const {
-	ASSERTP(_size == vec._size, "bit vector must have the same size");
-	mask();
-	bool equal = true;
-	for(int i = 0; i < wcount(); i++) {
-		if(~bits[i] & vec.bits[i])
-			return false;
-		if(bits[i] != vec.bits[i])
-			equal = false;
-	}
-	return !equal;
+	return includes(vec) && !equals(vec);
 }
 
 
@@ -167,11 +439,7 @@ bool BitVector::includesStrictly(const BitVector &vec) const {
  */
 bool BitVector::equals(const BitVector& vec) const {
 	ASSERTP(_size == vec._size, "bit vector must have the same size");
-	mask();
-	for(int i = 0; i < wcount(); i++)
-		if(bits[i] != vec.bits[i])
-			return false;
-	return true;
+	return bitvector::kernels().equals(bits, vec.bits, wcount());
 }
 
 
@@ -229,45 +497,45 @@ void BitVector::clear(void) {
 void BitVector::applyNot(void) {
 	for(int i = 0; i < wcount(); i++)
 		bits[i] = ~bits[i];
+	mask();
 }
 
 
 
 /**
- * @fn void BitVector::applyOr(const BitVector& vec);
+ * @fn bool BitVector::applyOr(const BitVector& vec);
  * Apply the OR-operation on this vector with given one.
  * @param vec	Vector to process with.
+ * @return		True if the current vector has changed, false else.
  */
-void BitVector::applyOr(const BitVector& vec) {
+bool BitVector::applyOr(const BitVector& vec) {
 	ASSERTP(_size == vec._size, "bit vectors must have the same size");
-	for(int i = 0; i < wcount(); i++)
-		bits[i] |= vec.bits[i];
+	return bitvector::kernels().bor(bits, vec.bits, wcount());
 }
 
 
 /**
- * @fn void BitVector::applyAnd(const BitVector& vec);
+ * @fn bool BitVector::applyAnd(const BitVector& vec);
  * Apply the AND-operation on this vector with given one.
  * @param vec	Vector to process with.
+ * @return		True if the current vector has changed, false else.
  */
-void BitVector::applyAnd(const BitVector& vec) {
+bool BitVector::applyAnd(const BitVector& vec) {
 	ASSERTP(_size == vec._size, "bit vectors must have the same size");
-	for(int i = 0; i < wcount(); i++)
-		bits[i] &= vec.bits[i];
+	return bitvector::kernels().band(bits, vec.bits, wcount());
 }
 
 
  
 /**
- * @fn void BitVector::applyReset(const BitVector& vec);
+ * @fn bool BitVector::applyReset(const BitVector& vec);
  * Apply the RESET-operation (current & ~vec) on this vector with given one.
  * @param vec	Vector to process with.
+ * @return		True if the current vector has changed, false else.
  */
-void BitVector::applyReset(const BitVector& vec) {
+bool BitVector::applyReset(const BitVector& vec) {
 	ASSERTP(_size == vec._size, "bit vectors must have the same size");
-	for(int i = 0; i < wcount(); i++)
-		bits[i] &= ~vec.bits[i];
-	mask();
+	return bitvector::kernels().breset(bits, vec.bits, wcount());
 }
 
 
@@ -280,6 +548,7 @@ BitVector BitVector::makeNot(void) const {
 	BitVector vec(_size);
 	for(int i = 0; i < wcount(); i++)
 		vec.bits[i] = ~ bits[i];
+	vec.mask();
 	return vec;
 }
 
@@ -291,9 +560,8 @@ BitVector BitVector::makeNot(void) const {
  */
 BitVector BitVector::makeOr(const BitVector& vec) const {
 	ASSERTP(_size == vec._size, "bit vectors must have the same size");
-	BitVector res(_size);
-	for(int i = 0; i < wcount(); i++)
-		res.bits[i] = bits[i] | vec.bits[i];
+	BitVector res(*this);
+	res.applyOr(vec);
 	return res;
 }
 
@@ -306,9 +574,8 @@ BitVector BitVector::makeOr(const BitVector& vec) const {
 
 BitVector BitVector::makeAnd(const BitVector& vec) const {
 	ASSERTP(_size == vec._size, "bit vectors must have the same size");
-	BitVector res(_size);
-	for(int i = 0; i < wcount(); i++)
-		res.bits[i] = bits[i] & vec.bits[i];
+	BitVector res(*this);
+	res.applyAnd(vec);
 	return res;
 }
 
@@ -321,9 +588,8 @@ BitVector BitVector::makeAnd(const BitVector& vec) const {
  */
 BitVector BitVector::makeReset(const BitVector& vec) const {
 	ASSERTP(_size == vec._size, "bit vectors must have the same size");
-	BitVector res(_size);
-	for(int i = 0; i < wcount(); i++)
-		res.bits[i] = bits[i] & ~vec.bits[i];
+	BitVector res(*this);
+	res.applyReset(vec);
 	return res;
 }
 
@@ -447,10 +713,7 @@ void BitVector::print(io::Output& out) const {
  * Count the number of bits whose value is 1.
  */
 int BitVector::countBits(void) const {
-	int result = 0;
-	for(int i = 0; i < wcount(); i++)
-		result += elm::ones(bits[i]);
-	return result;
+	return countOnes();
 }
 
 
@@ -459,22 +722,68 @@ int BitVector::countBits(void) const {
  * @param bv	Bit vector to compare with.
  * @return		True if there is something common, false else.
  */
-bool BitVector::meets(const BitVector& bv) {
-	int s = min(wcount(), bv.wcount());
-	for(int i = 0; i < s; i++)
-		if(bits[i] & bv.bits[i])
-			return true;
-	return false;
+bool BitVector::meets(const BitVector& bv) const {
+	return bitvector::kernels().meets(bits, bv.bits, min(wcount(), bv.wcount()));
+}
+
+
+/**
+ * @fn int BitVector::findFirst(void) const;
+ * Find the first bit to one.
+ * @return	Index of the first bit to one, -1 if the vector is empty.
+ */
+
+
+/**
+ * @fn int BitVector::findNext(int i) const;
+ * Find the first bit to one after the given index. Passing -1 is the same
+ * as findFirst() and a loop on ones can be written as:
+ * @code
+ * for(int i = v.findFirst(); i >= 0; i = v.findNext(i))
+ *	...
+ * @endcode
+ * @param i	Index to look after.
+ * @return	Index of the next bit to one, -1 if there is no more one.
+ */
+
+
+/**
+ * Find the last bit to one.
+ * @return	Index of the last bit to one, -1 if the vector is empty.
+ */
+int BitVector::findLast(void) const {
+	for(int wi = wcount() - 1; wi >= 0; wi--)
+		if(bits[wi])
+			return (wi << wshift()) + msb(bits[wi]);
+	return -1;
 }
 
 
+/**
+ * @fn void BitVector::forEachOne(F f) const;
+ * Call the given function with the index of each bit to one, in increasing
+ * order. It is the fastest way to visit the ones of a vector as no iterator
+ * state has to be kept between calls.
+ * @param f	Function to call, taking the bit index as an int.
+ */
+
+
 
 /**
- * @class Iterator::OneIterator
+ * @class BitVector::OneIterator
  * This class represents an iterator on the bits containing a one in a bit
  * vector. As a value, it returns the bit vector positions containing a 1.
- * @note May be fully improved by benefiting from the test a full byte
- * for presence of at least a one inside.
+ * The words containing only zeroes are skipped and the next one is found
+ * with a count-trailing-zero instruction: the cost is proportional to
+ * the number of words plus the number of ones.
+ */
+
+
+/**
+ * @class BitVector::ZeroIterator
+ * This class represents an iterator on the bits containing a zero in a bit
+ * vector. As a value, it returns the bit vector positions containing a 0.
+ * As OneIterator, it skips the words full of ones.
  */
 
 
@@ -491,10 +800,7 @@ bool BitVector::meets(const BitVector& bv) {
  * @return	Number of ones.
  */
 int BitVector::countOnes(void) const {
-	int cnt = 0;
-	for(int i = 0; i < wcount(); i++)
-		cnt += ones(bits[i]);
-	return cnt;
+	return elm::countOnes(bits, wcount());
 }
 
 
@@ -513,13 +819,17 @@ void BitVector::resize(int new_size) {
 	int new_wcount = inWords(new_size);
 	if(wcount() != new_wcount) {
 		word_t *new_bits = new word_t[new_wcount];
+		int n = min(wcount(), new_wcount);
 		if(bits != nullptr) {
-			array::copy(new_bits, bits,min(wcount(),new_wcount) );
+			array::copy(new_bits, bits, n);
 			delete [] bits;
 		}
+		memset(new_bits + n, 0, (new_wcount - n) * sizeof(word_t));
 		bits = new_bits;
 	}
 	_size = new_size;
+	if(bits != nullptr)
+		mask();
 }
 
 
@@ -113,6 +113,18 @@ t::hash hash_jenkins(const void *block, int size) {
  */
 
 
+/**
+ * @fn t::uint64 hash_mix(t::hash h);
+ * Spread the bits of the given hash value so that its lower bits depend
+ * on all bits of the input (finalization step of MurmurHash3). This is
+ * used by hash tables whose size is a power of two as their index is
+ * obtained by masking the lower bits of the hash.
+ * @param h		Hash value to mix.
+ * @return		Mixed hash value.
+ * @ingroup utility
+ */
+
+
 /**
  * Use a classical compiler string hashing algorithm (see "The Compilers"
  * by Aho, Sethi, Ullman).
@@ -81,6 +81,13 @@ namespace elm {
  */
 
 
+/**
+ * @fn Pair::Pair(Pair<T1, T2>&& pair);
+ * Build a pair by moving the content of another pair.
+ * @param pair	Pair to move from.
+ */
+
+
 /**
  * @fn Pair<T1, T2>& Pair::operator=(const Pair<T1, T2>& pair);
  * Assignment overload for pairs.
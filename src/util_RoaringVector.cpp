@@ -0,0 +1,1131 @@
+/*
+ *	RoaringVector class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ * 
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software 
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/util/RoaringVector.h>
+#include <elm/assert.h>
+#include <elm/compare.h>
+#include <string.h>
+
+namespace elm {
+
+namespace roaring {
+
+const int SPAN = 1 << 16;		// count of bits in a container
+
+// look for v in the sorted array a[0..n), return its index or -(insertion point) - 1
+static int search(const t::uint16 *a, int n, int v) {
+	int l = 0, h = n - 1;
+	while(l <= h) {
+		int m = (l + h) >> 1;
+		if(a[m] < v)
+			l = m + 1;
+		else if(a[m] > v)
+			h = m - 1;
+		else
+			return m;
+	}
+	return -l - 1;
+}
+
+// runs are stored as pairs (start, length - 1)
+static inline int runStart(const Container& c, int i) { return c.runs()[2 * i]; }
+static inline int runEnd(const Container& c, int i) { return c.runs()[2 * i] + c.runs()[2 * i + 1]; }
+
+// index of the last run starting at or before v, -1 if none
+static int searchRun(const Container& c, int v) {
+	int l = 0, h = c.cnt - 1;
+	while(l <= h) {
+		int m = (l + h) >> 1;
+		if(runStart(c, m) <= v)
+			l = m + 1;
+		else
+			h = m - 1;
+	}
+	return h;
+}
+
+bool Container::contains(t::uint16 v) const {
+	switch(kind) {
+	case ARRAY:
+		return search(values(), cnt, v) >= 0;
+	case BITMAP:
+		return (mem[v >> 6] >> (v & 63)) & 1;
+	case RUN: {
+			int i = searchRun(*this, v);
+			return i >= 0 && v <= runEnd(*this, i);
+		}
+	}
+	return false;
+}
+
+// memory management
+static inline int memWords(int kind, int cap) {
+	switch(kind) {
+	case ARRAY:		return (cap + 3) >> 2;
+	case BITMAP:	return WORDS;
+	default:		return (cap + 1) >> 1;
+	}
+}
+
+static inline int usedBytes(const Container& c) {
+	switch(c.kind) {
+	case ARRAY:		return c.cnt * 2;
+	case BITMAP:	return WORDS * 8;
+	default:		return c.cnt * 4;
+	}
+}
+
+static void alloc(Container& c, int kind, int cap) {
+	c.kind = kind;
+	c.cap = cap;
+	c.cnt = 0;
+	c.mem = new t::uint64[memWords(kind, cap)];
+}
+
+static inline void release(Container& c) {
+	delete [] c.mem;
+	c.mem = nullptr;
+}
+
+static void clone(Container& d, const Container& s) {
+	d = s;
+	if(s.kind != BITMAP)
+		d.cap = s.cnt;
+	d.mem = new t::uint64[memWords(d.kind, d.cap)];
+	memcpy(d.mem, s.mem, usedBytes(s));
+}
+
+static void reserve(Container& c, int n) {
+	if(n <= c.cap)
+		return;
+	t::uint64 *old = c.mem;
+	c.cap = max(n, 2 * c.cap);
+	c.mem = new t::uint64[memWords(c.kind, c.cap)];
+	memcpy(c.mem, old, usedBytes(c));
+	delete [] old;
+}
+
+// bitmap helpers
+static void setRange(t::uint64 *w, int s, int e) {
+	int ws = s >> 6, we = e >> 6;
+	t::uint64 ms = ~t::uint64(0) << (s & 63), me = ~t::uint64(0) >> (63 - (e & 63));
+	if(ws == we)
+		w[ws] |= ms & me;
+	else {
+		w[ws] |= ms;
+		for(int i = ws + 1; i < we; i++)
+			w[i] = ~t::uint64(0);
+		w[we] |= me;
+	}
+}
+
+// first position at or after i whose bit is one (or zero), SPAN if none
+static int scan(const t::uint64 *w, int i, bool one) {
+	int wi = i >> 6;
+	if(wi >= WORDS)
+		return SPAN;
+	t::uint64 x = (one ? w[wi] : ~w[wi]) & (~t::uint64(0) << (i & 63));
+	while(!x) {
+		if(++wi >= WORDS)
+			return SPAN;
+		x = one ? w[wi] : ~w[wi];
+	}
+	return (wi << 6) + lsb(x);
+}
+
+static void toBitmap(const Container& c, t::uint64 *w) {
+	if(c.kind == BITMAP) {
+		memcpy(w, c.mem, WORDS * 8);
+		return;
+	}
+	memset(w, 0, WORDS * 8);
+	if(c.kind == ARRAY)
+		for(int i = 0; i < c.cnt; i++)
+			w[c.values()[i] >> 6] |= t::uint64(1) << (c.values()[i] & 63);
+	else
+		for(int i = 0; i < c.cnt; i++)
+			setRange(w, runStart(c, i), runEnd(c, i));
+}
+
+// build c (whose memory is not allocated) from the bitmap w in the most compact form
+static void fromBitmap(Container& c, const t::uint64 *w) {
+	t::uint64 starts[WORDS];
+	starts[0] = w[0] & ~(w[0] << 1);
+	for(int i = 1; i < WORDS; i++)
+		starts[i] = w[i] & ~((w[i] << 1) | (w[i - 1] >> 63));
+	int card = countOnes(w, WORDS), runs = countOnes(starts, WORDS);
+	c.card = card;
+	if(card == 0) {
+		c.kind = ARRAY;
+		c.cnt = c.cap = 0;
+		c.mem = nullptr;
+	}
+	else if(4 * runs < min(2 * card, WORDS * 8)) {
+		alloc(c, RUN, runs);
+		t::uint16 *r = c.runs();
+		for(int i = scan(w, 0, true); i < SPAN; i = scan(w, i, true)) {
+			int e = scan(w, i, false);
+			r[2 * c.cnt] = i;
+			r[2 * c.cnt + 1] = e - 1 - i;
+			c.cnt++;
+			i = e;
+		}
+	}
+	else if(card <= ARRAY_MAX) {
+		alloc(c, ARRAY, card);
+		t::uint16 *v = c.values();
+		for(int i = 0; i < WORDS; i++)
+			for(t::uint64 x = w[i]; x; x &= x - 1)
+				v[c.cnt++] = (i << 6) | lsb(x);
+	}
+	else {
+		alloc(c, BITMAP, 0);
+		memcpy(c.mem, w, WORDS * 8);
+	}
+}
+
+// convert c to its most compact representation
+static void compact(Container& c) {
+	t::uint64 w[WORDS];
+	toBitmap(c, w);
+	Container n;
+	n.key = c.key;
+	fromBitmap(n, w);
+	release(c);
+	c = n;
+}
+
+// count the runs of consecutive values in the sorted array v[0..n)
+static int countRuns(const t::uint16 *v, int n) {
+	int runs = 1;
+	for(int i = 1; i < n; i++)
+		if(v[i] != v[i - 1] + 1)
+			runs++;
+	return runs;
+}
+
+// build c (whose memory is not allocated) from the sorted values v[0..n)
+static void fromArray(Container& c, const t::uint16 *v, int n) {
+	if(n > ARRAY_MAX) {
+		t::uint64 w[WORDS];
+		memset(w, 0, sizeof(w));
+		for(int i = 0; i < n; i++)
+			w[v[i] >> 6] |= t::uint64(1) << (v[i] & 63);
+		fromBitmap(c, w);
+		return;
+	}
+	c.card = n;
+	if(n == 0) {
+		c.kind = ARRAY;
+		c.cnt = c.cap = 0;
+		c.mem = nullptr;
+		return;
+	}
+	int runs = countRuns(v, n);
+	if(4 * runs < 2 * n) {
+		alloc(c, RUN, runs);
+		t::uint16 *r = c.runs();
+		int s = 0;
+		for(int i = 1; i <= n; i++)
+			if(i == n || v[i] != v[i - 1] + 1) {
+				r[2 * c.cnt] = v[s];
+				r[2 * c.cnt + 1] = v[i - 1] - v[s];
+				c.cnt++;
+				s = i;
+			}
+	}
+	else {
+		alloc(c, ARRAY, n);
+		memcpy(c.values(), v, n * 2);
+		c.cnt = n;
+	}
+}
+
+// add a value, return true if it was not already in
+static bool add(Container& c, t::uint16 v) {
+	switch(c.kind) {
+
+	case ARRAY: {
+			int i = search(c.values(), c.cnt, v);
+			if(i >= 0)
+				return false;
+			i = -i - 1;
+			if(c.cnt >= ARRAY_MAX) {
+				t::uint64 w[WORDS];
+				toBitmap(c, w);
+				w[v >> 6] |= t::uint64(1) << (v & 63);
+				Container n;
+				n.key = c.key;
+				fromBitmap(n, w);
+				release(c);
+				c = n;
+				return true;
+			}
+			else {
+				if(c.cnt == c.cap && c.cnt >= 16 && 4 * countRuns(c.values(), c.cnt) < 2 * c.cnt) {
+					compact(c);
+					return add(c, v);
+				}
+				reserve(c, c.cnt + 1);
+				t::uint16 *a = c.values();
+				memmove(a + i + 1, a + i, (c.cnt - i) * 2);
+				a[i] = v;
+				c.cnt++;
+			}
+		}
+		break;
+
+	case BITMAP: {
+			t::uint64 b = t::uint64(1) << (v & 63);
+			if(c.mem[v >> 6] & b)
+				return false;
+			c.mem[v >> 6] |= b;
+		}
+		break;
+
+	case RUN: {
+			int i = searchRun(c, v);
+			if(i >= 0 && v <= runEnd(c, i))
+				return false;
+			bool left = i >= 0 && runEnd(c, i) + 1 == v;
+			bool right = i + 1 < c.cnt && runStart(c, i + 1) == v + 1;
+			t::uint16 *r = c.runs();
+			if(left && right) {
+				r[2 * i + 1] = runEnd(c, i + 1) - r[2 * i];
+				memmove(r + 2 * (i + 1), r + 2 * (i + 2), (c.cnt - i - 2) * 4);
+				c.cnt--;
+			}
+			else if(left)
+				r[2 * i + 1]++;
+			else if(right) {
+				r[2 * (i + 1)] = v;
+				r[2 * (i + 1) + 1]++;
+			}
+			else {
+				reserve(c, c.cnt + 1);
+				r = c.runs();
+				memmove(r + 2 * (i + 2), r + 2 * (i + 1), (c.cnt - i - 1) * 4);
+				r[2 * (i + 1)] = v;
+				r[2 * (i + 1) + 1] = 0;
+				c.cnt++;
+			}
+		}
+		break;
+	}
+	c.card++;
+	if(c.kind == RUN && c.cnt > 2 * WORDS)
+		compact(c);
+	return true;
+}
+
+// remove a value, return true if it was in
+static bool remove(Container& c, t::uint16 v) {
+	switch(c.kind) {
+
+	case ARRAY: {
+			int i = search(c.values(), c.cnt, v);
+			if(i < 0)
+				return false;
+			t::uint16 *a = c.values();
+			memmove(a + i, a + i + 1, (c.cnt - i - 1) * 2);
+			c.cnt--;
+			c.card--;
+		}
+		break;
+
+	case BITMAP: {
+			t::uint64 b = t::uint64(1) << (v & 63);
+			if(!(c.mem[v >> 6] & b))
+				return false;
+			c.mem[v >> 6] &= ~b;
+			c.card--;
+			if(c.card <= ARRAY_MAX / 2)
+				compact(c);
+		}
+		break;
+
+	case RUN: {
+			int i = searchRun(c, v);
+			if(i < 0 || v > runEnd(c, i))
+				return false;
+			int s = runStart(c, i), e = runEnd(c, i);
+			t::uint16 *r = c.runs();
+			if(s == e) {
+				memmove(r + 2 * i, r + 2 * (i + 1), (c.cnt - i - 1) * 4);
+				c.cnt--;
+			}
+			else if(v == s) {
+				r[2 * i] = v + 1;
+				r[2 * i + 1]--;
+			}
+			else if(v == e)
+				r[2 * i + 1]--;
+			else {
+				reserve(c, c.cnt + 1);
+				r = c.runs();
+				memmove(r + 2 * (i + 2), r + 2 * (i + 1), (c.cnt - i - 1) * 4);
+				r[2 * i + 1] = v - 1 - s;
+				r[2 * (i + 1)] = v + 1;
+				r[2 * (i + 1) + 1] = e - v - 1;
+				c.cnt++;
+			}
+			c.card--;
+			if(c.cnt > 2 * WORDS)
+				compact(c);
+		}
+		break;
+	}
+	return true;
+}
+
+// append the run [s, e] to the runs of v[0..2n), merging adjacent runs
+static inline void pushRun(t::uint16 *v, int& n, int s, int e) {
+	if(n != 0 && v[2 * n - 2] + v[2 * n - 1] + 1 >= s)
+		v[2 * n - 1] = max(v[2 * n - 2] + v[2 * n - 1], e) - v[2 * n - 2];
+	else {
+		v[2 * n] = s;
+		v[2 * n + 1] = e - s;
+		n++;
+	}
+}
+
+// combine two run containers into r using v (2 * (a.cnt + b.cnt) entries) as buffer
+static void combineRuns(Container& r, const Container& a, const Container& b, op_t op, t::uint16 *v) {
+	int n = 0, i = 0, j = 0;
+	switch(op) {
+	case OR:
+		while(i < a.cnt || j < b.cnt)
+			if(j >= b.cnt || (i < a.cnt && runStart(a, i) <= runStart(b, j))) {
+				pushRun(v, n, runStart(a, i), runEnd(a, i));
+				i++;
+			}
+			else {
+				pushRun(v, n, runStart(b, j), runEnd(b, j));
+				j++;
+			}
+		break;
+	case AND:
+		while(i < a.cnt && j < b.cnt) {
+			int s = max(runStart(a, i), runStart(b, j)), e = min(runEnd(a, i), runEnd(b, j));
+			if(s <= e)
+				pushRun(v, n, s, e);
+			if(runEnd(a, i) < runEnd(b, j))
+				i++;
+			else
+				j++;
+		}
+		break;
+	case RESET:
+		for(; i < a.cnt; i++) {
+			int s = runStart(a, i), e = runEnd(a, i);
+			while(j < b.cnt && runEnd(b, j) < s)
+				j++;
+			for(int k = j; s <= e && k < b.cnt && runStart(b, k) <= e; k++) {
+				if(runStart(b, k) > s)
+					pushRun(v, n, s, runStart(b, k) - 1);
+				s = max(s, runEnd(b, k) + 1);
+			}
+			if(s <= e)
+				pushRun(v, n, s, e);
+		}
+		break;
+	}
+
+	int card = 0;
+	for(int k = 0; k < n; k++)
+		card += v[2 * k + 1] + 1;
+	if(card == 0) {
+		r.kind = ARRAY;
+		r.card = r.cnt = r.cap = 0;
+		r.mem = nullptr;
+	}
+	else if(4 * n < min(2 * card, WORDS * 8)) {
+		alloc(r, RUN, n);
+		memcpy(r.mem, v, n * 4);
+		r.cnt = n;
+		r.card = card;
+	}
+	else {
+		t::uint64 w[WORDS];
+		memset(w, 0, sizeof(w));
+		for(int k = 0; k < n; k++)
+			setRange(w, v[2 * k], v[2 * k] + v[2 * k + 1]);
+		fromBitmap(r, w);
+	}
+}
+
+// compute r = a op b, r memory is not allocated
+static void combine(Container& r, const Container& a, const Container& b, op_t op) {
+	t::uint16 v[2 * ARRAY_MAX];
+	int n = 0;
+
+	// run with run: merge the runs
+	if(a.kind == RUN && b.kind == RUN && a.cnt + b.cnt <= ARRAY_MAX)
+		combineRuns(r, a, b, op, v);
+
+	// array with array: merge
+	else if(a.kind == ARRAY && b.kind == ARRAY) {
+		const t::uint16 *x = a.values(), *y = b.values();
+		int i = 0, j = 0;
+		while(i < a.cnt && j < b.cnt) {
+			if(x[i] < y[j]) {
+				if(op != AND)
+					v[n++] = x[i];
+				i++;
+			}
+			else if(y[j] < x[i]) {
+				if(op == OR)
+					v[n++] = y[j];
+				j++;
+			}
+			else {
+				if(op != RESET)
+					v[n++] = x[i];
+				i++;
+				j++;
+			}
+		}
+		if(op != AND)
+			while(i < a.cnt)
+				v[n++] = x[i++];
+		if(op == OR)
+			while(j < b.cnt)
+				v[n++] = y[j++];
+		fromArray(r, v, n);
+	}
+
+	// array filtered by any container
+	else if(a.kind == ARRAY && op != OR) {
+		for(int i = 0; i < a.cnt; i++)
+			if(b.contains(a.values()[i]) == (op == AND))
+				v[n++] = a.values()[i];
+		fromArray(r, v, n);
+	}
+	else if(b.kind == ARRAY && op == AND) {
+		for(int i = 0; i < b.cnt; i++)
+			if(a.contains(b.values()[i]))
+				v[n++] = b.values()[i];
+		fromArray(r, v, n);
+	}
+
+	// bitmap computation
+	else {
+		t::uint64 w[WORDS];
+		toBitmap(a, w);
+		if(b.kind == ARRAY) {
+			const t::uint16 *y = b.values();
+			if(op == OR)
+				for(int i = 0; i < b.cnt; i++)
+					w[y[i] >> 6] |= t::uint64(1) << (y[i] & 63);
+			else
+				for(int i = 0; i < b.cnt; i++)
+					w[y[i] >> 6] &= ~(t::uint64(1) << (y[i] & 63));
+		}
+		else {
+			t::uint64 xw[WORDS];
+			const t::uint64 *x = b.mem;
+			if(b.kind == RUN) {
+				toBitmap(b, xw);
+				x = xw;
+			}
+			switch(op) {
+			case AND:	for(int i = 0; i < WORDS; i++) w[i] &= x[i]; break;
+			case OR:	for(int i = 0; i < WORDS; i++) w[i] |= x[i]; break;
+			case RESET:	for(int i = 0; i < WORDS; i++) w[i] &= ~x[i]; break;
+			}
+		}
+		fromBitmap(r, w);
+	}
+}
+
+// test if two containers with the same key and cardinality are equal
+static bool same(const Container& a, const Container& b) {
+	if(a.kind == b.kind)
+		return a.cnt == b.cnt && memcmp(a.mem, b.mem, usedBytes(a)) == 0;
+	bool r = true;
+	a.forEach([&](int x) { if(!b.contains(x & 0xffff)) r = false; });
+	return r;
+}
+
+}	// roaring
+
+/**
+ * @class RoaringVector
+ * RoaringVector is a compressed bit vector (like @ref elm::WAHVector) based on
+ * the Roaring bitmaps described in:
+ *
+ * Chambi, S., Lemire, D., Kaser, O., & Godin, R. (2016). Better bitmap performance with
+ * Roaring bitmaps. Software: Practice and Experience, 46(5), 709-719.
+ *
+ * The bit indexes are split in 2^16 bit chunks and each chunk containing at least one 1
+ * is represented by a container, stored in a table sorted by chunk number. According to
+ * its content, a container is:
+ * @li an array of sorted 16-bit values for sparse chunks (up to 4096 ones),
+ * @li a bitmap of 2^16 bits for dense chunks,
+ * @li a sorted list of runs of ones for clustered chunks.
+ *
+ * The bulk operations choose the most compact representation for each result container.
+ * Unlike WAHVector, a bit is accessed in O(log n) (binary search of the container then
+ * of the value) and bulk operations work container by container with array merges or
+ * word-wide bitmap operations.
+ * @ingroup utility
+ */
+
+
+/**
+ * @fn RoaringVector::RoaringVector(void);
+ * Build an empty roaring vector of size 0.
+ */
+
+
+/**
+ * Build a roaring vector of the given size.
+ * @param size	Size in bits of the vector.
+ * @param init	Initial value of the bits.
+ */
+RoaringVector::RoaringVector(int size, bool init): _size(size), _cnt(0), _cap(0), _conts(nullptr) {
+	ASSERTP(size >= 0, "size must be positive");
+	if(init)
+		set();
+}
+
+
+/**
+ * Build a roaring vector by copying the given one.
+ * @param v	Vector to copy.
+ */
+RoaringVector::RoaringVector(const RoaringVector& v): _size(v._size), _cnt(0), _cap(0), _conts(nullptr) {
+	copy(v);
+}
+
+
+/**
+ */
+RoaringVector::~RoaringVector(void) {
+	release();
+}
+
+
+/**
+ * Free the containers.
+ */
+void RoaringVector::release(void) {
+	for(int i = 0; i < _cnt; i++)
+		roaring::release(_conts[i]);
+	delete [] _conts;
+	_conts = nullptr;
+	_cnt = 0;
+	_cap = 0;
+}
+
+
+/**
+ * Look for the container of the given key.
+ * @param key	Looked key.
+ * @return		Container index or -(insertion index) - 1.
+ */
+int RoaringVector::find(int key) const {
+	int l = 0, h = _cnt - 1;
+	while(l <= h) {
+		int m = (l + h) >> 1;
+		if(_conts[m].key < key)
+			l = m + 1;
+		else if(_conts[m].key > key)
+			h = m - 1;
+		else
+			return m;
+	}
+	return -l - 1;
+}
+
+
+/**
+ * Insert an empty container (without memory) at the given index.
+ * @param i		Insertion index.
+ * @param key	Key of the container.
+ * @return		Inserted container.
+ */
+roaring::Container& RoaringVector::insert(int i, int key) {
+	if(_cnt == _cap) {
+		_cap = max(4, 2 * _cap);
+		roaring::Container *cs = new roaring::Container[_cap];
+		if(_conts) {
+			memcpy(cs, _conts, _cnt * sizeof(roaring::Container));
+			delete [] _conts;
+		}
+		_conts = cs;
+	}
+	memmove(_conts + i + 1, _conts + i, (_cnt - i) * sizeof(roaring::Container));
+	_cnt++;
+	roaring::Container& c = _conts[i];
+	c.key = key;
+	c.kind = roaring::ARRAY;
+	c.card = c.cnt = c.cap = 0;
+	c.mem = nullptr;
+	return c;
+}
+
+
+/**
+ * Remove the container at the given index.
+ * @param i	Index of the container.
+ */
+void RoaringVector::erase(int i) {
+	roaring::release(_conts[i]);
+	memmove(_conts + i, _conts + i + 1, (_cnt - i - 1) * sizeof(roaring::Container));
+	_cnt--;
+}
+
+
+/**
+ * @fn int RoaringVector::size(void) const;
+ * Get the size of the vector.
+ * @return	Size in bits.
+ */
+
+
+/**
+ * Test the value of a bit.
+ * @param index	Index of the bit.
+ * @return		Bit value.
+ */
+bool RoaringVector::bit(int index) const {
+	ASSERTP(0 <= index && index < _size, "index out of bounds");
+	int i = find(index >> 16);
+	return i >= 0 && _conts[i].contains(index & 0xffff);
+}
+
+
+/**
+ * @fn bool RoaringVector::isEmpty(void) const;
+ * Test if all bits are 0.
+ * @return	True if the vector is empty, false else.
+ */
+
+
+/**
+ * @fn bool RoaringVector::isFull(void) const;
+ * Test if all bits are 1.
+ * @return	True if the vector is full, false else.
+ */
+
+
+/**
+ * Test if both vectors are equal.
+ * @param v	Vector to compare with.
+ * @return	True if they are equal, false else.
+ */
+bool RoaringVector::equals(const RoaringVector& v) const {
+	ASSERTP(_size == v._size, "vectors must have the same size");
+	if(_cnt != v._cnt)
+		return false;
+	for(int i = 0; i < _cnt; i++)
+		if(_conts[i].key != v._conts[i].key
+		|| _conts[i].card != v._conts[i].card
+		|| !roaring::same(_conts[i], v._conts[i]))
+			return false;
+	return true;
+}
+
+
+/**
+ * Test if the current vector includes the given one.
+ * @param v	Vector to test.
+ * @return	True if the current vector includes v, false else.
+ */
+bool RoaringVector::includes(const RoaringVector& v) const {
+	ASSERTP(_size == v._size, "vectors must have the same size");
+	for(int i = 0; i < v._cnt; i++) {
+		int j = find(v._conts[i].key);
+		if(j < 0 || v._conts[i].card > _conts[j].card)
+			return false;
+		roaring::Container r;
+		roaring::combine(r, v._conts[i], _conts[j], roaring::RESET);
+		bool empty = r.card == 0;
+		roaring::release(r);
+		if(!empty)
+			return false;
+	}
+	return true;
+}
+
+
+/**
+ * Test if the current vector includes strictly the given one.
+ * @param v	Vector to test.
+ * @return	True if the current vector includes strictly v, false else.
+ */
+bool RoaringVector::includesStrictly(const RoaringVector& v) const {
+	return includes(v) && countOnes() != v.countOnes();
+}
+
+
+/**
+ * Test if both vectors have a bit to 1 in common.
+ * @param v	Vector to test.
+ * @return	True if they have a common bit, false else.
+ */
+bool RoaringVector::meets(const RoaringVector& v) const {
+	ASSERTP(_size == v._size, "vectors must have the same size");
+	for(int i = 0, j = 0; i < _cnt && j < v._cnt; ) {
+		if(_conts[i].key < v._conts[j].key)
+			i++;
+		else if(v._conts[j].key < _conts[i].key)
+			j++;
+		else {
+			roaring::Container r;
+			roaring::combine(r, _conts[i], v._conts[j], roaring::AND);
+			bool empty = r.card == 0;
+			roaring::release(r);
+			if(!empty)
+				return true;
+			i++;
+			j++;
+		}
+	}
+	return false;
+}
+
+
+/**
+ * Count the bits to 1.
+ * @return	Count of 1.
+ */
+int RoaringVector::countOnes(void) const {
+	int c = 0;
+	for(int i = 0; i < _cnt; i++)
+		c += _conts[i].card;
+	return c;
+}
+
+
+/**
+ * @fn int RoaringVector::countBits(void) const;
+ * Same as countOnes().
+ */
+
+
+/**
+ * @fn int RoaringVector::countZeroes(void) const;
+ * Count the bits to 0.
+ * @return	Count of 0.
+ */
+
+
+/**
+ * @fn void RoaringVector::forEachOne(F f) const;
+ * Call the given function with the index of each bit to one, in increasing order.
+ * @param f	Function to call, taking the bit index as an int.
+ */
+
+
+/**
+ * Set a bit to 1.
+ * @param index	Index of the bit.
+ */
+void RoaringVector::set(int index) {
+	ASSERTP(0 <= index && index < _size, "index out of bounds");
+	int i = find(index >> 16);
+	if(i >= 0)
+		roaring::add(_conts[i], index & 0xffff);
+	else {
+		roaring::Container& c = insert(-i - 1, index >> 16);
+		roaring::alloc(c, roaring::ARRAY, 4);
+		c.values()[0] = index & 0xffff;
+		c.cnt = 1;
+		c.card = 1;
+	}
+}
+
+
+/**
+ * Set a bit to 0.
+ * @param index	Index of the bit.
+ */
+void RoaringVector::clear(int index) {
+	ASSERTP(0 <= index && index < _size, "index out of bounds");
+	int i = find(index >> 16);
+	if(i >= 0 && roaring::remove(_conts[i], index & 0xffff) && _conts[i].card == 0)
+		erase(i);
+}
+
+
+/**
+ * @fn void RoaringVector::set(int index, bool value);
+ * Set the value of a bit.
+ * @param index	Index of the bit.
+ * @param value	Value to set.
+ */
+
+
+/**
+ * Set all bits to 1.
+ */
+void RoaringVector::set(void) {
+	release();
+	_cap = (_size + roaring::SPAN - 1) >> 16;
+	if(!_cap)
+		return;
+	_conts = new roaring::Container[_cap];
+	for(_cnt = 0; _cnt < _cap; _cnt++) {
+		roaring::Container& c = _conts[_cnt];
+		int len = min(roaring::SPAN, _size - (_cnt << 16));
+		c.key = _cnt;
+		roaring::alloc(c, roaring::RUN, 1);
+		c.runs()[0] = 0;
+		c.runs()[1] = len - 1;
+		c.cnt = 1;
+		c.card = len;
+	}
+}
+
+
+/**
+ * Set all bits to 0.
+ */
+void RoaringVector::clear(void) {
+	release();
+}
+
+
+/**
+ * Copy the given vector in the current one.
+ * @param v	Vector to copy.
+ */
+void RoaringVector::copy(const RoaringVector& v) {
+	if(this == &v)
+		return;
+	release();
+	_size = v._size;
+	if(v._cnt) {
+		_cap = v._cnt;
+		_conts = new roaring::Container[_cap];
+		for(_cnt = 0; _cnt < v._cnt; _cnt++)
+			roaring::clone(_conts[_cnt], v._conts[_cnt]);
+	}
+}
+
+
+/**
+ * Perform the combination of two vectors.
+ * @param r		Result vector (may be one of the arguments).
+ * @param a		First vector.
+ * @param b		Second vector.
+ * @param op	Performed operation.
+ */
+void RoaringVector::combine(RoaringVector& r, const RoaringVector& a, const RoaringVector& b, roaring::op_t op) {
+	ASSERTP(a._size == b._size, "vectors must have the same size");
+	int cap = op == roaring::AND ? min(a._cnt, b._cnt) : op == roaring::OR ? a._cnt + b._cnt : a._cnt;
+	roaring::Container *cs = cap ? new roaring::Container[cap] : nullptr;
+	bool steal = &r == &a;
+	int n = 0, i = 0, j = 0;
+	while(i < a._cnt || j < b._cnt) {
+		if(j >= b._cnt || (i < a._cnt && a._conts[i].key < b._conts[j].key)) {
+			if(op != roaring::AND) {
+				if(!steal)
+					roaring::clone(cs[n], a._conts[i]);
+				else {
+					cs[n] = r._conts[i];
+					r._conts[i].mem = nullptr;
+				}
+				n++;
+			}
+			else if(j >= b._cnt)
+				break;
+			i++;
+		}
+		else if(i >= a._cnt || b._conts[j].key < a._conts[i].key) {
+			if(op == roaring::OR)
+				roaring::clone(cs[n++], b._conts[j]);
+			else if(i >= a._cnt)
+				break;
+			j++;
+		}
+		else {
+			roaring::Container& c = cs[n];
+			c.key = a._conts[i].key;
+			roaring::combine(c, a._conts[i], b._conts[j], op);
+			if(c.card)
+				n++;
+			else
+				roaring::release(c);
+			i++;
+			j++;
+		}
+	}
+	int size = a._size;
+	r.release();
+	r._size = size;
+	r._conts = cs;
+	r._cnt = n;
+	r._cap = cap;
+}
+
+
+/**
+ * @fn void RoaringVector::applyAnd(const RoaringVector& v);
+ * Perform AND of the current vector with the given one.
+ * @param v	Operand vector.
+ */
+
+
+/**
+ * @fn RoaringVector RoaringVector::makeAnd(const RoaringVector& v) const;
+ * Build a new vector, AND of the current vector and of the given one.
+ * @param v	Operand vector.
+ * @return	Result vector.
+ */
+
+
+/**
+ * @fn void RoaringVector::applyOr(const RoaringVector& v);
+ * Perform OR of the current vector with the given one.
+ * @param v	Operand vector.
+ */
+
+
+/**
+ * @fn RoaringVector RoaringVector::makeOr(const RoaringVector& v) const;
+ * Build a new vector, OR of the current vector and of the given one.
+ * @param v	Operand vector.
+ * @return	Result vector.
+ */
+
+
+/**
+ * @fn void RoaringVector::applyReset(const RoaringVector& v);
+ * Reset in the current vector the bits to 1 in the given one.
+ * @param v	Operand vector.
+ */
+
+
+/**
+ * @fn RoaringVector RoaringVector::makeReset(const RoaringVector& v) const;
+ * Build a new vector by resetting in the current vector the bits to 1 in the given one.
+ * @param v	Operand vector.
+ * @return	Result vector.
+ */
+
+
+/**
+ * @fn void RoaringVector::applyNot(void);
+ * Invert the bits of the current vector.
+ */
+
+
+/**
+ * @fn RoaringVector RoaringVector::makeNot(void) const;
+ * Build a new vector with the inverted bits of the current vector.
+ * @return	Result vector.
+ */
+
+
+/**
+ * @class RoaringVector::OneIterator
+ * Iterator on the indexes of the bits to 1 of a roaring vector.
+ */
+
+
+/**
+ * Move to the next bit to 1.
+ */
+void RoaringVector::OneIterator::next(void) {
+	while(ci < _v->_cnt) {
+		const roaring::Container& c = _v->_conts[ci];
+		int base = int(c.key) << 16;
+		switch(c.kind) {
+		case roaring::ARRAY:
+			if(++j < c.cnt) {
+				i = base | c.values()[j];
+				return;
+			}
+			break;
+		case roaring::BITMAP:
+			while(!w && ++j < roaring::WORDS)
+				w = c.words()[j];
+			if(w) {
+				i = base | (j << 6) | lsb(w);
+				w &= w - 1;
+				return;
+			}
+			break;
+		case roaring::RUN:
+			if(j >= 0 && x < roaring::runEnd(c, j)) {
+				i = base | ++x;
+				return;
+			}
+			if(++j < c.cnt) {
+				x = roaring::runStart(c, j);
+				i = base | x;
+				return;
+			}
+			break;
+		}
+		ci++;
+		j = -1;
+		w = 0;
+	}
+	i = _v->_size;
+}
+
+
+/**
+ * Print the vector as a set of ranges of bits to 1.
+ * @param out	Output stream.
+ */
+void RoaringVector::print(io::Output& out) const {
+	int s = -1, p = -2;
+	bool first = true;
+	out << '{';
+	auto flush = [&]() {
+		if(s < 0)
+			return;
+		if(!first)
+			out << ", ";
+		first = false;
+		out << s;
+		if(p != s)
+			out << '-' << p;
+	};
+	forEachOne([&](int i) {
+		if(i != p + 1) {
+			flush();
+			s = i;
+		}
+		p = i;
+	});
+	flush();
+	out << '}';
+}
+
+
+/**
+ * Get the memory used by the vector.
+ * @return	Used memory in bytes.
+ */
+t::size RoaringVector::__size(void) const {
+	t::size s = sizeof(RoaringVector) + _cap * sizeof(roaring::Container);
+	for(int i = 0; i < _cnt; i++)
+		s += roaring::memWords(_conts[i].kind, _conts[i].cap) * sizeof(t::uint64);
+	return s;
+}
+
+}	// elm
@@ -0,0 +1,120 @@
+/*
+ *	WorkListSolver class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ * 
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software 
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/util/WorkListSolver.h>
+
+namespace elm {
+
+/**
+ * @class WorkListSolver
+ * Generic iterative solver of data flow analyses whose facts are bit sets.
+ * The input and output facts of the nodes are stored as the rows of two
+ * @ref BitMatrix so that no bit vector is allocated during the resolution.
+ *
+ * The nodes are processed in reverse post-order (computed at construction
+ * from the entry node, then from the nodes not reachable from it). The work
+ * list is a bit vector indexed by this order: after processing a node, the
+ * solver goes to the next pending node in reverse post-order and wraps
+ * around at the end. Hence, each pass over an acyclic part of the graph
+ * processes the nodes after their predecessors.
+ *
+ * When a node is processed, the transfer function computes its output from
+ * its input. Then, if the output has changed (or at the first processing),
+ * the output is joined in place with the input of each successor and the
+ * successors whose input has changed are added to the work list.
+ *
+ * The graph type G must provide:
+ * @li int count() const -- number of nodes, numbered from 0 to count() - 1,
+ * @li succs(int v) const -- iterable (range-based for) on the successor numbers of v.
+ * A backward analysis is obtained by passing the reversed graph.
+ *
+ * The facts must be initialized before the resolution (using ins(),
+ * outs(), in() or out()): typically to empty sets for a may-analysis using
+ * @ref WorkListSolver::Union and to full sets for a must-analysis using
+ * @ref WorkListSolver::Intersection, the entry input being set to the
+ * boundary value.
+ *
+ * @param G		Type of the graph.
+ * @see BitMatrix
+ * @ingroup utility
+ */
+
+
+/**
+ * @fn WorkListSolver::WorkListSolver(const G& graph, int bits, int entry);
+ * Build a solver and compute the reverse post-order of the graph.
+ * @param graph		Graph to work on (must live as long as the solver).
+ * @param bits		Number of bits in the facts.
+ * @param entry		Entry node (default to 0).
+ */
+
+
+/**
+ * @fn template <class T, class J> void WorkListSolver::solve(T transfer, J join);
+ * Compute the fixpoint of the analysis.
+ *
+ * transfer is called as transfer(v, in, out) with v the node number and
+ * in and out of type @ref BitMatrix::Row; it must update out according to
+ * in and return true if out has changed. As the output facts of a
+ * monotonic analysis only grow (or only shrink), a simple way to do it is
+ * to compute the new value in a temporary row and to join it in place with
+ * out, e.g. with @ref BitMatrix::Row::applyOr(), that gives the changed
+ * flag without any comparison.
+ *
+ * join is called as join(in, out) with in the input of a successor and
+ * out the output of the current node; it must join in place out with in and
+ * return true if in has changed.
+ *
+ * @param transfer	Transfer function.
+ * @param join		Join function.
+ */
+
+
+/**
+ * @fn template <class T> void WorkListSolver::solve(T transfer);
+ * Compute the fixpoint of the analysis with the union as join function.
+ * @param transfer	Transfer function.
+ */
+
+
+/**
+ * @fn int WorkListSolver::rank(int v) const;
+ * Get the rank of a node in the reverse post-order.
+ * @param v		Node number.
+ * @return		Rank of v.
+ */
+
+
+/**
+ * @fn int WorkListSolver::node(int r) const;
+ * Get the node at the given rank in the reverse post-order.
+ * @param r		Rank.
+ * @return		Node number.
+ */
+
+
+/**
+ * @fn int WorkListSolver::steps(void) const;
+ * Get the number of transfer function calls performed by the resolution.
+ * @return		Number of processed nodes.
+ */
+
+}	// elm
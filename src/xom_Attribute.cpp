@@ -87,6 +87,15 @@ String Attribute::getLocalName(void) const {
 }
 
 
+/**
+ * Returns the local name of this attribute as an interned symbol.
+ * @return	the attribute's local name as a symbol
+ */
+Symbol Attribute::getLocalSymbol(void) const {
+	return Symbol(getLocalName());
+}
+
+
 /**
  * Unsupported.
  */
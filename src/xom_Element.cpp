@@ -385,6 +385,17 @@ String Element::getLocalName(void) {
 }
 
 
+/**
+ * Returns the local name of this element as an interned symbol. Element
+ * names recur a lot in XML documents: symbols make their comparison and
+ * hashing O(1). It is built on getLocalName().
+ * @return The local name of this element as a symbol.
+ */
+Symbol Element::getLocalSymbol(void) {
+	return Symbol(getLocalName());
+}
+
+
 /**
  * Returns the number of namespace declarations on this element. This counts the
  * namespace of the element itself (which may be the empty string), the
@@ -8,6 +8,7 @@
 #include <elm/array.h>
 #include <elm/data/Array.h>
 #include <elm/test.h>
+#include <elm/util/Pair.h>
 #include "check-concept.h"
 
 using namespace elm;
@@ -138,6 +139,35 @@ TEST_BEGIN(array)
 		CHECK_EQUAL(i, 0);
 	}
 
+	// relocation traits
+	{
+		CHECK(array::is_trivial<int>::_);
+		CHECK(array::is_trivial<int *>::_);
+		CHECK(array::is_trivial<cstring>::_);
+		CHECK((array::is_trivial<Pair<int, void *> >::_));
+		CHECK(!array::is_trivial<string>::_);
+		CHECK(array::is_relocatable<string>::_);
+		CHECK(!array::is_relocatable<TopArray>::_);
+	}
+
+	// transfer
+	{
+		string s[3] = { "a", "b", "c" };
+		string *t = static_cast<string *>(::operator new(3 * sizeof(string)));
+		array::transfer(t, s, 3);
+		CHECK_EQUAL(t[2], string("c"));
+		array::construct(s, 3);
+		TopArray a[2] = { TopArray(1), TopArray(2) };
+		TopArray *b = static_cast<TopArray *>(::operator new(2 * sizeof(TopArray)));
+		array::transfer(b, a, 2);
+		CHECK_EQUAL(b[1].tab.count(), 2);
+		array::construct(a, 2);
+		array::destruct(t, 3);
+		array::destruct(b, 2);
+		::operator delete(t);
+		::operator delete(b);
+	}
+
 TEST_END
 
 	
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * test/test_bitmatrix.cpp -- unit tests for elm::BitMatrix and elm::WorkListSolver classes.
+ */
+
+#include <elm/util/BitMatrix.h>
+#include <elm/util/WorkListSolver.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+// simple graph with successor lists
+class Graph {
+public:
+	Graph(int n): s(n) { s.setLength(n); }
+	inline int count(void) const { return s.count(); }
+	inline const Vector<int>& succs(int v) const { return s[v]; }
+	inline void add(int v, int w) { s[v].add(w); }
+private:
+	Vector<Vector<int> > s;
+};
+
+TEST_BEGIN(bitmatrix)
+
+	// row operations
+	{
+		BitMatrix m(3, 130);
+		CHECK_EQUAL(m.rows(), 3);
+		CHECK_EQUAL(m.cols(), 130);
+		CHECK_EQUAL(m.countOnes(), 0);
+		m.set(0, 0);
+		m.set(0, 129);
+		m.set(1, 64);
+		CHECK(m.bit(0, 0));
+		CHECK(m.bit(0, 129));
+		CHECK(!m.bit(1, 0));
+		CHECK(m[1][64]);
+		CHECK(m.row(2).isEmpty());
+		CHECK(m.orRow(1, 0));
+		CHECK(!m.orRow(1, 0));
+		CHECK_EQUAL(m.row(1).countOnes(), 3);
+		CHECK(m.row(0).applyOr(m.row(1)));
+		CHECK(m.row(0) == m.row(1));
+		CHECK(!m.andRow(0, 1));
+		m.clear(1, 0);
+		CHECK(m.andRow(0, 1));
+		CHECK(m.row(0) == m.row(1));
+		CHECK(m.row(0).applyReset(m.row(1)));
+		CHECK(m.row(0).isEmpty());
+		CHECK(!m.row(0).applyReset(m.row(1)));
+		m.row(2).set();
+		CHECK_EQUAL(m.row(2).countOnes(), 130);
+		m.row(0).copy(m.row(1));
+		BitVector v = m.row(0).toBitVector();
+		CHECK_EQUAL(v.countOnes(), 2);
+		CHECK(v.bit(64) && v.bit(129));
+		int c = 0;
+		m.row(2).forEachOne([&](int) { c++; });
+		CHECK_EQUAL(c, 130);
+		BitMatrix m2 = m;
+		CHECK(m2 == m);
+		m2.clear(2, 7);
+		CHECK(m2 != m);
+		BitMatrix t = m.transpose();
+		CHECK_EQUAL(t.rows(), 130);
+		CHECK_EQUAL(t.cols(), 3);
+		CHECK(t.bit(64, 0) && t.bit(129, 1) && t.bit(7, 2) && !t.bit(7, 0));
+	}
+
+	// empty matrices
+	{
+		BitMatrix m(0, 5);
+		BitMatrix t = m.transpose();
+		CHECK_EQUAL(t.rows(), 5);
+		CHECK_EQUAL(t.cols(), 0);
+		CHECK_EQUAL(t.countOnes(), 0);
+		CHECK(t.row(4).isEmpty());
+		CHECK(t.transpose() == m);
+		BitMatrix e(0, 0, true);
+		e.closure();
+		CHECK(e.transpose() == e);
+	}
+
+	// transitive closure: a ring 0 -> 1 -> ... -> 69 -> 0 and a chain 70 -> ... -> 99
+	{
+		const int n = 100;
+		BitMatrix m(n, n);
+		for(int i = 0; i < 70; i++)
+			m.set(i, (i + 1) % 70);
+		for(int i = 70; i < n - 1; i++)
+			m.set(i, i + 1);
+		m.set(69, 70);
+		m.closure();
+		bool ok = true;
+		for(int i = 0; i < n; i++)
+			for(int j = 0; j < n; j++) {
+				bool e = i < 70 ? true : j > i;
+				ok = ok && m.bit(i, j) == e;
+			}
+		CHECK(ok);
+	}
+
+	// reaching definitions on a loop: 0 -> 1 -> 2 -> 1, 2 -> 3
+	{
+		Graph g(4);
+		g.add(0, 1);
+		g.add(1, 2);
+		g.add(2, 1);
+		g.add(2, 3);
+		// definitions: 0 (x in 0), 1 (y in 0), 2 (x in 2)
+		BitMatrix gen(4, 3), kill(4, 3), tmp(1, 3);
+		gen.set(0, 0);
+		gen.set(0, 1);
+		gen.set(2, 2);
+		kill.set(0, 2);
+		kill.set(2, 0);
+		WorkListSolver<Graph> s(g, 3);
+		CHECK_EQUAL(s.node(0), 0);
+		CHECK(s.rank(1) < s.rank(2));
+		CHECK(s.rank(2) < s.rank(3));
+		s.solve([&](int v, const BitMatrix::Row& in, const BitMatrix::Row& out) {
+			BitMatrix::Row r = tmp.row(0);
+			r.copy(in);
+			r.applyReset(kill.row(v));
+			r.applyOr(gen.row(v));
+			return out.applyOr(r);
+		});
+		CHECK(s.in(1).bit(0) && s.in(1).bit(1) && s.in(1).bit(2));
+		CHECK(!s.out(2).bit(0) && s.out(2).bit(1) && s.out(2).bit(2));
+		CHECK(!s.in(3).bit(0) && s.in(3).bit(1) && s.in(3).bit(2));
+		CHECK(s.steps() <= 8);
+	}
+
+	// must analysis (dominators) with intersection
+	{
+		Graph g(5);
+		g.add(0, 1);
+		g.add(0, 2);
+		g.add(1, 3);
+		g.add(2, 3);
+		g.add(3, 4);
+		g.add(4, 3);
+		WorkListSolver<Graph> s(g, 5);
+		s.ins().set();
+		s.outs().set();
+		s.in(0).clear();
+		s.solve([&](int v, const BitMatrix::Row& in, const BitMatrix::Row& out) {
+			bool had = in.bit(v);
+			in.set(v);
+			bool changed = out.applyAnd(in);
+			if(!had)
+				in.clear(v);
+			return changed;
+		}, WorkListSolver<Graph>::Intersection());
+		CHECK(s.out(3).bit(0) && s.out(3).bit(3) && !s.out(3).bit(1) && !s.out(3).bit(2));
+		CHECK(s.out(4).bit(0) && s.out(4).bit(3) && s.out(4).bit(4));
+		CHECK_EQUAL(s.out(4).countOnes(), 3);
+	}
+
+TEST_END
@@ -193,6 +193,114 @@ TEST_BEGIN(bitvector)
 		CHECK(!one);
 	}
 
+	// word-skipping iterations
+	{
+		int is[] = { 0, 63, 64, 65, 127, 300, 511, 640, 998 };
+		const int n = sizeof(is) / sizeof(int);
+		BitVector v(999);
+		CHECK_EQUAL(v.findFirst(), -1);
+		CHECK_EQUAL(v.findLast(), -1);
+		CHECK(v.begin() == v.end());
+		for(auto i: is)
+			v.set(i);
+		CHECK_EQUAL(v.findFirst(), 0);
+		CHECK_EQUAL(v.findLast(), 998);
+		CHECK_EQUAL(v.findNext(-1), 0);
+		CHECK_EQUAL(v.findNext(64), 65);
+		CHECK_EQUAL(v.findNext(128), 300);
+		CHECK_EQUAL(v.findNext(998), -1);
+
+		int k = 0;
+		bool ok = true;
+		for(int i = v.findFirst(); i >= 0; i = v.findNext(i))
+			ok = ok && k < n && is[k++] == i;
+		CHECK(ok);
+		CHECK_EQUAL(k, n);
+
+		k = 0;
+		ok = true;
+		for(auto i: v)
+			ok = ok && k < n && is[k++] == i;
+		CHECK(ok);
+		CHECK_EQUAL(k, n);
+
+		k = 0;
+		ok = true;
+		v.forEachOne([&](int i) { ok = ok && k < n && is[k++] == i; });
+		CHECK(ok);
+		CHECK_EQUAL(k, n);
+
+		BitVector w = ~v;
+		k = 0;
+		ok = true;
+		for(BitVector::ZeroIterator i(w); i(); i++)
+			ok = ok && k < n && is[k++] == *i;
+		CHECK(ok);
+		CHECK_EQUAL(k, n);
+
+		BitVector f(130, true);
+		CHECK(!BitVector::ZeroIterator(f)());
+		CHECK_EQUAL(f.findLast(), 129);
+		int c = 0;
+		for(BitVector::ZeroIterator i(v); i(); i++)
+			c++;
+		CHECK_EQUAL(c, 999 - n);
+	}
+
+	// bulk operations on several words
+	for(int n = 7; n <= 600; n += 37) {
+		BitVector a(n), b(n), o(n), z(n), f(n, true);
+		bool failed = false;
+		for(int i = 0; i < n; i++) {
+			if(i % 3 == 0)
+				a.set(i);
+			if(i % 5 == 0)
+				b.set(i);
+			if(i % 3 != 0)
+				o.set(i);
+		}
+		CHECK_EQUAL(f.countOnes(), n);
+		CHECK_EQUAL(z.countZeroes(), n);
+		CHECK_EQUAL(a.countOnes(), (n + 2) / 3);
+		CHECK_EQUAL(a.countZeroes(), n - (n + 2) / 3);
+		CHECK(z.isEmpty());
+		CHECK(!f.isEmpty());
+		CHECK(f.includes(a));
+		CHECK(!a.includes(f));
+		CHECK(f.equals(a | o));
+		CHECK(a.makeNot().equals(o));
+		CHECK(!a.meets(o));
+		CHECK(a.meets(b));
+		CHECK((a & o).isEmpty());
+		BitVector c = a | b;
+		BitVector d = c - b;
+		for(int i = 0; i < n; i++)
+			if(c.bit(i) != (i % 3 == 0 || i % 5 == 0)
+			|| d.bit(i) != (i % 3 == 0 && i % 5 != 0))
+				failed = true;
+		CHECK(!failed);
+		CHECK(c.includesStrictly(a));
+		CHECK(!a.includesStrictly(a));
+		BitVector e = c;
+		CHECK(!e.applyOr(a));
+		CHECK(!e.applyAnd(c));
+		CHECK(!e.applyReset(z));
+		e.clear(n - 1);
+		CHECK(e.applyOr(f));
+		CHECK(e.applyAnd(a));
+		CHECK(e.applyReset(a));
+		CHECK(e.isEmpty());
+		BitVector g = a;
+		g.applyNot();
+		CHECK(g == o);
+		g.resize(n + 100);
+		CHECK_EQUAL(g.countOnes(), o.countOnes());
+		BitVector h(f, n + 70);
+		CHECK_EQUAL(h.countOnes(), n);
+		BitVector k(f, (n + 1) / 2);
+		CHECK_EQUAL(k.countOnes(), (n + 1) / 2);
+	}
+
 #ifdef EXPERIMENTAL
 	// left shift
 	{
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * test/test_btree.cpp -- unit tests for elm::BTreeMap and elm::BTreeSet classes.
+ */
+
+#include <elm/avl/Map.h>
+#include <elm/data/BTreeMap.h>
+#include <elm/data/BTreeSet.h>
+#include <elm/data/Vector.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+TEST_BEGIN(btree)
+
+	// concept checks
+	{
+		if(false) {
+			BTreeMap<int, int> m;
+			m.clear();
+			m.put(1, 1);
+			m.get(1);
+			m.get(1, 2);
+			m.hasKey(1);
+			m.keys();
+			m.pairs();
+			m.count();
+			m.isEmpty();
+			m.begin();
+			m.end();
+			m.contains(1);
+			m.equals(m);
+			m.remove(1);
+			m.remove(m.begin());
+			m[1];
+			BTreeSet<int> s;
+			s.add(1);
+			s.insert(1);
+			s.remove(1);
+			s.remove(s.begin());
+			s.join(s);
+			s.diff(s);
+			s.meet(s);
+			s.subsetOf(s);
+			s = s | s;
+			s = s & s;
+		}
+	}
+
+	// simple map
+	{
+		BTreeMap<int, int> map;
+		CHECK(map.isEmpty());
+		CHECK_EQUAL(map.count(), 0);
+		map.put(666, 111);
+		CHECK(!map.isEmpty());
+		CHECK_EQUAL(map.count(), 1);
+		CHECK_EQUAL(map.get(666, 0), 111);
+		CHECK_EQUAL(map.get(111, 0), 0);
+		map.put(777, 222);
+		CHECK_EQUAL(map.count(), 2);
+		CHECK_EQUAL(map.get(777, 0), 222);
+		map.put(666, 333);
+		CHECK_EQUAL(map.count(), 2);
+		CHECK_EQUAL(map.get(666, 0), 333);
+		map.remove(666);
+		CHECK_EQUAL(map.count(), 1);
+		CHECK(!map.hasKey(666));
+		CHECK_EQUAL(map[777], 222);
+	}
+
+	// random operations against avl::Map
+	{
+		BTreeMap<int, int> map;
+		avl::Map<int, int> ref;
+		const int N = 50000;
+		t::uint32 x = 12345;
+		for(int i = 0; i < N; i++) {
+			x = x * 1103515245 + 12345;
+			int k = (x >> 8) % 4096;
+			if((x >> 4) % 3 == 0) {
+				map.remove(k);
+				ref.remove(k);
+			}
+			else {
+				map.put(k, i);
+				ref.remove(k);
+				ref.put(k, i);
+			}
+		}
+		CHECK_EQUAL(map.count(), ref.count());
+		bool failed = false;
+		auto j = ref.pairs().begin();
+		for(auto p: map.pairs()) {
+			if(!j() || p.fst != (*j).fst || p.snd != (*j).snd)
+				failed = true;
+			j++;
+		}
+		CHECK(!failed);
+		CHECK(!j());
+	}
+
+	// sorted and reverse insertion, removal with merges
+	{
+		const int N = 10000;
+		BTreeSet<int> s1, s2;
+		for(int i = 0; i < N; i++) {
+			s1.add(i);
+			s2.add(N - i - 1);
+		}
+		CHECK_EQUAL(s1.count(), N);
+		CHECK(s1 == s2);
+		CHECK(s1.height() > 1);
+		int p = -1;
+		bool failed = false;
+		for(auto x: s2) {
+			if(x != p + 1)
+				failed = true;
+			p = x;
+		}
+		CHECK(!failed);
+		for(int i = 0; i < N; i += 2)
+			s1.remove(i);
+		CHECK_EQUAL(s1.count(), N / 2);
+		failed = false;
+		for(int i = 0; i < N; i++)
+			if(s1.contains(i) != (i % 2 == 1))
+				failed = true;
+		CHECK(!failed);
+		for(int i = 1; i < N; i += 2)
+			s1.remove(i);
+		CHECK(s1.isEmpty());
+		CHECK_EQUAL(s1.height(), 0);
+		for(int i = N - 1; i >= 0; i--)
+			s2.remove(i);
+		CHECK(s2.isEmpty());
+	}
+
+	// bounds and range
+	{
+		BTreeMap<int, int> map;
+		for(int i = 0; i < 1000; i++)
+			map.put(i * 10, i);
+		CHECK_EQUAL(*map.lowerBound(50), 5);
+		CHECK_EQUAL(*map.lowerBound(51), 6);
+		CHECK_EQUAL(*map.upperBound(50), 6);
+		CHECK_EQUAL(*map.lowerBound(-5), 0);
+		CHECK(map.lowerBound(9991).ended());
+		CHECK(map.upperBound(9990).ended());
+		int c = 0, s = 0;
+		for(auto p: map.range(100, 200)) {
+			c++;
+			s += p.snd;
+		}
+		CHECK_EQUAL(c, 10);
+		CHECK_EQUAL(s, 145);
+		c = 0;
+		for(auto p: map.range(105, 105)) {
+			c++;
+			s += p.snd;
+		}
+		CHECK_EQUAL(c, 0);
+		c = 0;
+		for(auto p: map.range(500, 100)) {
+			c++;
+			s += p.snd;
+		}
+		CHECK_EQUAL(c, 0);
+		BTreeSet<int> set;
+		for(int i = 0; i < 100; i++)
+			set.add(i * 2);
+		c = 0;
+		for(auto x: set.range(11, 21)) {
+			CHECK(x >= 11 && x < 21);
+			c++;
+		}
+		CHECK_EQUAL(c, 5);
+		c = 0;
+		for(auto x: set.range(21, 11)) {
+			CHECK(x >= 11 && x < 21);
+			c++;
+		}
+		CHECK_EQUAL(c, 0);
+	}
+
+	// bulk load and copy
+	{
+		const int N = 12345;
+		Vector<Pair<int, int> > v;
+		for(int i = 0; i < N; i++)
+			v.add(pair(i * 3, i));
+		BTreeMap<int, int> map;
+		map.put(-1, -1);
+		map.load(v);
+		CHECK_EQUAL(map.count(), N);
+		CHECK(!map.hasKey(-1));
+		bool failed = false;
+		for(int i = 0; i < N; i++)
+			if(map.get(i * 3, -1) != i || map.hasKey(i * 3 + 1))
+				failed = true;
+		CHECK(!failed);
+		for(int i = 0; i < N; i += 3)
+			map.put(i * 3 + 1, -i);
+		CHECK_EQUAL(map.count(), N + N / 3);
+		BTreeMap<int, int> map2;
+		map2.copy(map);
+		CHECK(map2 == map);
+		map2.put(0, 1);
+		CHECK(map2 != map);
+		for(int i = 0; i < N; i++)
+			map2.remove(i * 3);
+		CHECK_EQUAL(map2.count(), N / 3);
+		map2.load(Vector<Pair<int, int> >());
+		CHECK(map2.isEmpty());
+	}
+
+	// set operations
+	{
+		BTreeSet<int> s1, s2;
+		for(int i = 0; i < 100; i++)
+			s1.add(i);
+		for(int i = 50; i < 150; i++)
+			s2.add(i);
+		BTreeSet<int> r = s1 & s2;
+		CHECK_EQUAL(r.count(), 50);
+		CHECK(r.subsetOf(s1));
+		CHECK(r.subsetOf(s2));
+		r = s1 | s2;
+		CHECK_EQUAL(r.count(), 150);
+		r = s1 - s2;
+		CHECK_EQUAL(r.count(), 50);
+		CHECK(r.contains(0));
+		CHECK(!r.contains(50));
+	}
+
+	// complex items
+	{
+		BTreeMap<string, string> map;
+		for(int i = 0; i < 1000; i++)
+			map.put(_ << i, _ << "v" << i);
+		CHECK_EQUAL(map.count(), 1000);
+		CHECK_EQUAL(map.get("123", ""), string("v123"));
+		for(int i = 0; i < 1000; i += 2)
+			map.remove(_ << i);
+		CHECK_EQUAL(map.count(), 500);
+		CHECK_EQUAL(map.get("123", ""), string("v123"));
+		CHECK(!map.hasKey("124"));
+	}
+
+TEST_END
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * test/test_concurrent_hashmap.cpp -- unit tests for elm::ConcurrentHashMap class.
+ */
+
+#include <elm/data/ConcurrentHashMap.h>
+#include <elm/sys/Thread.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+typedef ConcurrentHashMap<int, int> cmap_t;
+
+class Worker: public sys::Runnable {
+public:
+	Worker(cmap_t& map, int id, int n): _map(map), _id(id), _n(n), added(0) { }
+	void run(void) override {
+		for(int i = 0; i < _n; i++) {
+			_map.fetch(i, [](int& v) { v++; });
+			if(_map.putIfAbsent(-i - 1, _id))
+				added++;
+			_map.computeIfAbsent(_n + i, [](int k) { return k * 2; });
+		}
+	}
+private:
+	cmap_t& _map;
+	int _id, _n;
+public:
+	int added;
+};
+
+TEST_BEGIN(concurrent_hashmap)
+
+	// sequential use
+	{
+		cmap_t map(10);
+		CHECK_EQUAL(map.shardCount(), 16);
+		CHECK(map.isEmpty());
+		map.put(1, 111);
+		map.put(2, 222);
+		CHECK_EQUAL(map.count(), 2);
+		CHECK_EQUAL(map.get(1, 0), 111);
+		CHECK(map.hasKey(2));
+		CHECK(!map.get(3));
+		CHECK(!map.putIfAbsent(1, 666));
+		CHECK_EQUAL(map.get(1, 0), 111);
+		CHECK(map.putIfAbsent(3, 333));
+		CHECK_EQUAL(map.computeIfAbsent(3, [](int k) { return 0; }), 333);
+		CHECK_EQUAL(map.computeIfAbsent(4, [](int k) { return k * 111; }), 444);
+		CHECK_EQUAL(map.fetch(4, [](int& v) { v++; }), 445);
+		CHECK(!map.removeIf(4, 444));
+		CHECK(map.removeIf(4, 445));
+		CHECK(!map.hasKey(4));
+		map.remove(3);
+		int s = 0;
+		map.forEach([&](int k, int v) { s += v; });
+		CHECK_EQUAL(s, 333);
+		map.clear();
+		CHECK(map.isEmpty());
+	}
+
+	// initial capacity
+	{
+		cmap_t map(4, 1000);
+		CHECK_EQUAL(map.shardCount(), 4);
+		for(int i = 0; i < 2000; i++)
+			map.put(i, i + 1);
+		CHECK_EQUAL(map.count(), 2000);
+		bool ok = true;
+		for(int i = 0; i < 2000; i++)
+			ok = ok && map.get(i, 0) == i + 1;
+		CHECK(ok);
+	}
+
+	// concurrent use
+	{
+		static const int T = 4, N = 10000;
+		cmap_t map;
+		Worker *workers[T];
+		sys::Thread *threads[T];
+		for(int i = 0; i < T; i++) {
+			workers[i] = new Worker(map, i, N);
+			threads[i] = sys::Thread::make(*workers[i]);
+		}
+		for(int i = 0; i < T; i++)
+			threads[i]->start();
+		for(int i = 0; i < T; i++)
+			threads[i]->join();
+		int added = 0;
+		for(int i = 0; i < T; i++) {
+			added += workers[i]->added;
+			delete threads[i];
+			delete workers[i];
+		}
+		CHECK_EQUAL(added, N);
+		CHECK_EQUAL(map.count(), 3 * N);
+		bool failed = false;
+		for(int i = 0; i < N; i++)
+			if(map.get(i, 0) != T || map.get(N + i, 0) != (N + i) * 2)
+				failed = true;
+		CHECK(!failed);
+	}
+
+TEST_END
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * test/test_flat_hashtable.cpp -- unit tests for elm::FlatHashXXX classes.
+ */
+
+#include <elm/data/FlatHashMap.h>
+#include <elm/data/FlatHashSet.h>
+#include <elm/data/Vector.h>
+#include <elm/util/BitVector.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+class FlatCounted {
+public:
+	static int copies;
+	inline FlatCounted(int x = 0): v(x) { }
+	inline FlatCounted(const FlatCounted& c): v(c.v) { copies++; }
+	inline FlatCounted(FlatCounted&& c): v(c.v) { }
+	inline FlatCounted& operator=(const FlatCounted& c) { v = c.v; copies++; return *this; }
+	inline bool operator==(const FlatCounted& c) const { return v == c.v; }
+	int v;
+};
+int FlatCounted::copies = 0;
+
+TEST_BEGIN(flat_hashtable)
+
+	// concept checks
+	{
+		if(false) {
+			FlatHashMap<int, int> m;
+			m.clear();
+			m.add(1, 1);
+			m.get(1);
+			m.get(1, 2);
+			m.hasKey(1);
+			m.keys();
+			m.pairs();
+			m.count();
+			m.isEmpty();
+			m.begin();
+			m.end();
+			m.contains(1);
+			m.containsAll(m);
+			m.equals(m);
+			m.includes(m);
+			m.put(1, 1);
+			m.remove(1);
+			m.remove(m.begin());
+			m.putAll(m);
+			m[1];
+			m[1] = 1;
+			m.fetch(1);
+			FlatHashSet<int> s;
+			s.add(1);
+			s.remove(s.begin());
+			s.join(s);
+			s.diff(s);
+			s.meet(s);
+			s = s | s;
+			s = s & s;
+		}
+	}
+
+	// simple map
+	{
+		FlatHashMap<int, int> map;
+		CHECK(map.isEmpty());
+		CHECK_EQUAL(map.count(), 0);
+		map.put(666, 111);
+		CHECK(!map.isEmpty());
+		CHECK_EQUAL(map.count(), 1);
+		CHECK_EQUAL(map.get(666, 0), 111);
+		CHECK_EQUAL(map.get(111, 0), 0);
+		map.put(777, 222);
+		CHECK_EQUAL(map.count(), 2);
+		CHECK_EQUAL(map.get(666, 0), 111);
+		CHECK_EQUAL(map.get(777, 0), 222);
+		map.put(666, 333);
+		CHECK_EQUAL(map.count(), 2);
+		CHECK_EQUAL(map.get(666, 0), 333);
+		map.remove(666);
+		CHECK_EQUAL(map.count(), 1);
+		CHECK_EQUAL(map.get(666, 0), 0);
+		CHECK_EQUAL(map.get(777, 0), 222);
+	}
+
+	// complex key
+	{
+		FlatHashMap<string, int> map;
+		map[str("god")] = 111;
+		map[str("devil")] = 666;
+		CHECK_EQUAL(111, *map[str("god")]);
+		CHECK_EQUAL(666, *map[str("devil")]);
+		map.fetch("god")++;
+		CHECK_EQUAL(112, *map[str("god")]);
+		FlatHashMap<string, int> map2(map);
+		CHECK(map2 == map);
+		map2.put("god", 0);
+		CHECK(map2 != map);
+	}
+
+	// growing, removal and tombstones
+	{
+		FlatHashMap<int, int> map;
+		const int N = 100000;
+		for(int i = 0; i < N; i++)
+			map.put(i * 16, i);
+		CHECK_EQUAL(map.count(), N);
+		bool failed = false;
+		for(int i = 0; i < N; i++)
+			if(map.get(i * 16, -1) != i)
+				failed = true;
+		CHECK(!failed);
+		for(int i = 0; i < N; i += 2)
+			map.remove(i * 16);
+		CHECK_EQUAL(map.count(), N / 2);
+		failed = false;
+		for(int i = 0; i < N; i++)
+			if(map.hasKey(i * 16) != (i % 2 == 1))
+				failed = true;
+		CHECK(!failed);
+		int s = map.size();
+		for(int r = 0; r < 10; r++) {
+			for(int i = 0; i < N; i += 4)
+				map.put(i * 16 + 1, i);
+			for(int i = 0; i < N; i += 4)
+				map.remove(i * 16 + 1);
+		}
+		CHECK_EQUAL(map.size(), s);
+		CHECK_EQUAL(map.count(), N / 2);
+		int cnt = 0;
+		for(auto k: map.keys())
+			if(k % 32 == 16)
+				cnt++;
+		CHECK_EQUAL(cnt, N / 2);
+		map.clear();
+		CHECK(map.isEmpty());
+		CHECK(!map.hasKey(16));
+	}
+
+	// reserve
+	{
+		FlatHashSet<int> set;
+		set.reserve(1000);
+		int s = set.size();
+		for(int i = 0; i < 1000; i++)
+			set.add(i);
+		CHECK_EQUAL(set.size(), s);
+		CHECK_EQUAL(set.count(), 1000);
+	}
+
+	// items are moved, not copied, when the table grows
+	{
+		FlatHashSet<FlatCounted> set;
+		FlatCounted::copies = 0;
+		for(int i = 0; i < 1000; i++)
+			set.add(FlatCounted(i));
+		CHECK_EQUAL(set.count(), 1000);
+		CHECK_EQUAL(FlatCounted::copies, 1000);
+		CHECK(set.contains(FlatCounted(999)));
+	}
+
+	// set operations
+	{
+		FlatHashSet<int> s1, s2;
+		for(int i = 0; i < 100; i++)
+			s1.add(i);
+		for(int i = 50; i < 150; i++)
+			s2.add(i);
+		FlatHashSet<int> r = s1 & s2;
+		CHECK_EQUAL(r.count(), 50);
+		CHECK(r <= s1);
+		CHECK(r < s2);
+		r = s1 | s2;
+		CHECK_EQUAL(r.count(), 150);
+		r = s1 - s2;
+		CHECK_EQUAL(r.count(), 50);
+		CHECK(r.contains(0));
+		CHECK(!r.contains(50));
+
+		Vector<int> v;
+		v.add(0);
+		v.add(99);
+		CHECK(s1.containsAll(v));
+		s1.removeAll(v);
+		CHECK(!s1.contains(0));
+		CHECK_EQUAL(s1.count(), 98);
+	}
+
+	// C++ for statement
+	{
+		FlatHashMap<int, int> map;
+		const int N = 10;
+		for(int i = 0; i < N; i++)
+			map.put(i, i);
+		BitVector bv(N);
+		for(auto x: map)
+			bv.set(x);
+		CHECK(bv.countBits() == N);
+		bv.clear();
+		for(auto x: map.pairs())
+			bv.set(x.snd);
+		CHECK(bv.countBits() == N);
+	}
+
+TEST_END
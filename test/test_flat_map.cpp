@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * test/test_flat_map.cpp -- unit tests for elm::FlatMap and elm::FlatSet classes.
+ */
+
+#include <elm/data/FlatMap.h>
+#include <elm/data/FlatSet.h>
+#include <elm/data/Vector.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+class MapCounted {
+public:
+	static int copies;
+	inline MapCounted(int x = 0): v(x) { }
+	inline MapCounted(const MapCounted& c): v(c.v) { copies++; }
+	inline MapCounted(MapCounted&& c): v(c.v) { }
+	inline MapCounted& operator=(const MapCounted& c) { v = c.v; copies++; return *this; }
+	inline MapCounted& operator=(MapCounted&& c) { v = c.v; return *this; }
+	inline bool operator==(const MapCounted& c) const { return v == c.v; }
+	int v;
+};
+int MapCounted::copies = 0;
+
+TEST_BEGIN(flat_map)
+
+	// concept checks
+	{
+		if(false) {
+			FlatMap<int, int> m;
+			m.clear();
+			m.get(1);
+			m.get(1, 2);
+			m.hasKey(1);
+			m.keys();
+			m.pairs();
+			m.count();
+			m.isEmpty();
+			m.begin();
+			m.end();
+			m.contains(1);
+			m.containsAll(m);
+			m.equals(m);
+			m.put(1, 1);
+			m.remove(1);
+			m.remove(m.begin());
+			m.fetch(1);
+			m.lowerBound(1);
+			m.range(1, 2);
+			FlatSet<int> s;
+			s.insert(1);
+			s.remove(s.begin());
+			s.join(s);
+			s.diff(s);
+			s.meet(s);
+			s = s | s;
+			s = s & s;
+		}
+	}
+
+	// simple map
+	{
+		FlatMap<int, int> map;
+		CHECK(map.isEmpty());
+		CHECK_EQUAL(map.count(), 0);
+		CHECK(!map.hasKey(0));
+		map.put(666, 111);
+		CHECK(!map.isEmpty());
+		CHECK_EQUAL(map.count(), 1);
+		CHECK_EQUAL(map.get(666, 0), 111);
+		CHECK_EQUAL(map.get(111, 0), 0);
+		map.put(777, 222);
+		map.put(555, 333);
+		CHECK_EQUAL(map.count(), 3);
+		CHECK_EQUAL(map.get(666, 0), 111);
+		CHECK_EQUAL(map.get(777, 0), 222);
+		CHECK_EQUAL(map.get(555, 0), 333);
+		map.put(666, 444);
+		CHECK_EQUAL(map.count(), 3);
+		CHECK_EQUAL(map.get(666, 0), 444);
+		map.fetch(666)++;
+		CHECK_EQUAL(map.get(666, 0), 445);
+		map.remove(666);
+		CHECK_EQUAL(map.count(), 2);
+		CHECK(!map.get(666));
+		int last = 0;
+		bool ordered = true;
+		for(auto k: map.keys()) {
+			if(k <= last)
+				ordered = false;
+			last = k;
+		}
+		CHECK(ordered);
+	}
+
+	// big map, ordered access
+	{
+		static const int N = 10000;
+		FlatMap<int, int> map;
+		for(int i = 0; i < N; i++)
+			map.put((i * 7919) % N * 2, i);
+		CHECK_EQUAL(map.count(), N);
+		bool failed = false;
+		for(int i = 0; i < N; i++)
+			if(map.get((i * 7919) % N * 2, -1) != i || map.hasKey(i * 2 + 1))
+				failed = true;
+		CHECK(!failed);
+		CHECK_EQUAL(map.lowerBound(11).key(), 12);
+		CHECK_EQUAL(map.lowerBound(12).key(), 12);
+		CHECK_EQUAL(map.upperBound(12).key(), 14);
+		CHECK(map.upperBound(2 * N) == map.end());
+		int c = 0;
+		for(auto p: map.range(100, 200)) {
+			if(p.fst < 100 || p.fst >= 200)
+				failed = true;
+			c++;
+		}
+		CHECK(!failed);
+		CHECK_EQUAL(c, 50);
+		c = 0;
+		for(auto p: map.range(200, 100)) {
+			if(p.fst < 100 || p.fst >= 200)
+				failed = true;
+			c++;
+		}
+		CHECK(!failed);
+		CHECK_EQUAL(c, 0);
+		FlatMap<int, int> map2;
+		map2 = map;
+		CHECK(map2 == map);
+		map2.put(0, -1);
+		CHECK(map2 != map);
+	}
+
+	// bulk loading from unsorted input with duplicates (last value wins)
+	{
+		Vector<Pair<string, int> > v;
+		v.add(pair(string("c"), 1));
+		v.add(pair(string("a"), 2));
+		v.add(pair(string("b"), 3));
+		v.add(pair(string("a"), 4));
+		v.add(pair(string("c"), 5));
+		FlatMap<string, int> map;
+		map.load(v);
+		CHECK_EQUAL(map.count(), 3);
+		CHECK_EQUAL(map.get("a", 0), 4);
+		CHECK_EQUAL(map.get("b", 0), 3);
+		CHECK_EQUAL(map.get("c", 0), 5);
+		CHECK_EQUAL(*map.keys().begin(), string("a"));
+	}
+
+	// bulk loading moves the payloads after the initial copy
+	{
+		Vector<Pair<int, MapCounted> > v;
+		for(int i = 0; i < 1000; i++)
+			v.add(pair((i * 7) % 500, MapCounted(i)));
+		FlatMap<int, MapCounted> map;
+		MapCounted::copies = 0;
+		map.load(v);
+		CHECK_EQUAL(map.count(), 500);
+		CHECK_EQUAL(MapCounted::copies, 1000);
+		CHECK_EQUAL(map.get(0, MapCounted()).v, 500);
+	}
+
+	// custom comparator
+	{
+		typedef ReverseComparator<int, Comparator<int> > rev_t;
+		FlatMap<int, int, rev_t> map;
+		for(int i = 0; i < 10; i++)
+			map.put(i, i * i);
+		CHECK_EQUAL(*map.keys().begin(), 9);
+		CHECK_EQUAL(map.get(3, 0), 9);
+	}
+
+	// sets
+	{
+		FlatSet<int> s1, s2;
+		for(int i = 0; i < 100; i++)
+			s1.add(i);
+		Vector<int> v;
+		for(int i = 149; i >= 50; i--)
+			v.add(i);
+		v.add(50);
+		s2.addAll(v);
+		CHECK_EQUAL(s2.count(), 100);
+		CHECK(s2.contains(149));
+		CHECK(!s2.contains(49));
+		FlatSet<int> r = s1 & s2;
+		CHECK_EQUAL(r.count(), 50);
+		CHECK(r <= s1);
+		CHECK(r < s2);
+		CHECK(!(s1 <= s2));
+		r = s1 | s2;
+		CHECK_EQUAL(r.count(), 150);
+		r = s1 - s2;
+		CHECK_EQUAL(r.count(), 50);
+		CHECK(r.contains(0));
+		CHECK(!r.contains(50));
+		s1.removeAll(v);
+		CHECK(s1 == r);
+		int c = 0;
+		for(auto x: s2.range(60, 70)) {
+			CHECK(60 <= x && x < 70);
+			c++;
+		}
+		CHECK_EQUAL(c, 10);
+		c = 0;
+		for(auto x: s2.range(70, 60)) {
+			CHECK(60 <= x && x < 70);
+			c++;
+		}
+		CHECK_EQUAL(c, 0);
+	}
+
+TEST_END
@@ -56,7 +56,7 @@ TEST_BEGIN(formatter)
 		String result = buf.toString();
 		CString res = buf.toCString();
 		CHECK_EQUAL(res, CString("r3 = %d"));
-		delete [] res.chars();
+		free((void *)res.chars());
 	}
 
 	{
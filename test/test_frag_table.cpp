@@ -20,6 +20,7 @@
  */
 
 #include <elm/data/FragTable.h>
+#include <elm/util/Pair.h>
 #include "../include/elm/test.h"
 
 using namespace elm;
@@ -104,5 +105,38 @@ TEST_BEGIN(frag_table)
 			break;
 		}
 	CHECK(test_mut_iter);*/
+
+	// insertion and removal across pages
+	{
+		FragTable<string> t(2);
+		Vector<string> r;
+		for(int i = 0; i < 10; i++) {
+			t.add(_ << i);
+			r.add(_ << i);
+		}
+		t.insert(1, "x");
+		r.insert(1, "x");
+		t.insert(10, "y");
+		r.insert(10, "y");
+		t.removeAt(2);
+		r.removeAt(2);
+		t.removeAt(0);
+		r.removeAt(0);
+		CHECK_EQUAL(t.count(), r.count());
+		bool ok = true;
+		for(int i = 0; i < r.count(); i++)
+			if(t[i] != r[i])
+				ok = false;
+		CHECK(ok);
+	}
+
+	// emplace
+	{
+		FragTable<Pair<int, int> > t(2);
+		for(int i = 0; i < 10; i++)
+			t.emplace(i, i * 2);
+		CHECK_EQUAL(t.count(), 10);
+		CHECK_EQUAL(t[9].snd, 18);
+	}
 	
 TEST_END
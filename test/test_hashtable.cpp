@@ -341,4 +341,89 @@ TEST_BEGIN(hashtable)
 		CHECK(bv.countBits() == N);
 	}
 
+	// growing table
+	{
+		HashMap<int, int> map(8);
+		const int N = 10000;
+		for(int i = 0; i < N; i++)
+			map.put(i * 256, i);
+		CHECK_EQUAL(map.count(), N);
+		CHECK(map.size() >= N);
+		CHECK(map.maxEntry() <= 16);
+		bool failed = false;
+		for(int i = 0; i < N; i++)
+			if(map.get(i * 256, -1) != i)
+				failed = true;
+		CHECK(!failed);
+		for(int i = 0; i < N; i += 2)
+			map.remove(i * 256);
+		CHECK_EQUAL(map.count(), N / 2);
+		int cnt = 0;
+		for(auto x: map) { cnt++; get_bool(x); }
+		CHECK_EQUAL(cnt, N / 2);
+		map.clear();
+		CHECK(map.isEmpty());
+		CHECK_EQUAL(map.count(), 0);
+	}
+
+	// look-up policies
+	{
+		HashMap<int, int, HashKey<int>, DefaultAlloc, Equiv<int>, MoveToFrontLookup> map(8);
+		for(int i = 0; i < 100; i++)
+			map.put(i, i * 2);
+		bool failed = false;
+		for(int j = 0; j < 3; j++)
+			for(int i = 99; i >= 0; i--)
+				if(map.get(i, -1) != i * 2)
+					failed = true;
+		CHECK(!failed);
+		CHECK_EQUAL(map.count(), 100);
+		HashSet<int, HashKey<int>, DefaultAlloc, MoveToFrontLookup> set;
+		set.add(1);
+		set.add(2);
+		CHECK(set.contains(1));
+		CHECK(set.contains(2));
+		CHECK(!set.contains(3));
+	}
+
+	// reserve and load factor
+	{
+		HashSet<int> set;
+		set.reserve(1000);
+		int s = set.size();
+		CHECK(s >= 1000);
+		for(int i = 0; i < 1000; i++)
+			set.add(i);
+		CHECK_EQUAL(set.size(), s);
+		set.setMaxLoad(.5f);
+		CHECK(set.size() >= 2000);
+		CHECK_EQUAL(set.count(), 1000);
+		CHECK(set.contains(999));
+		HashSet<int> set2;
+		set2 = set;
+		CHECK_EQUAL(set2.count(), 1000);
+		CHECK(set2.contains(500));
+	}
+
+	// move semantics
+	{
+		HashMap<int, Vector<int> > map;
+		Vector<int> v;
+		v.add(111);
+		map.put(1, std::move(v));
+		CHECK_EQUAL(v.count(), 0);
+		CHECK_EQUAL(map.get(1, Vector<int>()).count(), 1);
+		v.add(222);
+		v.add(333);
+		map.put(1, std::move(v));
+		CHECK_EQUAL(map.count(), 1);
+		CHECK_EQUAL(map.get(1, Vector<int>()).count(), 2);
+		map.fetch(2).add(666);
+		CHECK_EQUAL(map.fetch(2)[0], 666);
+		HashSet<string> set;
+		string s = "ok";
+		set.add(std::move(s));
+		CHECK(set.contains("ok"));
+	}
+
 TEST_END
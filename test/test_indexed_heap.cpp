@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * test/test_indexed_heap.cpp -- unit tests for elm::IndexedHeap class.
+ */
+
+#include <elm/data/IndexedHeap.h>
+#include <elm/data/Vector.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+static t::uint32 seed = 12345;
+static int next(void) { seed = seed * 1103515245 + 12345; return int(seed >> 8); }
+
+TEST_BEGIN(indexed_heap)
+
+	// heap sort
+	{
+		IndexedHeap<int> h;
+		CHECK(h.isEmpty());
+		for(int i = 0; i < 10000; i++)
+			h.put(next() % 1000);
+		CHECK_EQUAL(h.count(), 10000);
+		int p = -1;
+		bool failed = false;
+		while(!h.isEmpty()) {
+			int x = h.get();
+			if(x < p)
+				failed = true;
+			p = x;
+		}
+		CHECK(!failed);
+	}
+
+	// handles and key changes
+	{
+		IndexedHeap<int> h;
+		Vector<int> hs;
+		for(int i = 0; i < 100; i++)
+			hs.add(h.put(100 + i));
+		CHECK_EQUAL(h.head(), 100);
+		CHECK_EQUAL(h[hs[50]], 150);
+		h.decreaseKey(hs[50], 10);
+		CHECK_EQUAL(h.head(), 10);
+		CHECK_EQUAL(h.headHandle(), hs[50]);
+		h.increaseKey(hs[50], 500);
+		CHECK_EQUAL(h.head(), 100);
+		h.update(hs[99], 5);
+		CHECK_EQUAL(h.headHandle(), hs[99]);
+		h.remove(hs[99]);
+		CHECK(!h.contains(hs[99]));
+		CHECK_EQUAL(h.count(), 99);
+		CHECK_EQUAL(h.head(), 100);
+		h.remove(hs[0]);
+		CHECK_EQUAL(h.head(), 101);
+
+		// handle reuse
+		int nh = h.put(1);
+		CHECK(nh == hs[0] || nh == hs[99]);
+		CHECK_EQUAL(h.get(), 1);
+		CHECK(!h.contains(nh));
+		int c = 0;
+		while(!h.isEmpty()) {
+			h.get();
+			c++;
+		}
+		CHECK_EQUAL(c, 98);
+	}
+
+	// random operations against a reference
+	{
+		IndexedHeap<int, Comparator<int>, 2> h;
+		Vector<int> ref, hs;
+		bool failed = false;
+		for(int i = 0; i < 20000; i++) {
+			int op = next() % 4;
+			if(op <= 1 || hs.isEmpty()) {
+				int x = next() % 10000;
+				int k = h.put(x);
+				while(ref.count() <= k)
+					ref.add(-1);
+				ref[k] = x;
+				hs.add(k);
+			}
+			else if(op == 2) {
+				int j = next() % hs.count();
+				int x = next() % 10000;
+				h.update(hs[j], x);
+				ref[hs[j]] = x;
+			}
+			else {
+				int j = next() % hs.count();
+				h.remove(hs[j]);
+				ref[hs[j]] = -1;
+				hs[j] = hs.top();
+				hs.pop();
+			}
+			if(!hs.isEmpty()) {
+				int m = ref[hs[0]];
+				for(auto k: hs)
+					if(ref[k] < m)
+						m = ref[k];
+				if(h.head() != m || h.count() != hs.count())
+					failed = true;
+			}
+		}
+		CHECK(!failed);
+	}
+
+	// complex values and reverse order
+	{
+		IndexedHeap<string, ReverseComparator<string, Comparator<string> > > h;
+		h.put("a");
+		int b = h.put("b");
+		h.put("c");
+		CHECK_EQUAL(h.head(), string("c"));
+		h.update(b, "d");
+		CHECK_EQUAL(h.get(), string("d"));
+		CHECK_EQUAL(h.get(), string("c"));
+		CHECK_EQUAL(h.get(), string("a"));
+		CHECK(h.isEmpty());
+	}
+
+TEST_END
@@ -426,6 +426,23 @@ TEST_BEGIN(list)
 		CHECK_EQUAL(c, 1);
 	}
 
+	// move and emplace
+	{
+		List<Vector<int> > l;
+		Vector<int> v;
+		v.add(1);
+		v.add(2);
+		l.add(std::move(v));
+		CHECK_EQUAL(v.count(), 0);
+		CHECK_EQUAL(l.first().count(), 2);
+		l.emplaceLast(16).add(3);
+		CHECK_EQUAL(l.last().count(), 1);
+		CHECK_EQUAL(l.last()[0], 3);
+		l.emplace().add(4);
+		CHECK_EQUAL(l.first()[0], 4);
+		CHECK_EQUAL(l.count(), 3);
+	}
+
 #if 0
 	// compatibility test
 	/* TODO
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * test/test_pagemap.cpp -- unit tests for elm::PageMap class.
+ */
+
+#include <elm/alloc/PageMap.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+// the page map only computes on addresses: no memory is needed behind them
+static inline void *at(t::intptr a) { return reinterpret_cast<void *>(a); }
+
+TEST_BEGIN(pagemap)
+
+	const t::intptr base = 0x10000000;
+	int da, db, dc;
+	void *A = &da, *B = &db, *C = &dc;
+
+	PageMap map(4096);
+	CHECK_EQUAL(map.pageShift(), 12);
+	CHECK(map.get(at(base)) == nullptr);
+	map.remove(at(base), 8192);
+	CHECK(map.get(at(base)) == nullptr);
+
+	// chunks sharing pages
+	map.add(at(base + 100), 8192, A);
+	map.add(at(base + 8292), 10000, B);
+	CHECK(map.get(at(base + 50)) == nullptr);
+	CHECK(map.get(at(base + 100)) == A);
+	CHECK(map.get(at(base + 4096)) == A);
+	CHECK(map.get(at(base + 5000)) == A);
+	CHECK(map.get(at(base + 8291)) == A);
+	CHECK(map.get(at(base + 8292)) == B);
+	CHECK(map.get(at(base + 12288)) == B);
+	CHECK(map.get(at(base + 18291)) == B);
+	CHECK(map.get(at(base + 18292)) == nullptr);
+	CHECK(map.get(at(base + 40000)) == nullptr);
+
+	// chunk in another part of the radix table
+	const t::intptr far = sizeof(void *) >= 8 ? t::intptr(0x7f0000000000LL) : t::intptr(0x70000000);
+	map.add(at(far), 4096, C);
+	CHECK(map.get(at(far)) == C);
+	CHECK(map.get(at(far + 4095)) == C);
+	CHECK(map.get(at(far + 4096)) == nullptr);
+	CHECK(map.get(at(far - 1)) == nullptr);
+	CHECK(map.get(at(base + 100)) == A);
+
+	// removal
+	map.remove(at(base + 100), 8192);
+	CHECK(map.get(at(base + 100)) == nullptr);
+	CHECK(map.get(at(base + 5000)) == nullptr);
+	CHECK(map.get(at(base + 8291)) == nullptr);
+	CHECK(map.get(at(base + 8292)) == B);
+	CHECK(map.get(at(base + 12288)) == B);
+	map.add(at(base + 100), 8192, A);
+	CHECK(map.get(at(base + 8291)) == A);
+	CHECK(map.get(at(base + 8292)) == B);
+	map.remove(at(base + 8292), 10000);
+	CHECK(map.get(at(base + 8291)) == A);
+	CHECK(map.get(at(base + 8292)) == nullptr);
+	CHECK(map.get(at(base + 12288)) == nullptr);
+	CHECK(map.get(at(far)) == C);
+	map.remove(at(far - 0x100000), 4096);
+	CHECK(map.get(at(far)) == C);
+
+	// clear
+	map.clear();
+	CHECK(map.get(at(base + 100)) == nullptr);
+	CHECK(map.get(at(far)) == nullptr);
+
+TEST_END
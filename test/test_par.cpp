@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * test/test_par.cpp -- unit tests for elm::par algorithms.
+ */
+
+#include <elm/data/Array.h>
+#include <elm/data/FragTable.h>
+#include <elm/data/par.h>
+#include <elm/data/Slice.h>
+#include <elm/data/Vector.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+TEST_BEGIN(par)
+
+	sys::ThreadPool pool(4);
+	const int N = 100000;
+	Vector<int> v;
+	for(int i = 0; i < N; i++)
+		v.add(i % 1000);
+
+	// count
+	{
+		CHECK_EQUAL(par::count(v, [](int x) { return x < 10; }, pool), N / 100);
+		CHECK_EQUAL(par::count(v, [](int x) { return x < 10; }), N / 100);
+		Vector<int> e;
+		CHECK_EQUAL(par::count(e, [](int x) { return true; }, pool), 0);
+		Slice<Vector<int> > s(v, 10, 100);
+		CHECK_EQUAL(par::count(s, [](int x) { return x < 20; }, pool), 10);
+	}
+
+	// forEach
+	{
+		Vector<int> w(v);
+		par::forEach(w, [](int& x) { x *= 2; }, pool);
+		bool failed = false;
+		for(int i = 0; i < N; i++)
+			if(w[i] != 2 * v[i])
+				failed = true;
+		CHECK(!failed);
+	}
+
+	// map
+	{
+		Vector<long> w;
+		w.add(-1);
+		par::map(v, [](int x) { return long(x) * x; }, w, pool);
+		CHECK_EQUAL(w.count(), N + 1);
+		bool failed = w[0] != -1;
+		for(int i = 0; i < N; i++)
+			if(w[i + 1] != long(v[i]) * v[i])
+				failed = true;
+		CHECK(!failed);
+
+		FragTable<int> f;
+		par::map(v, [](int x) { return x + 1; }, f, pool);
+		CHECK_EQUAL(f.count(), N);
+		CHECK_EQUAL(f[N - 1], v[N - 1] + 1);
+	}
+
+	// fold and reduce
+	{
+		long s = 0;
+		for(auto x: v)
+			s += x;
+		CHECK_EQUAL(par::fold(v, [](int x, int y) { return x + y; }, 0, pool), int(s));
+		CHECK_EQUAL(par::sum(v, pool), int(s));
+		CHECK_EQUAL(par::sum(v), sum(v));
+		CHECK_EQUAL(par::reduce(v, Add<int>(), 10, pool), int(s) + 10);
+
+		AllocArray<int> a(20, 2);
+		CHECK_EQUAL(par::product(a, pool), 1 << 20);
+
+		// non-commutative but associative operation
+		Vector<string> w;
+		for(int i = 0; i < 20000; i++)
+			w.add(_ << char('a' + i % 26));
+		string r = par::reduce(w, [](const string& a, const string& b) { return a + b; }, string(">"), pool);
+		CHECK_EQUAL(r.length(), 20001);
+		bool failed = r[0] != '>';
+		for(int i = 0; i < 20000; i++)
+			if(r[i + 1] != 'a' + i % 26)
+				failed = true;
+		CHECK(!failed);
+		string f = par::fold(w, [](const string& a, const string& b) { return a + b; }, string(">"), pool);
+		CHECK_EQUAL(f.length(), 20001);
+		CHECK_EQUAL(f[20000], '>');
+		CHECK_EQUAL(f[19999], 'a');
+		CHECK(f == fold(w, [](const string& a, const string& b) { return a + b; }, string(">")));
+	}
+
+TEST_END
@@ -19,12 +19,49 @@
  *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <elm/data/Array.h>
+#include <elm/data/FragTable.h>
+#include <elm/data/par.h>
 #include <elm/data/quicksort.h>
+#include <elm/data/radixsort.h>
 #include <elm/data/Vector.h>
 #include "../include/elm/test.h"
 
 using namespace elm;
 
+static t::uint32 seed = 12345;
+static int next(void) { seed = seed * 1103515245 + 12345; return int(seed >> 8); }
+
+static void make(Vector<int>& v, int n, int shape) {
+	v.clear();
+	for(int i = 0; i < n; i++)
+		switch(shape) {
+		case 0:	v.add(next()); break;
+		case 1:	v.add(i); break;
+		case 2:	v.add(n - i); break;
+		case 3:	v.add(next() % 4); break;
+		case 4:	v.add(i < n / 2 ? i : n - i); break;
+		}
+}
+
+template <class A, class C>
+static bool sorted(const A& a, const C& c) {
+	for(int i = 1; i < a.count(); i++)
+		if(c.doCompare(a[i - 1], a[i]) > 0)
+			return false;
+	return true;
+}
+
+template <class A>
+static t::int64 total(const A& a)
+	{ t::int64 s = 0; for(int i = 0; i < a.count(); i++) s += a[i]; return s; }
+
+class KeyOnly {
+public:
+	static inline int doCompare(const Pair<int, int>& p1, const Pair<int, int>& p2)
+		{ return p1.fst - p2.fst; }
+};
+
 TEST_BEGIN(quicksort)
 
 	Vector<int> v;
@@ -44,5 +81,148 @@ TEST_BEGIN(quicksort)
 		}
 	CHECK(ok);
 
+	// all shapes and sizes
+	{
+		Comparator<int> c;
+		Vector<int> v;
+		bool failed = false;
+		int sizes[] = { 0, 1, 2, 3, 15, 16, 17, 100, 129, 1000, 100000 };
+		for(auto n: sizes)
+			for(int s = 0; s < 5; s++) {
+				make(v, n, s);
+				t::int64 k = total(v);
+				quicksort(v);
+				if(!sorted(v, c) || total(v) != k)
+					failed = true;
+				make(v, n, s);
+				k = total(v);
+				mergesort(v);
+				if(!sorted(v, c) || total(v) != k)
+					failed = true;
+			}
+		CHECK(!failed);
+	}
+
+	// other comparator and other arrays
+	{
+		Vector<int> v;
+		make(v, 10000, 0);
+		quicksort(v, ReverseComparator<int, Comparator<int> >());
+		CHECK(sorted(v, ReverseComparator<int, Comparator<int> >()));
+		make(v, 10000, 0);
+		mergesort(v, ReverseComparator<int, Comparator<int> >());
+		CHECK(sorted(v, ReverseComparator<int, Comparator<int> >()));
+
+		AllocArray<int> a(5000);
+		for(int i = 0; i < a.count(); i++)
+			a[i] = next();
+		quicksort(a);
+		CHECK(sorted(a, Comparator<int>()));
+
+		FragTable<int> f;
+		for(int i = 0; i < 5000; i++)
+			f.add(next() % 100);
+		quicksort(f);
+		CHECK(sorted(f, Comparator<int>()));
+		for(int i = 0; i < f.count(); i++)
+			f[i] = next() % 100;
+		mergesort(f);
+		CHECK(sorted(f, Comparator<int>()));
+	}
+
+	// stability of merge sort
+	{
+		Vector<Pair<int, int> > v;
+		for(int i = 0; i < 10000; i++)
+			v.add(pair(next() % 10, i));
+		mergesort(v, KeyOnly());
+		bool failed = false;
+		for(int i = 1; i < v.count(); i++)
+			if(v[i - 1].fst > v[i].fst || (v[i - 1].fst == v[i].fst && v[i - 1].snd > v[i].snd))
+				failed = true;
+		CHECK(!failed);
+	}
+
+	// radix sort
+	{
+		Comparator<int> c;
+		Vector<int> v;
+		bool failed = false;
+		for(int s = 0; s < 5; s++) {
+			make(v, 10000, s);
+			for(int i = 0; i < v.count(); i += 3)
+				v[i] = -v[i];
+			t::int64 k = total(v);
+			radixsort(v);
+			if(!sorted(v, c) || total(v) != k)
+				failed = true;
+		}
+		CHECK(!failed);
+
+		Vector<t::uint64> u;
+		for(int i = 0; i < 10000; i++)
+			u.add((t::uint64(next()) << 32) | next());
+		radixsort(u);
+		CHECK(sorted(u, Comparator<t::uint64>()));
+
+		AllocArray<int *> a(1000);
+		for(int i = 0; i < a.count(); i++)
+			a[i] = reinterpret_cast<int *>(t::intptr(next()) * 8);
+		radixsort(a);
+		failed = false;
+		for(int i = 1; i < a.count(); i++)
+			if(a[i - 1] > a[i])
+				failed = true;
+		CHECK(!failed);
+
+		// stability with a key adapter
+		Vector<Pair<t::uint32, int> > p;
+		for(int i = 0; i < 10000; i++)
+			p.add(pair(t::uint32(next() % 100), i));
+		radixsort(p, PairAdapter<t::uint32, int>());
+		failed = false;
+		for(int i = 1; i < p.count(); i++)
+			if(p[i - 1].fst > p[i].fst || (p[i - 1].fst == p[i].fst && p[i - 1].snd > p[i].snd))
+				failed = true;
+		CHECK(!failed);
+	}
+
+	// parallel merge sort
+	{
+		sys::ThreadPool pool(4);
+		Comparator<int> c;
+		Vector<int> v;
+		bool failed = false;
+		int sizes[] = { 100, 20000, 100000, 123457 };
+		for(auto n: sizes)
+			for(int s = 0; s < 5; s++) {
+				make(v, n, s);
+				t::int64 k = total(v);
+				par::mergesort(v, c, pool);
+				if(!sorted(v, c) || total(v) != k)
+					failed = true;
+			}
+		CHECK(!failed);
+
+		Vector<Pair<int, int> > p;
+		for(int i = 0; i < 50000; i++)
+			p.add(pair(next() % 10, i));
+		par::mergesort(p, KeyOnly(), pool);
+		failed = false;
+		for(int i = 1; i < p.count(); i++)
+			if(p[i - 1].fst > p[i].fst || (p[i - 1].fst == p[i].fst && p[i - 1].snd > p[i].snd))
+				failed = true;
+		CHECK(!failed);
+	}
+
+	// complex items
+	{
+		Vector<string> v;
+		for(int i = 0; i < 1000; i++)
+			v.add(_ << (next() % 500));
+		quicksort(v);
+		CHECK(sorted(v, Comparator<string>()));
+	}
+
 TEST_END
 
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * test/test_ring_queue.cpp -- unit tests for elm::SPSCQueue and elm::MPMCQueue classes.
+ */
+
+#include <elm/data/MPMCQueue.h>
+#include <elm/data/SPSCQueue.h>
+#include <elm/sys/Thread.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+template <class Q>
+class Producer: public sys::Runnable {
+public:
+	Producer(Q& q, int first, int n): _q(q), _first(first), _n(n) { }
+	void run(void) override {
+		for(int i = 0; i < _n; i++)
+			_q.put(_first + i);
+	}
+private:
+	Q& _q;
+	int _first, _n;
+};
+
+template <class Q>
+class Consumer: public sys::Runnable {
+public:
+	Consumer(Q& q, int n): _q(q), _n(n), sum(0), ordered(true) { }
+	void run(void) override {
+		int last = -1;
+		for(int i = 0; i < _n; i++) {
+			int x = _q.get();
+			if(x <= last)
+				ordered = false;
+			last = x;
+			sum += x;
+		}
+	}
+private:
+	Q& _q;
+	int _n;
+public:
+	t::int64 sum;
+	bool ordered;
+};
+
+TEST_BEGIN(ring_queue)
+
+	// sequential SPSC
+	{
+		SPSCQueue<string> q(5);
+		CHECK_EQUAL(q.capacity(), 8);
+		CHECK(q.isEmpty());
+		string s;
+		CHECK(!q.tryGet(s));
+		for(int i = 0; i < 8; i++)
+			CHECK(q.tryPut(_ << i));
+		CHECK(!q.tryPut("full"));
+		CHECK_EQUAL(q.count(), 8);
+		CHECK(q.tryGet(s));
+		CHECK_EQUAL(s, string("0"));
+		CHECK(q.tryPut("8"));
+		bool failed = false;
+		for(int i = 1; i <= 8; i++)
+			if(!q.tryGet(s) || s != string(_ << i))
+				failed = true;
+		CHECK(!failed);
+		CHECK(q.isEmpty());
+		q.put("left");
+	}
+
+	// sequential MPMC
+	{
+		MPMCQueue<string> q(4);
+		CHECK_EQUAL(q.capacity(), 4);
+		CHECK(q.isEmpty());
+		string s;
+		CHECK(!q.tryGet(s));
+		for(int r = 0; r < 3; r++) {
+			for(int i = 0; i < 4; i++)
+				CHECK(q.tryPut(_ << i));
+			CHECK(!q.tryPut("full"));
+			CHECK_EQUAL(q.count(), 4);
+			bool failed = false;
+			for(int i = 0; i < 4; i++)
+				if(!q.tryGet(s) || s != string(_ << i))
+					failed = true;
+			CHECK(!failed);
+			CHECK(q.isEmpty());
+		}
+		q.put("left");
+		CHECK_EQUAL(q.get(), string("left"));
+		q.put("left");
+	}
+
+	// concurrent SPSC
+	{
+		static const int N = 200000;
+		SPSCQueue<int> q(64);
+		Producer<SPSCQueue<int> > p(q, 0, N);
+		Consumer<SPSCQueue<int> > c(q, N);
+		sys::Thread *pt = sys::Thread::make(p), *ct = sys::Thread::make(c);
+		ct->start();
+		pt->start();
+		pt->join();
+		ct->join();
+		delete pt;
+		delete ct;
+		CHECK(c.ordered);
+		CHECK_EQUAL(c.sum, t::int64(N) * (N - 1) / 2);
+		CHECK(q.isEmpty());
+	}
+
+	// concurrent MPMC
+	{
+		static const int T = 4, N = 50000;
+		typedef MPMCQueue<int> queue_t;
+		queue_t q(64);
+		Producer<queue_t> *ps[T];
+		Consumer<queue_t> *cs[T];
+		sys::Thread *ts[2 * T];
+		for(int i = 0; i < T; i++) {
+			ps[i] = new Producer<queue_t>(q, i * N, N);
+			cs[i] = new Consumer<queue_t>(q, N);
+			ts[2 * i] = sys::Thread::make(*ps[i]);
+			ts[2 * i + 1] = sys::Thread::make(*cs[i]);
+		}
+		for(int i = 0; i < 2 * T; i++)
+			ts[i]->start();
+		for(int i = 0; i < 2 * T; i++)
+			ts[i]->join();
+		t::int64 sum = 0;
+		for(int i = 0; i < T; i++) {
+			sum += cs[i]->sum;
+			delete ts[2 * i];
+			delete ts[2 * i + 1];
+			delete ps[i];
+			delete cs[i];
+		}
+		CHECK_EQUAL(sum, t::int64(T * N) * (T * N - 1) / 2);
+		CHECK(q.isEmpty());
+	}
+
+TEST_END
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * test/test_roaring.cpp -- unit tests for elm::RoaringVector class.
+ */
+
+#include <elm/util/BitVector.h>
+#include <elm/util/RoaringVector.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+static t::uint32 seed = 1;
+static inline int next(void) { seed = seed * 1103515245 + 12345; return seed >> 1; }
+
+static bool same(const RoaringVector& r, const BitVector& b) {
+	if(r.size() != b.size() || r.countOnes() != b.countOnes())
+		return false;
+	for(int i = 0; i < b.size(); i++)
+		if(r.bit(i) != b.bit(i))
+			return false;
+	int k = 0;
+	bool ok = true;
+	r.forEachOne([&](int i) { ok = ok && b.bit(i); k++; });
+	return ok && k == b.countOnes();
+}
+
+// fill a vector with a sparse (0), clustered (1) or dense (2) pattern
+static void fill(RoaringVector& r, BitVector& b, int kind) {
+	int n = b.size();
+	switch(kind) {
+	case 0:
+		for(int k = 0; k < n / 500; k++) {
+			int i = next() % n;
+			r.set(i);
+			b.set(i);
+		}
+		break;
+	case 1:
+		for(int k = 0; k < 40; k++) {
+			int s = next() % n, l = next() % 3000;
+			for(int i = s; i < s + l && i < n; i++) {
+				r.set(i);
+				b.set(i);
+			}
+		}
+		break;
+	case 2:
+		for(int i = 0; i < n; i++)
+			if(next() % 3) {
+				r.set(i);
+				b.set(i);
+			}
+		break;
+	}
+}
+
+TEST_BEGIN(roaring)
+
+	// simple operations
+	{
+		RoaringVector v(200000);
+		CHECK(v.isEmpty());
+		CHECK_EQUAL(v.size(), 200000);
+		CHECK_EQUAL(v.countOnes(), 0);
+		CHECK_EQUAL(v.countZeroes(), 200000);
+		v.set(0);
+		v.set(65535);
+		v.set(65536);
+		v.set(199999);
+		CHECK(!v.isEmpty());
+		CHECK_EQUAL(v.countOnes(), 4);
+		CHECK(v.bit(0));
+		CHECK(v.bit(65535));
+		CHECK(v.bit(65536));
+		CHECK(v.bit(199999));
+		CHECK(!v.bit(1));
+		CHECK(!v[131072]);
+		v[131072] = true;
+		CHECK(v[131072]);
+		v.clear(65536);
+		CHECK(!v.bit(65536));
+		CHECK_EQUAL(v.countOnes(), 4);
+		v.clear();
+		CHECK(v.isEmpty());
+		RoaringVector f(200000, true);
+		CHECK(f.isFull());
+		CHECK_EQUAL(f.countOnes(), 200000);
+		f.clear(100000);
+		CHECK(!f.isFull());
+		CHECK(!f.bit(100000));
+		CHECK(f.bit(99999));
+		CHECK(f.bit(100001));
+		f.set(100000);
+		CHECK(f.isFull());
+	}
+
+	// container conversions
+	{
+		RoaringVector r(65536);
+		BitVector b(65536);
+		for(int i = 0; i < 65536; i += 3) {
+			r.set(i);
+			b.set(i);
+		}
+		CHECK(same(r, b));
+		for(int i = 0; i < 65536; i += 6) {
+			r.clear(i);
+			b.clear(i);
+		}
+		CHECK(same(r, b));
+		for(int i = 0; i < 65536; i++) {
+			r.set(i);
+			b.set(i);
+		}
+		CHECK(same(r, b));
+		CHECK(r.isFull());
+	}
+
+	// runs built bit by bit are kept compact
+	{
+		RoaringVector r(200000);
+		for(int i = 1000; i < 150000; i++)
+			r.set(i);
+		CHECK_EQUAL(r.countOnes(), 149000);
+		CHECK(r.__size() < 1000);
+		r.clear(70000);
+		CHECK(!r.bit(70000));
+		CHECK(r.bit(69999));
+		CHECK(r.bit(70001));
+		CHECK(r.__size() < 1000);
+	}
+
+	// comparison with BitVector
+	for(int k1 = 0; k1 < 3; k1++)
+		for(int k2 = 0; k2 < 3; k2++) {
+			const int n = 300000;
+			RoaringVector r1(n), r2(n);
+			BitVector b1(n), b2(n);
+			fill(r1, b1, k1);
+			fill(r2, b2, k2);
+			CHECK(same(r1, b1));
+			CHECK(same(r2, b2));
+			CHECK(same(r1 | r2, b1 | b2));
+			CHECK(same(r1 & r2, b1 & b2));
+			CHECK(same(r1 - r2, b1 - b2));
+			CHECK(same(~r1, ~b1));
+			CHECK_EQUAL(r1.meets(r2), b1.meets(b2));
+			CHECK_EQUAL(r1.includes(r2), b1.includes(b2));
+			CHECK((r1 | r2).includes(r2));
+			CHECK((r1 | r2) >= r1);
+			CHECK(r1 == RoaringVector(r1));
+			CHECK(r1 != ~r1);
+			RoaringVector r3 = r1;
+			r3 |= r2;
+			r3 -= r2;
+			CHECK(same(r3, b1 - b2));
+			r3 &= r1;
+			CHECK(same(r3, b1 - b2));
+
+			int c = 0;
+			bool ok = true;
+			for(auto i: r1) {
+				ok = ok && b1.bit(i);
+				c++;
+			}
+			CHECK(ok);
+			CHECK_EQUAL(c, b1.countOnes());
+		}
+
+	// representation-independent equality
+	{
+		RoaringVector r1(70000), r2(70000);
+		for(int i = 100; i < 5000; i++)
+			r1.set(i);
+		r2.set(70000 - 1);
+		r2.clear(70000 - 1);
+		for(int i = 4999; i >= 100; i--)
+			r2.set(i);
+		r1.set(69999);
+		r2.set(69999);
+		CHECK(r1 == r2);
+		RoaringVector r3 = r1 | r2;
+		CHECK(r3 == r1);
+		CHECK(!(r3 < r1));
+		r3.clear(200);
+		CHECK(r3 < r1);
+	}
+
+TEST_END
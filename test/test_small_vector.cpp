@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * test/test_small_vector.cpp -- unit tests for elm::SmallVector class.
+ */
+
+#include <elm/data/SmallVector.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+// allocator counting the allocations
+class CountingAlloc {
+public:
+	static int allocs, frees;
+	inline t::ptr allocate(t::size size) const { allocs++; return DefaultAlloc().allocate(size); }
+	inline void free(t::ptr p) const { frees++; DefaultAlloc().free(p); }
+};
+int CountingAlloc::allocs = 0, CountingAlloc::frees = 0;
+
+TEST_BEGIN(small_vector)
+
+	// no allocation up to N items
+	{
+		CountingAlloc::allocs = 0;
+		{
+			SmallVector<int, 4, Equiv<int>, CountingAlloc> v;
+			for(int i = 0; i < 4; i++)
+				v.add(i);
+			CHECK(v.isSmall());
+			CHECK_EQUAL(v.count(), 4);
+			v.insert(0, 10);
+			CHECK_EQUAL(CountingAlloc::allocs, 1);
+			v.removeAt(0);
+			v.removeAt(0);
+			CHECK_EQUAL(v[0], 1);
+			CHECK_EQUAL(v.count(), 3);
+		}
+		CHECK_EQUAL(CountingAlloc::frees, 1);
+
+		CountingAlloc::allocs = 0;
+		for(int r = 0; r < 100; r++) {
+			SmallVector<string, 8, Equiv<string>, CountingAlloc> v;
+			for(int i = 0; i < 8; i++)
+				v.add(_ << i);
+			v.removeAt(3);
+			v.insert(3, "3");
+			SmallVector<string, 8, Equiv<string>, CountingAlloc> w(v);
+			SmallVector<string, 8, Equiv<string>, CountingAlloc> x(std::move(w));
+			CHECK(x == v);
+		}
+		CHECK_EQUAL(CountingAlloc::allocs, 0);
+	}
+
+	// spilling to the heap
+	{
+		SmallVector<string, 2> v;
+		for(int i = 0; i < 100; i++)
+			v.add(_ << i);
+		CHECK(!v.isSmall());
+		CHECK_EQUAL(v.count(), 100);
+		bool ok = true;
+		for(int i = 0; i < 100; i++)
+			if(v[i] != string(_ << i))
+				ok = false;
+		CHECK(ok);
+		SmallVector<string, 2> w(std::move(v));
+		CHECK(v.isSmall());
+		CHECK(v.isEmpty());
+		CHECK_EQUAL(w.count(), 100);
+		CHECK_EQUAL(w.pop(), string("99"));
+		CHECK_EQUAL(w.top(), string("98"));
+		w.shrink(1);
+		CHECK_EQUAL(w.count(), 1);
+		CHECK_EQUAL(w[0], string("0"));
+	}
+
+	// Vector-like interface
+	{
+		SmallVector<int> v;
+		v.add(1);
+		v.add(3);
+		v.insert(1, 2);
+		v.addFirst(0);
+		int i = 0;
+		for(auto x: v)
+			CHECK_EQUAL(x, i++);
+		CHECK(v.contains(2));
+		CHECK_EQUAL(v.indexOf(3), 3);
+		v.remove(2);
+		CHECK(!v.contains(2));
+		Array<int> a = v.asArray();
+		CHECK_EQUAL(a.count(), 3);
+		CHECK_EQUAL(a[2], 3);
+		for(auto& x: v)
+			x *= 2;
+		CHECK_EQUAL(v.last(), 6);
+		v.setLength(5);
+		CHECK_EQUAL(v.count(), 5);
+		v.emplace(7);
+		CHECK_EQUAL(v.top(), 7);
+		v.clear();
+		CHECK(v.isEmpty());
+	}
+
+TEST_END
@@ -250,6 +250,45 @@ TEST_BEGIN(stree)
 		CHECK_EQUAL(tree.get(1000, 0), 1);
 		CHECK_EQUAL(tree.get(1500, 0), 1);
 		CHECK_EQUAL(tree.get(2500, 0), 0);
+		CHECK(!tree.contains(999));
+		CHECK(!tree.contains(14001));
+	}
+
+	// empty tree
+	{
+		Tree<int, int> tree;
+		CHECK_EQUAL(tree.count(), 0);
+		CHECK(!tree.contains(0));
+		CHECK(!tree.contains(100));
+	}
+
+	// batched look-up
+	{
+		static const int N = 1000, Q = 3 * N;
+		SegmentBuilder<int, int> sbuilder(-1);
+		for(int i = 0; i < N; i++)
+			sbuilder.add(i * 100, i * 100 + 50, i);
+		Tree<int, int> tree;
+		sbuilder.make(tree);
+		CHECK_EQUAL(tree.count(), 2 * N - 1);
+		int keys[Q];
+		int *res[Q];
+		for(int i = 0; i < Q; i++)
+			keys[i] = (i * 7919) % (N * 100 + 200) - 100;
+		tree.find(keys, res, Q);
+		bool failed = false;
+		for(int i = 0; i < Q; i++) {
+			int k = keys[i];
+			if(k < 0 || k > (N - 1) * 100 + 50) {
+				if(res[i] != nullptr)
+					failed = true;
+			}
+			else if(res[i] == nullptr || *res[i] != (k % 100 < 50 ? k / 100 : -1))
+				failed = true;
+			else if(*res[i] != tree.get(k, -2))
+				failed = true;
+		}
+		CHECK(!failed);
 	}
 
 TEST_END
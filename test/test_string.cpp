@@ -5,7 +5,10 @@
  * test/test_string.cpp -- unit tests for String class.
  */
 
+#include <elm/data/Vector.h>
 #include <elm/io/BlockInStream.h>
+#include <elm/string/StringBuffer.h>
+#include <elm/sys/ThreadPool.h>
 #include "../include/elm/test.h"
 
 using namespace elm;
@@ -441,5 +444,129 @@ TEST_BEGIN(string)
 		CHECK_EQUAL(cs + cs2, string("123456"));
 	}
 
+	// strings longer than 64K
+	{
+		const int n = 200000;
+		char *t = new char[n];
+		for(int i = 0; i < n; i++)
+			t[i] = 'a' + i % 26;
+		string s(t, n);
+		delete [] t;
+		CHECK_EQUAL(s.length(), n);
+		CHECK_EQUAL(s[n - 1], char('a' + (n - 1) % 26));
+		string s2 = s.substring(100000, 70000);
+		CHECK_EQUAL(s2.length(), 70000);
+		CHECK_EQUAL(s2[0], char('a' + 100000 % 26));
+		string s3 = s + s2;
+		CHECK_EQUAL(s3.length(), n + 70000);
+		CHECK(s3.endsWith(s2));
+		CHECK_EQUAL(s3.indexOf('a', 150000), 150020);
+		StringBuffer buf;
+		for(int i = 0; i < 10000; i++)
+			buf << "0123456789";
+		string s4 = buf.toString();
+		CHECK_EQUAL(s4.length(), 100000);
+		CHECK_EQUAL(s4[99999], '9');
+	}
+
+	// more than 64K references to the same buffer
+	{
+		string s = "a buffer shared by more than 64K strings";
+		{
+			Vector<string> v;
+			for(int i = 0; i < 70000; i++)
+				v.add(s);
+			CHECK(v[69999] == "a buffer shared by more than 64K strings");
+			CHECK(v[69999].chars() == s.chars());
+		}
+		CHECK(s == "a buffer shared by more than 64K strings");
+		string s2 = s;
+		CHECK(s2 == "a buffer shared by more than 64K strings");
+		CHECK(s2.chars() == s.chars());
+	}
+
+	// null-termination of a substring owning its buffer
+	{
+		string s = string("abcdefghijklmnopqrstuvwxyz").substring(1, 2);
+		CHECK(strcmp(s.toCString().chars(), "bc") == 0);
+		string p = "abcdefghijklmnopqrstuvwxyz0123456789";
+		string s2 = p.substring(1, 25);
+		CHECK(s2.chars() == p.chars() + 1);
+		CHECK(strcmp(s2.toCString().chars(), "bcdefghijklmnopqrstuvwxyz") == 0);
+		CHECK(p == "abcdefghijklmnopqrstuvwxyz0123456789");
+		CHECK_EQUAL(int(strlen(p.chars())), 36);
+	}
+
+	// short strings stored inline and long strings around the limit
+	{
+		const char *t = "0123456789abcdefghijklmnopqrstuvwxyz";
+		for(int l = 20; l <= 26; l++) {
+			string s(t, l);
+			string c = s;
+			CHECK_EQUAL(c.length(), l);
+			CHECK(memcmp(c.chars(), t, l) == 0);
+			CHECK_EQUAL(int(strlen(c.toCString().chars())), l);
+			string d = string(t, l / 2) + string(t + l / 2, l - l / 2);
+			CHECK(d == s);
+			CHECK_EQUAL(int(strlen(d.toCString().chars())), l);
+		}
+		string i23 = "0123456789abcdefghijklm", h24 = "0123456789abcdefghijklmn";
+		string ci23 = i23, ch24 = h24;
+		CHECK_EQUAL(i23.length(), 23);
+		CHECK_EQUAL(h24.length(), 24);
+		CHECK(ci23 == i23);
+		CHECK(ch24 == h24);
+		CHECK(ci23.chars() != i23.chars());
+		CHECK(ch24.chars() == h24.chars());
+		string l = "a long string with more than twenty-three characters";
+		string sub = l.substring(2, 4);
+		CHECK(sub.chars() == l.chars() + 2);
+		CHECK(sub == "long");
+		CHECK(strcmp(sub.toCString().chars(), "long") == 0);
+		CHECK(l == "a long string with more than twenty-three characters");
+		string sh = "short string";
+		string ssub = sh.substring(6);
+		CHECK(ssub == "string");
+		CHECK(strcmp(ssub.toCString().chars(), "string") == 0);
+		string e;
+		CHECK(e.isEmpty());
+		CHECK_EQUAL(e.length(), 0);
+		CHECK(strcmp(e.toCString().chars(), "") == 0);
+		e = sh;
+		sh = "";
+		CHECK(e == "short string");
+		CHECK(sh.isEmpty());
+	}
+
+	// sharing strings between threads
+	{
+		const int n = 64, m = 2000;
+		Vector<string> v;
+		for(int i = 0; i < n; i++)
+			v.add(_ << "a string shared between threads " << i);
+		sys::ThreadPool pool(4);
+		Vector<string> r;
+		r.setLength(n * 4);
+		pool.forEach(n * 4, [&](int k) {
+			string s;
+			for(int i = 0; i < m; i++) {
+				string c = v[(k + i) % n];
+				s = c;
+				string d = c.substring(1);
+				if(d.length() != c.length() - 1)
+					s = "";
+			}
+			r[k] = s;
+		});
+		bool ok = true;
+		for(int k = 0; k < n * 4; k++)
+			ok = ok && r[k] == v[(k + m - 1) % n];
+		CHECK(ok);
+		r.clear();
+		for(int i = 0; i < n; i++)
+			ok = ok && v[i] == string(_ << "a string shared between threads " << i);
+		CHECK(ok);
+	}
+
 TEST_END
 
@@ -60,6 +60,28 @@ TEST_BEGIN(string_buffer)
 		CHECK_EQUAL(r, string("a,b,c"));
 	}
 
+	// big strings and reserve
+	{
+		StringBuffer buffer;
+		for(int i = 0; i < 100000; i++)
+			buffer << char('a' + i % 26);
+		CHECK_EQUAL(buffer.length(), 100000);
+		String str = buffer.toString();
+		CHECK_EQUAL(str.length(), 100000);
+		CHECK_EQUAL(str[99999], char('a' + 99999 % 26));
+		CHECK_EQUAL(str.toCString().chars()[100000], '\0');
+		buffer.reset();
+		buffer.reserve(1000);
+		buffer << "0123456789abcdefghijklmnopqrstuvwxyz";
+		CHECK_EQUAL(buffer.toString(), String("0123456789abcdefghijklmnopqrstuvwxyz"));
+		io::BlockOutStream out;
+		out.reserve(10000);
+		CHECK(out.capacity() >= 10000);
+		for(int i = 0; i < 2000; i++)
+			out.write("01234", 5);
+		CHECK_EQUAL(out.size(), 10000);
+	}
+
 TEST_END
 
 
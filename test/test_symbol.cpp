@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * test/test_symbol.cpp -- unit tests for elm::Symbol class.
+ */
+
+#include <elm/data/HashMap.h>
+#include <elm/data/Vector.h>
+#include <elm/json.h>
+#include <elm/string/Symbol.h>
+#include <elm/sys/ThreadPool.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+class SymbolMaker: public json::Maker {
+public:
+	virtual void beginObject(void) { }
+	virtual void onValue(int) { }
+	virtual bool usesSymbols(void) const { return true; }
+	virtual void onField(Symbol name) { names.add(name); }
+	Vector<Symbol> names;
+};
+
+TEST_BEGIN(symbol)
+
+	// interning
+	{
+		Symbol s1("alpha"), s2(string("alpha")), s3(cstring("alpha")), s4("beta");
+		CHECK(s1 == s2);
+		CHECK(s1 == s3);
+		CHECK(s1 != s4);
+		CHECK(s1.entry() == s2.entry());
+		CHECK_EQUAL(s1.toString(), string("alpha"));
+		CHECK_EQUAL(s1.toCString(), cstring("alpha"));
+		CHECK_EQUAL(s1.length(), 5);
+		CHECK(s1 < s4);
+		CHECK(s4 > s1);
+		CHECK_EQUAL(s1.compare(s2), 0);
+		string s = s4;
+		CHECK_EQUAL(s, string("beta"));
+	}
+
+	// null symbol
+	{
+		Symbol n, e(""), e2(string(""));
+		CHECK(n.isNull());
+		CHECK(!n);
+		CHECK(n == e);
+		CHECK(n == e2);
+		CHECK(n == Symbol::null);
+		CHECK_EQUAL(n.length(), 0);
+		CHECK_EQUAL(n.toCString(), cstring(""));
+		CHECK(n < Symbol("a"));
+	}
+
+	// hashing
+	{
+		Symbol s("a-rather-long-symbol-name-not-inlined");
+		CHECK_EQUAL(s.hash(), HashKey<string>::hash(s.toString()));
+		CHECK_EQUAL(HashKey<Symbol>::hash(s), s.hash());
+		HashMap<Symbol, int> map;
+		map.put(Symbol("x"), 1);
+		map.put(Symbol("y"), 2);
+		map.put(s, 3);
+		CHECK_EQUAL(map.get(Symbol("x"), 0), 1);
+		CHECK_EQUAL(map.get(Symbol("y"), 0), 2);
+		CHECK_EQUAL(map.get(Symbol("a-rather-long-symbol-name-not-inlined"), 0), 3);
+		CHECK_EQUAL(map.get(Symbol("z"), 0), 0);
+	}
+
+	// look-up without interning and sub-strings
+	{
+		CHECK(Symbol::find("never-interned-symbol").isNull());
+		int c = Symbol::count();
+		Symbol s("interned-symbol");
+		CHECK_EQUAL(Symbol::count(), c + 1);
+		CHECK(Symbol::find("interned-symbol") == s);
+		Symbol s2("interned-symbol");
+		CHECK_EQUAL(Symbol::count(), c + 1);
+		string big = "prefix-of-a-big-string-/interned-symbol-in-a-long-buffer/";
+		Symbol s3(big.substring(24, 15));
+		CHECK(s3 == s);
+		Symbol s4(big.substring(24, 27));
+		CHECK_EQUAL(s4.toCString(), cstring("interned-symbol-in-a-long-b"));
+		CHECK(s4.chars() != big.chars() + 24);
+	}
+
+	// concurrent interning
+	{
+		const int n = 500;
+		Vector<string> names;
+		for(int i = 0; i < n; i++)
+			names.add(_ << "concurrent-symbol-" << i);
+		sys::ThreadPool pool(4);
+		Vector<Symbol> r;
+		r.setLength(n * 4);
+		pool.forEach(n * 4, [&](int k) {
+			r[k] = Symbol(names[k % n]);
+		});
+		bool ok = true;
+		for(int k = 0; k < n * 4; k++)
+			ok = ok && r[k] == r[k % n] && r[k].toString() == names[k % n];
+		CHECK(ok);
+	}
+
+	// JSON field names
+	{
+		SymbolMaker m;
+		json::Parser p(m);
+		p.parse("{ \"alpha\": 1, \"beta\": 2, \"alpha\": 3 }");
+		CHECK_EQUAL(m.names.count(), 3);
+		json::Maker& mk = m;
+		if(false)
+			mk.onField("literal");	// not ambiguous: symbols are only built explicitly
+		if(m.names.count() == 3) {
+			CHECK(m.names[0] == Symbol("alpha"));
+			CHECK(m.names[1] == Symbol("beta"));
+			CHECK(m.names[0] == m.names[2]);
+		}
+	}
+
+TEST_END
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026, IRIT-UPS.
+ *
+ * test/test_thread_pool.cpp -- unit tests for elm::sys::ThreadPool class.
+ */
+
+#include <atomic>
+#include <elm/data/Vector.h>
+#include <elm/sys/ThreadPool.h>
+#include <elm/test.h>
+
+using namespace elm;
+using namespace elm::sys;
+
+TEST_BEGIN(thread_pool)
+
+	// each index processed once
+	{
+		ThreadPool pool(4);
+		CHECK_EQUAL(pool.threadCount(), 4);
+		const int N = 10000;
+		Vector<int> v;
+		for(int i = 0; i < N; i++)
+			v.add(0);
+		for(int r = 0; r < 100; r++)
+			pool.forEach(N, [&](int i) { v[i]++; });
+		bool failed = false;
+		for(int i = 0; i < N; i++)
+			if(v[i] != 100)
+				failed = true;
+		CHECK(!failed);
+		pool.forEach(0, [&](int i) { v[i] = 0; });
+		CHECK_EQUAL(v[0], 100);
+	}
+
+	// nested calls are sequential
+	{
+		ThreadPool pool(3);
+		std::atomic<int> cnt(0);
+		pool.forEach(10, [&](int i) {
+			pool.forEach(10, [&](int j) { cnt++; });
+		});
+		CHECK_EQUAL(int(cnt), 100);
+	}
+
+	// single thread and shared pool
+	{
+		ThreadPool pool(1);
+		int s = 0;
+		pool.forEach(100, [&](int i) { s += i; });
+		CHECK_EQUAL(s, 4950);
+		std::atomic<int> t(0);
+		ThreadPool::shared().forEach(100, [&](int i) { t += i; });
+		CHECK_EQUAL(int(t), 4950);
+		CHECK(ThreadPool::shared().threadCount() >= 1);
+	}
+
+TEST_END
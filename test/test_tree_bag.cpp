@@ -107,6 +107,46 @@ TEST_BEGIN(tree_bag)
 			cerr << *iter << ", ";
 		cerr << io::endl;*/
 	}
+
+	// sorted insertion, duplicates and count
+	{
+		const int N = 100000;
+		TreeBag<int> tree;
+		for(int i = 0; i < N; i++)
+			tree.add(i);
+		for(int i = 0; i < N; i += 10)
+			tree.add(i);
+		CHECK_EQUAL(tree.count(), N + N / 10);
+		int p = -1, c = 0;
+		bool sorted = true;
+		for(auto x: tree) {
+			if(x < p)
+				sorted = false;
+			p = x;
+			c++;
+		}
+		CHECK(sorted);
+		CHECK_EQUAL(c, N + N / 10);
+		for(int i = 0; i < N; i += 2)
+			tree.remove(i);
+		CHECK_EQUAL(tree.count(), N / 2 + N / 10);
+		CHECK(tree.contains(10));
+		CHECK(!tree.contains(2));
+		CHECK(tree.contains(N - 1));
+		tree.remove(10);
+		CHECK(!tree.contains(10));
+
+		TreeBag<int> tree2;
+		tree2 = tree;
+		CHECK(tree2 == tree);
+		CHECK_EQUAL(tree2.count(), tree.count());
+		tree.clear();
+		CHECK(tree.isEmpty());
+		CHECK_EQUAL(tree.count(), 0);
+		tree.add(1);
+		CHECK_EQUAL(tree.count(), 1);
+		CHECK(tree2 != tree);
+	}
 	
 	// TreeMap
 	{
@@ -26,6 +26,20 @@ inline void get(bool b) { }
 
 using namespace elm;
 
+class Counted {
+public:
+	static int copies;
+	inline Counted(int x = 0): v(x) { }
+	inline Counted(int x, int y): v(x + y) { }
+	inline Counted(const Counted& c): v(c.v) { copies++; }
+	inline Counted(Counted&& c): v(c.v) { c.v = -1; }
+	inline Counted& operator=(const Counted& c) { v = c.v; copies++; return *this; }
+	inline Counted& operator=(Counted&& c) { v = c.v; c.v = -1; return *this; }
+	inline bool operator==(const Counted& c) const { return v == c.v; }
+	int v;
+};
+int Counted::copies = 0;
+
 // test_vector()
 TEST_BEGIN(vector)
 	
@@ -297,6 +311,66 @@ TEST_BEGIN(vector)
 		CHECK(!v1.equals(v2));
 	}
 
+	// move semantics
+	{
+		Counted::copies = 0;
+		Vector<Counted> v(1);
+		for(int i = 0; i < 100; i++)
+			v.add(Counted(i));
+		CHECK_EQUAL(Counted::copies, 0);
+		CHECK_EQUAL(v[99].v, 99);
+		v.emplace(100, 1);
+		CHECK_EQUAL(v.top().v, 101);
+		v.insert(0, Counted(-2));
+		v.removeAt(0);
+		CHECK_EQUAL(v.pop().v, 101);
+		CHECK_EQUAL(Counted::copies, 0);
+		Counted c(5);
+		v.add(c);
+		CHECK_EQUAL(Counted::copies, 1);
+		CHECK_EQUAL(c.v, 5);
+
+		Vector<Counted> w(std::move(v));
+		CHECK_EQUAL(v.count(), 0);
+		CHECK_EQUAL(w.count(), 101);
+		CHECK_EQUAL(Counted::copies, 1);
+		v.add(Counted(1));
+		CHECK_EQUAL(v.count(), 1);
+		v = std::move(w);
+		CHECK_EQUAL(v.count(), 101);
+		CHECK_EQUAL(v[50].v, 50);
+		CHECK_EQUAL(Counted::copies, 1);
+	}
+
+	// growth of relocatable items
+	{
+		Vector<string> v;
+		for(int i = 0; i < 1000; i++)
+			v.add(_ << i);
+		bool ok = true;
+		for(int i = 0; i < 1000; i++)
+			if(v[i] != string(_ << i))
+				ok = false;
+		CHECK(ok);
+	}
+
+	// vector of vectors
+	{
+		Vector<Vector<int> > vv;
+		for(int i = 0; i < 50; i++) {
+			Vector<int> v;
+			for(int j = 0; j <= i; j++)
+				v.add(j);
+			vv.add(std::move(v));
+			CHECK_EQUAL(v.count(), 0);
+		}
+		bool ok = true;
+		for(int i = 0; i < 50; i++)
+			if(vv[i].count() != i + 1 || vv[i][i] != i)
+				ok = false;
+		CHECK(ok);
+	}
+
 #	if 0
 	{
 		Vector<int> v;
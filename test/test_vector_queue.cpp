@@ -89,6 +89,23 @@ TEST_BEGIN(vector_queue)
 			} 
 		}
 	}
+
+	// enlarging with wrapped-around objects
+	{
+		VectorQueue<string> queue(2);
+		for(int i = 0; i < 3; i++)
+			queue.put(_ << i);
+		queue.get();
+		queue.get();
+		for(int i = 3; i < 10; i++)
+			queue.put(_ << i);
+		bool ok = true;
+		for(int i = 2; i < 10; i++)
+			if(queue.get() != string(_ << i))
+				ok = false;
+		CHECK(ok);
+		CHECK(queue.isEmpty());
+	}
 	
 TEST_END
 